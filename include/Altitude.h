@@ -0,0 +1,38 @@
+// include/Altitude.h
+#ifndef ALTITUDE_H
+#define ALTITUDE_H
+
+#include <stdint.h>
+
+#define ALTITUDE_SEA_LEVEL_HPA  1013.25f
+
+// 테이블 범위 (hPa) - 범위 밖은 powf로 계산
+#define ALTITUDE_TABLE_MIN_HPA  300.0f
+#define ALTITUDE_TABLE_MAX_HPA  1100.0f
+#define ALTITUDE_TABLE_SIZE     513
+
+// 기압 -> 고도 변환
+//   h = 44330 * (1 - (p / p0)^0.1903)
+//     = 44330 * (1 - p^0.1903 / p0^0.1903)
+// p^0.1903 은 컴파일 타임에 만든 테이블에서 선형 보간 (300~1100 hPa, 오차 0.02 m 이하)
+// p0^0.1903 의 역수는 기준 기압을 바꿀 때 한 번만 계산
+class AltitudeConverter {
+private:
+    float referencePressure;     // hPa
+    float inverseReference;      // 1 / p0^0.1903
+
+public:
+    AltitudeConverter();
+
+    // 기준 기압 설정 (지상 캘리브레이션 결과 또는 해수면 기압)
+    void setReference(float pressureHpa);
+    float getReference() { return referencePressure; }
+
+    // 기압(hPa) -> 기준 기압 대비 고도(m)
+    float toAltitude(float pressureHpa) const;
+
+    // p^0.1903 (테이블 보간)
+    static float pressurePower(float pressureHpa);
+};
+
+#endif
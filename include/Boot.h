@@ -0,0 +1,62 @@
+// include/Boot.h
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Scheduler.h"
+
+#define BOOT_MAX_STEPS 8
+
+// 초기화 단계 결과
+enum InitStatus : uint8_t {
+    INIT_PENDING = 0,        // 아직 진행 중 (다음 호출에서 이어서)
+    INIT_READY,
+    INIT_FAILED,
+};
+
+// 재개 가능한 초기화 함수 (호출마다 짧게 진행하고 바로 반환)
+typedef InitStatus (*InitFunction)();
+
+// 초기화 항목 정의 (상수 테이블)
+struct BootStep {
+    const char* name;
+    InitFunction step;
+    uint32_t timeoutUs;      // 시작부터 이 시간 안에 READY가 아니면 FAILED (0 = 제한 없음)
+};
+
+// 여러 장치의 초기화를 번갈아 진행 (한 장치가 기다리는 동안 다른 장치 진행)
+class BootSequencer {
+private:
+    const BootStep* steps;
+    uint8_t stepCount;
+    ClockFunction clock;
+
+    uint32_t startTime;
+    InitStatus status[BOOT_MAX_STEPS];
+    uint32_t finishedAt[BOOT_MAX_STEPS];     // 시작 기준 완료 시각 (us)
+    uint8_t readyCount;
+    uint8_t doneCount;
+
+public:
+    BootSequencer(ClockFunction clockFn);
+
+    bool begin(const BootStep* table, uint8_t count);
+
+    // 진행 중인 모든 단계를 한 번씩 호출, 모두 끝났으면 true
+    bool run();
+
+    bool isDone() { return doneCount == stepCount; }
+    uint8_t getReadyCount() { return readyCount; }
+    uint8_t getStepCount() { return stepCount; }
+    const BootStep& getStep(uint8_t index) { return steps[index]; }
+    InitStatus getStatus(uint8_t index) { return status[index]; }
+    uint32_t getFinishTime(uint8_t index) { return finishedAt[index]; }
+    uint32_t getStartTime() { return startTime; }
+
+    // 부팅 보고 한 줄 (줄바꿈 제외): BOOT,첫패킷(us),이름,결과,완료(us),...
+    // 시각은 모두 리셋 기준 clock 값
+    size_t formatReport(char* buffer, size_t size, uint32_t firstPacketUs);
+};
+
+#endif
@@ -0,0 +1,81 @@
+// include/CMD.h
+#ifndef CMD_H
+#define CMD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Telemetry.h"
+
+// 지상국 명령: CMD,<TEAM_ID>,<명령>[,<인자>...] + 줄바꿈
+#define CMD_MAX_LEN     64       // 줄바꿈 제외 한 줄 최대 길이
+#define CMD_MAX_ARGS    4        // 명령 이름 뒤 인자 수
+
+// 명령 이름 뒤 인자 (수신 버퍼 안을 가리킴, 핸들러 반환 후 무효)
+struct CommandArgs {
+    const char* argv[CMD_MAX_ARGS];
+    uint8_t argc;
+};
+
+// 인자가 맞으면 실행하고 true (false면 에코 갱신 없음)
+typedef bool (*CommandHandler)(const CommandArgs& args);
+
+// 디스패치 테이블 항목 (이름 오름차순으로 정렬되어 있어야 함 - 이진 탐색)
+struct CommandSpec {
+    const char* name;
+    CommandHandler handler;
+    uint8_t minArgs;
+    uint8_t maxArgs;
+};
+
+// 컴파일 타임 문자열 비교 (strcmp와 같은 부호)
+constexpr int commandCompare(const char* a, const char* b) {
+    return (*a != *b || *a == '\0') ? (int)(uint8_t)*a - (int)(uint8_t)*b : commandCompare(a + 1, b + 1);
+}
+
+// 테이블 정렬 확인 (static_assert용)
+constexpr bool commandTableSorted(const CommandSpec* table, size_t count) {
+    return count < 2 || (commandCompare(table[0].name, table[1].name) < 0 && commandTableSorted(table + 1, count - 1));
+}
+
+// 바이트 단위 명령 수신기
+// 한 줄을 고정 버퍼에 모았다가 줄바꿈에서 ','를 널 문자로 바꿔 토큰을 잡고 테이블에서 핸들러를 찾음
+// 일반 바이트는 O(1), 줄바꿈 바이트만 O(CMD_MAX_LEN + log 명령 수) + 핸들러
+class CommandParser {
+private:
+    const CommandSpec* table;
+    uint8_t tableSize;
+
+    char line[CMD_MAX_LEN + 1];
+    uint8_t length;
+    bool discard;                    // 너무 길거나 출력 불가 문자가 섞인 줄
+
+    // 마지막으로 실행한 명령 (이름과 인자를 이어 붙임, 예: CXON, SIMP101325)
+    char echo[TELEMETRY_CMD_ECHO_LEN];
+
+    // 통계
+    uint32_t accepted;
+    uint32_t rejected;               // 형식/팀 ID/인자 오류, 핸들러 거부
+    uint32_t unknown;                // 테이블에 없는 명령
+    uint32_t dropped;                // 너무 길거나 깨진 줄
+
+    const CommandSpec* find(const char* name);
+    bool process();
+
+public:
+    CommandParser();
+
+    // 디스패치 테이블 연결 (정렬은 commandTableSorted로 컴파일 때 확인)
+    void begin(const CommandSpec* commands, uint8_t count);
+
+    // 한 바이트 처리, 명령이 실행되면 true (에코 갱신됨)
+    bool feed(char c);
+
+    const char* getEcho() const { return echo; }
+
+    uint32_t getAccepted() const { return accepted; }
+    uint32_t getRejected() const { return rejected; }
+    uint32_t getUnknown() const { return unknown; }
+    uint32_t getDropped() const { return dropped; }
+};
+
+#endif
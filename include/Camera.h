@@ -0,0 +1,251 @@
+// include/Camera.h
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "HAL.h"
+#include "SD.h"
+#include "SpscRing.h"
+
+// 프레임 버퍼 풀 (main에서 DMAMEM/EXTMEM으로 할당해서 넘김)
+#define CAMERA_MAX_FRAMES        8          // 2의 거듭제곱 (프레임 큐)
+#define CAMERA_FRAME_SIZE        32768      // 버퍼 하나 (섹터 배수, 헤더 포함)
+#define CAMERA_HEADER_SIZE       32         // 버퍼 앞 캐시 라인 하나는 프레임 헤더
+#define CAMERA_READ_CHUNK        4096       // DMA 전송 한 번 (service마다 진행 확인)
+#define CAMERA_CAPTURE_TIMEOUT_US 500000    // 캡처 완료를 기다리는 최대 시간
+#define CAMERA_WRITE_CHUNK       4096       // 기록기 service 한 번에 쓰는 양 (8섹터)
+#define CAMERA_SYNC_INTERVAL     16         // 프레임 N개 기록마다 sync
+#define CAMERA_SYNC_PERIOD_US    1000000    // 기록한 프레임이 있으면 최소 이 주기로 sync
+#define CAMERA_PREALLOCATE       (256UL * 1024 * 1024)
+
+#define CAMERA_FRAME_MAGIC       0x304D5246  // "FRM0"
+
+// SPI 카메라 (ArduCAM Mini 2MP, OV2640 JPEG)
+#define CAMERA_CS                9
+#define CAMERA_SPI_CLOCK         8000000
+
+// 프레임 헤더 (리틀엔디언, 버퍼의 앞 CAMERA_HEADER_SIZE 바이트 안)
+// 기록 파일은 [헤더 | JPEG | 0 패딩] 이 섹터 단위로 이어짐
+struct __attribute__((packed)) CameraFrameHeader {
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t timestamp;      // us (캡처 완료)
+    uint32_t length;         // JPEG 바이트 수
+    uint32_t storedSize;     // 헤더 + JPEG + 패딩 (섹터 배수)
+};
+
+// 풀의 버퍼 하나 (복사 없이 카메라 -> 기록기 -> 카메라로 돌아감)
+struct CameraFrame {
+    uint8_t* buffer;         // 헤더 위치 (JPEG는 buffer + CAMERA_HEADER_SIZE)
+    uint32_t sequence;
+    uint32_t capturedAt;     // us
+    uint32_t length;         // JPEG 바이트 수
+    uint32_t storedSize;     // 기록할 바이트 수
+};
+
+// 카메라 장치 (보드: ArduCAM SPI FIFO, 호스트: 가짜 카메라)
+// 모든 호출은 바로 반환 (캡처/전송 완료는 폴링)
+class CameraDevice {
+public:
+    virtual ~CameraDevice() {}
+
+    virtual bool begin() = 0;
+
+    // 한 장 캡처 시작 -> captureDone이 true가 되면 FIFO에 프레임 (length 바이트)
+    virtual void startCapture() = 0;
+    virtual bool captureDone(uint32_t& length) = 0;
+
+    // FIFO 읽기: beginRead -> (startRead -> readDone)* -> endRead
+    virtual void beginRead() = 0;
+    virtual void startRead(uint8_t* destination, size_t length) = 0;
+    virtual bool readDone() = 0;
+    virtual void endRead() = 0;
+
+    // 읽지 않고 FIFO 비우기 (버퍼가 없거나 너무 큰 프레임)
+    virtual void discard() = 0;
+};
+
+#ifdef ARDUINO
+#include <SPI.h>
+#include <ArduCAM.h>
+
+// ArduCAM Mini 2MP: 센서 설정(SCCB, Wire)은 ArduCAM 라이브러리,
+// FIFO 버스트 읽기는 SPI 비동기 DMA 전송 (EventResponder로 완료 통지)
+// 읽는 동안 SPI 버스를 점유하므로 BNO085 SPI 전송과 함께 쓸 수 없음
+class ArduCamDevice : public CameraDevice {
+private:
+    ArduCAM cam;
+    SPISettings settings;
+    EventResponder transferEvent;
+    volatile bool transferDone;
+
+    uint8_t* readDestination;
+    size_t readLength;
+
+    static void onTransfer(EventResponderRef event);
+
+public:
+    ArduCamDevice();
+
+    bool begin() override;
+    void startCapture() override;
+    bool captureDone(uint32_t& length) override;
+    void beginRead() override;
+    void startRead(uint8_t* destination, size_t length) override;
+    bool readDone() override;
+    void endRead() override;
+    void discard() override;
+};
+#else
+// 호스트: 정해진 크기/시간으로 프레임을 만드는 카메라 (시뮬레이션 시계 기준)
+class FakeCameraDevice : public CameraDevice {
+private:
+    uint32_t captureUs;          // 노출 + 압축 시간
+    uint32_t minLength;          // 프레임 크기 범위 (순번마다 바뀜)
+    uint32_t maxLength;
+    float bytesPerUs;            // FIFO 읽기 속도 (SPI 8 MHz = 1 B/us)
+
+    uint32_t sequence;
+    uint32_t frameLength;
+    uint32_t readyAt;
+    bool capturing;
+    uint32_t readOffset;         // 프레임 안 진행 위치 (내용 확인용 패턴)
+
+public:
+    FakeCameraDevice(uint32_t captureTimeUs, uint32_t minBytes, uint32_t maxBytes, float readBytesPerUs);
+
+    bool begin() override { return true; }
+    void startCapture() override;
+    bool captureDone(uint32_t& length) override;
+    void beginRead() override { readOffset = 0; }
+    void startRead(uint8_t* destination, size_t length) override;
+    bool readDone() override;
+    void endRead() override { capturing = false; }
+    void discard() override { capturing = false; }
+
+    uint32_t getFramesProduced() { return sequence; }
+
+    // 프레임 내용 (순번, 위치) -> 바이트 (기록 결과 확인용)
+    static uint8_t patternByte(uint32_t sequence, uint32_t offset) { return (uint8_t)(sequence * 31 + offset * 7); }
+};
+#endif
+
+// 프레임 캡처기
+// 빈 버퍼 큐에서 버퍼를 받아 DMA로 채우고, 가득 찬 버퍼 인덱스를 프레임 큐로 넘김
+// 기록기가 다 쓰고 돌려줄 때까지 버퍼는 복사되지 않음
+// 빈 버퍼가 없으면 그 프레임은 버림 (비행 태스크는 기다리지 않음)
+class Camera {
+private:
+    CameraDevice* device;
+    CameraFrame frames[CAMERA_MAX_FRAMES];
+    uint8_t frameCount;
+    uint32_t frameSize;          // 버퍼 하나 크기
+
+    // 버퍼 인덱스 큐 (캡처 -> 기록: full, 기록 -> 캡처: free)
+    SpscRing<uint8_t, CAMERA_MAX_FRAMES> freeFrames;
+    SpscRing<uint8_t, CAMERA_MAX_FRAMES> fullFrames;
+
+    enum Phase : uint8_t { PHASE_IDLE, PHASE_CAPTURE, PHASE_READ };
+    Phase phase;
+    bool ready;
+    bool recording;
+    uint32_t intervalUs;         // 캡처 시작 간격 (0 = 최대 속도)
+    uint32_t nextCaptureAt;
+    uint32_t captureStartedAt;
+
+    // 읽는 중인 프레임
+    uint8_t current;
+    uint32_t readOffset;
+    uint32_t readLength;         // 이번 DMA 전송 길이
+
+    // 통계
+    uint32_t sequence;
+    uint32_t framesCaptured;
+    uint32_t framesDropped;      // 빈 버퍼 없음
+    uint32_t framesOversize;     // 버퍼보다 큰 프레임
+    uint32_t captureTimeouts;
+    uint32_t framesReleased;
+    uint32_t lastLatencyUs;      // 캡처 완료 -> 기록 완료
+    uint32_t maxLatencyUs;
+    uint64_t totalLatencyUs;
+
+    void finishFrame();
+
+public:
+    Camera();
+
+    // 버퍼 풀 연결 (memory는 32바이트 정렬, bufferSize는 섹터 배수), 장치 초기화
+    bool begin(CameraDevice* camera, uint8_t* memory, size_t bufferSize, uint8_t count);
+
+    // 기록 시작/중지 (중지해도 진행 중인 프레임은 마저 읽음)
+    void start(uint32_t captureIntervalUs);
+    void stop() { recording = false; }
+    bool isRecording() { return recording; }
+    bool isReady() { return ready; }
+
+    // 캡처/전송 진행 (주기 태스크에서 호출, 블로킹 없음)
+    void service();
+
+    // 기록기 쪽: 다 찬 프레임 꺼내기 / 다 쓴 프레임 돌려주기
+    CameraFrame* acquire();
+    void release(CameraFrame* frame);
+
+    // 통계
+    uint32_t getFramesCaptured() { return framesCaptured; }
+    uint32_t getFramesDropped() { return framesDropped; }
+    uint32_t getFramesOversize() { return framesOversize; }
+    uint32_t getCaptureTimeouts() { return captureTimeouts; }
+    uint32_t getFramesReleased() { return framesReleased; }
+    uint32_t getQueuedFrames() { return fullFrames.size(); }
+    uint32_t getLastLatencyUs() { return lastLatencyUs; }
+    uint32_t getMaxLatencyUs() { return maxLatencyUs; }
+    uint32_t getMeanLatencyUs() { return framesReleased ? (uint32_t)(totalLatencyUs / framesReleased) : 0; }
+};
+
+// 프레임 기록기 (별도 파일)
+// 프레임 버퍼를 그대로 섹터 단위 청크로 기록하고 끝나면 카메라에 돌려줌
+class CameraRecorder {
+private:
+    LogBackend* backend;
+    Camera* camera;
+    bool active;
+    char path[LOG_PATH_MAX];
+
+    CameraFrame* writing;        // 기록 중인 프레임
+    uint32_t writeOffset;
+
+    uint32_t framesWritten;
+    uint32_t writeErrors;
+    uint64_t bytesWritten;
+    uint32_t maxWriteMicros;
+    uint32_t busySkips;
+
+    bool unsynced;
+    uint32_t lastSyncMicros;
+
+    // 청크 하나 기록 (기록할 프레임이 없으면 false)
+    bool writeChunk();
+
+public:
+    CameraRecorder();
+
+    // 새 번호 파일 열기 (base000.ext부터 빈 이름)
+    bool begin(LogBackend* storage, const char* base, const char* extension, Camera* source);
+
+    // 청크 하나 기록 (저우선 태스크에서 주기 호출, 카드가 바쁘면 미룸)
+    void service();
+
+    // 대기 중인 프레임 모두 기록 후 닫기
+    void end();
+
+    bool isActive() { return active; }
+    const char* getPath() { return path; }
+    uint32_t getFramesWritten() { return framesWritten; }
+    uint32_t getWriteErrors() { return writeErrors; }
+    uint64_t getBytesWritten() { return bytesWritten; }
+    uint32_t getMaxWriteMicros() { return maxWriteMicros; }
+    uint32_t getBusySkips() { return busySkips; }
+};
+
+#endif
@@ -0,0 +1,80 @@
+// include/Filter.h
+#ifndef FILTER_H
+#define FILTER_H
+
+#include <stdint.h>
+
+#define GRAVITY 9.80665f
+
+// 기본 잡음 설정
+#define FILTER_ACCEL_NOISE     0.5f    // m/s² (가속도 측정 잡음)
+#define FILTER_BIAS_NOISE      0.02f   // m/s³ (가속도 바이어스 랜덤워크)
+#define FILTER_ALTITUDE_NOISE  0.5f    // m (기압 고도 잡음)
+
+// 정상상태 이득 한 벌 (고도, 속도, 바이어스)
+struct FilterGain {
+    float k[3];
+};
+
+// 고도/수직속도/가속도 바이어스 3상태 칼만 필터
+//   예측: BNO085 월드 좌표계 수직 가속도 (accel_yaw - g), IMU 주기
+//   보정: BMP390 고도, BMP 주기
+// 고정 이득 모드에서는 정상상태 이득을 미리 계산해 공분산 연산을 생략
+class Filter {
+private:
+    // 상태
+    float altitude;          // m
+    float velocity;          // m/s
+    float bias;              // m/s²
+
+    // 공분산
+    float P[3][3];
+
+    // 잡음 파라미터
+    float accelVariance;
+    float biasVariance;
+    float altitudeVariance;
+
+    // 고정 이득
+    bool fixedGain;
+    float gain[3];
+
+    bool initialized;
+
+    void resetCovariance();
+    void predictCovariance(float dt);
+    void updateCovariance(float k[3]);
+
+public:
+    Filter();
+
+    // 잡음 설정 (표준편차)
+    void configure(float accelNoise, float biasNoise, float altitudeNoise);
+
+    // 첫 고도로 초기화
+    void begin(float initialAltitude);
+
+    // 고정 dt / 보정 비율에서 정상상태 이득 계산 (필터 상태는 그대로)
+    // (예: IMU 200Hz, BMP 50Hz -> dt = 0.005, predictsPerUpdate = 4)
+    FilterGain solveFixedGain(float dt, uint8_t predictsPerUpdate);
+
+    // 미리 계산한 이득으로 고정 이득 모드 전환 (상태 유지, 비행 중 주기 전환용)
+    void setFixedGain(const FilterGain& fixed);
+    void computeFixedGain(float dt, uint8_t predictsPerUpdate) { setFixedGain(solveFixedGain(dt, predictsPerUpdate)); }
+    void useFixedGain(bool enable) { fixedGain = enable; }
+
+    // 예측 (중력 제외 수직 가속도, m/s²)
+    void predict(float accelUp, float dt);
+
+    // 보정 (기압 고도, m)
+    void update(float measuredAltitude);
+
+    // 결과
+    float getAltitude() { return altitude; }
+    float getVelocity() { return velocity; }
+    float getBias() { return bias; }
+    bool isInitialized() { return initialized; }
+    const float* getGain() { return gain; }
+};
+
+#endif
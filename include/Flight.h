@@ -0,0 +1,73 @@
+// include/Flight.h
+#ifndef FLIGHT_H
+#define FLIGHT_H
+
+#include "HAL.h"
+#include "sensors/BMP390.h"
+#include "sensors/BNO085.h"
+#include "sensors/GPS.h"
+#include "Packet.h"
+#include "Filter.h"
+#include "State.h"
+#include "Scheduler.h"
+#include "Profiler.h"
+#include "Boot.h"
+#include "SD.h"
+#include "Recovery.h"
+#include "XBee.h"
+#include "CMD.h"
+#include "Mode.h"
+#include "PID.h"
+#include "Servo.h"
+#include "Camera.h"
+
+// 비행 소프트웨어 본체 (장치 객체, 태스크, 명령/태스크/부팅 테이블)
+// 보드에서는 main.cpp의 setup/loop가 호출하고,
+// 호스트에서는 가짜 장치를 붙인 같은 코드를 재생 하네스가 시뮬레이션 시계로 호출
+
+// 저널 확인, 링크/명령/제어 설정 후 부팅 시작 (Serial은 호출 전에 열어 둠)
+void flightSetup();
+
+// 부팅 단계 진행, 스케줄러 한 패스
+void flightLoop();
+
+// 비행 객체 (재생/시험에서 상태 확인)
+extern BMP390 bmp;
+extern BNO085 imu;
+extern GPS gps;
+extern Packet telemetry;
+extern XBee radio;
+extern CommandParser commands;
+extern InjectedPressureSource simulatedPressure;
+extern SDLogger logger;
+extern Camera camera;
+extern CameraRecorder frameRecorder;
+extern Recovery recovery;
+extern Filter altitudeFilter;
+extern StateMachine flightState;
+extern Mode rates;
+extern Scheduler scheduler;
+extern BootSequencer boot;
+extern bool warmStart;
+
+// 태스크 테이블 (Flight.cpp에서 constexpr로 정의)
+extern const TaskConfig TASKS[];
+extern const uint8_t TASK_COUNT;
+extern const uint8_t TASK_BMP;
+
+#ifndef ARDUINO
+// 호스트 가짜 장치 (하네스가 기압/운동/UART 수신을 넣음)
+extern FakeBmp390Bus baroBus;
+extern FakeSh2Device imuDevice;
+extern LoopbackPort gpsPort;
+extern LoopbackPort radioPort;
+extern MemoryLogBackend sdCard;
+extern MemoryLogBackend frameCard;
+extern FakeCameraDevice cameraDevice;
+extern MemoryStore recoveryStore;
+
+// 모든 비행 객체와 가짜 장치를 생성 직후 상태로 (저널 저장소는 유지 - 재시작 시험용)
+void flightReset();
+#endif
+
+#endif
@@ -0,0 +1,186 @@
+// include/HAL.h
+#ifndef HAL_H
+#define HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 얇은 하드웨어 추상화 계층 (시계, I2C, UART)
+// 보드에서는 Arduino/Teensy API로 바로 연결되고,
+// 호스트에서는 시뮬레이션 시계와 가짜 버스를 붙여서 같은 드라이버 코드를 실행
+
+// ---- 시계 ----
+#ifdef ARDUINO
+#include <Arduino.h>
+inline uint32_t halMicros() { return micros(); }
+inline uint32_t halMillis() { return millis(); }
+#else
+// 호스트: 시뮬레이션 시계 (실시간보다 빠르게 진행 가능)
+uint32_t halMicros();
+uint32_t halMillis();
+void halSetMicros(uint32_t now);
+void halAdvanceMicros(uint32_t delta);
+#endif
+
+// ---- 인터럽트 ----
+#ifdef ARDUINO
+inline void halNoInterrupts() { noInterrupts(); }
+inline void halInterrupts() { interrupts(); }
+#else
+// 호스트: 가짜 장치의 인터럽트 핸들러는 하네스가 같은 스레드에서 호출하므로 막을 필요 없음
+inline void halNoInterrupts() {}
+inline void halInterrupts() {}
+#endif
+
+// ---- 콘솔 ----
+#ifndef ARDUINO
+#define DEC 10
+#define HEX 16
+
+#define HOST_CONSOLE_INPUT_SIZE 256
+
+// 호스트: USB 콘솔(Serial) 대신 표준 출력 (드라이버 상태 메시지용)
+class HostConsole {
+private:
+    bool enabled;
+
+    // 수신 (지상 시험 콘솔 명령 주입)
+    char input[HOST_CONSOLE_INPUT_SIZE];
+    size_t inputHead;
+    size_t inputTail;
+
+    void printNumber(unsigned long long value, bool negative, int base);
+
+public:
+    HostConsole() : enabled(true), inputHead(0), inputTail(0) {}
+
+    // 시험/재생 중 출력 끄기
+    void setEnabled(bool on) { enabled = on; }
+
+    void print(const char* text);
+    void print(char c);
+    void print(int value, int base = DEC) { printNumber(value < 0 ? -(long long)value : value, value < 0, base); }
+    void print(unsigned int value, int base = DEC) { printNumber(value, false, base); }
+    void print(long value, int base = DEC) { printNumber(value < 0 ? -(long long)value : value, value < 0, base); }
+    void print(unsigned long value, int base = DEC) { printNumber(value, false, base); }
+    void print(double value, int digits = 2);
+
+    template <typename T> void println(T value) { print(value); print('\n'); }
+    template <typename T> void println(T value, int format) { print(value, format); print('\n'); }
+    void println() { print('\n'); }
+
+    size_t write(const uint8_t* data, size_t length);
+    int availableForWrite() { return 4096; }
+
+    int available() { return (int)(inputHead - inputTail); }
+    int read();
+
+    // 수신 쪽에 문자열 주입 (넘치는 부분은 버림)
+    void inject(const char* text);
+};
+
+extern HostConsole Serial;
+#endif
+
+// ---- I2C ----
+class I2CBus {
+protected:
+    // 버스 사용량 통계
+    uint32_t transactions;
+    uint32_t bytesTransferred;
+
+public:
+    I2CBus() : transactions(0), bytesTransferred(0) {}
+    virtual ~I2CBus() {}
+
+    virtual void begin(uint32_t clockHz) = 0;
+
+    // 레지스터 주소를 쓰고 (repeated start) length 바이트 읽기
+    virtual bool readRegisters(uint8_t address, uint8_t reg, uint8_t* buffer, size_t length) = 0;
+
+    // 레지스터 한 개 쓰기
+    virtual bool writeRegister(uint8_t address, uint8_t reg, uint8_t value) = 0;
+
+    uint32_t getTransactions() { return transactions; }
+    uint32_t getBytesTransferred() { return bytesTransferred; }
+    void resetCounters() { transactions = 0; bytesTransferred = 0; }
+
+    // 카운터 초기화 이후 버스 점유율 (바이트당 9클럭: 8비트 + ACK, 시작/정지 조건 제외)
+    float getUtilization(uint32_t clockHz, uint32_t elapsedUs) {
+        if (clockHz == 0 || elapsedUs == 0) return 0.0f;
+        return bytesTransferred * 9.0f * 1000000.0f / clockHz / elapsedUs;
+    }
+};
+
+// ---- UART ----
+class UartPort {
+public:
+    virtual ~UartPort() {}
+
+    virtual void begin(uint32_t baud) = 0;
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual size_t write(const uint8_t* data, size_t length) = 0;
+    virtual int availableForWrite() = 0;
+};
+
+#ifdef ARDUINO
+#include <Wire.h>
+
+// TwoWire 기반 I2C
+class WireBus : public I2CBus {
+private:
+    TwoWire& wire;
+
+public:
+    WireBus(TwoWire& w) : wire(w) {}
+
+    void begin(uint32_t clockHz) override;
+    bool readRegisters(uint8_t address, uint8_t reg, uint8_t* buffer, size_t length) override;
+    bool writeRegister(uint8_t address, uint8_t reg, uint8_t value) override;
+};
+
+// HardwareSerial 기반 UART
+class SerialPort : public UartPort {
+private:
+    HardwareSerial& serial;
+
+public:
+    SerialPort(HardwareSerial& s) : serial(s) {}
+
+    void begin(uint32_t baud) override { serial.begin(baud); }
+    int available() override { return serial.available(); }
+    int read() override { return serial.read(); }
+    size_t write(const uint8_t* data, size_t length) override { return serial.write(data, length); }
+    int availableForWrite() override { return serial.availableForWrite(); }
+};
+#else
+#define LOOPBACK_BUFFER_SIZE 2048
+
+// 호스트: 쓴 바이트가 그대로 읽히는 UART
+// 쓰기 예산으로 느린 링크(무선 모뎀 등)의 송신 속도를 흉내냄
+class LoopbackPort : public UartPort {
+private:
+    uint8_t buffer[LOOPBACK_BUFFER_SIZE];
+    size_t head;
+    size_t tail;
+    size_t writeBudget;          // 남은 송신 가능 바이트 (refill로 보충)
+
+public:
+    LoopbackPort() : head(0), tail(0), writeBudget(LOOPBACK_BUFFER_SIZE) {}
+
+    void begin(uint32_t baud) override { (void)baud; }
+    int available() override { return (int)(head - tail); }
+    int read() override;
+    size_t write(const uint8_t* data, size_t length) override;
+    int availableForWrite() override;
+
+    // 송신 예산 설정 (예: 1 ms 동안 115200 baud면 11바이트)
+    void refill(size_t budget) { writeBudget = budget; }
+
+    // 수신 쪽에 바이트 주입 (상대편 장치 응답)
+    void inject(const uint8_t* data, size_t length);
+};
+#endif
+
+#endif
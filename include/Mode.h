@@ -0,0 +1,70 @@
+// include/Mode.h
+#ifndef MODE_H
+#define MODE_H
+
+#include <stdint.h>
+#include "State.h"
+#include "Filter.h"
+#include "sensors/BMP390.h"
+#include "sensors/BNO085.h"
+#include "sensors/GPS.h"
+
+// 비행 단계별 센서 출력 주기 한 벌
+struct RateProfile {
+    const char* name;
+    uint32_t imuIntervalUs;      // BNO085 리포트 주기
+    uint8_t baroOdr;             // BMP390 ODR 레지스터 값
+    uint8_t baroPressureOsr;     // BMP390 OSR (압력)
+    uint8_t baroTemperatureOsr;  // BMP390 OSR (온도)
+    uint8_t gpsHz;               // GPS 갱신 주기
+
+    // BMP 태스크 폴링 주기 (ODR의 두 배 속도로 확인)
+    constexpr uint32_t baroPollUs() const { return bmp390OdrPeriodUs(baroOdr) / 2; }
+
+    // 기압 보정 한 번당 IMU 예측 횟수 (최소 1)
+    constexpr uint8_t predictsPerUpdate() const {
+        return bmp390OdrPeriodUs(baroOdr) > imuIntervalUs
+            ? (uint8_t)((bmp390OdrPeriodUs(baroOdr) + imuIntervalUs / 2) / imuIntervalUs) : 1;
+    }
+};
+
+// 비행 단계에 맞춰 센서 주기 전환
+// 발사대/착륙 후에는 낮은 주기로 전력과 CPU/I2C 사용을 줄이고, 상승~분리 구간은 최대 주기
+// 바뀐 장치는 update 호출마다 하나씩 설정 (한 번에 버스를 오래 잡지 않음)
+// 고도 필터의 고정 이득도 프로필마다 begin에서 미리 계산해 두고 함께 전환
+class Mode {
+private:
+    BMP390* bmp;
+    BNO085* imu;
+    GPS* gps;
+    Filter* filter;
+
+    FilterGain gains[FLIGHT_STATE_COUNT];
+
+    FlightState state;
+    const RateProfile* profile;
+    uint8_t pending;             // 아직 설정하지 않은 장치 (비트마스크)
+    uint32_t changes;
+
+    static const RateProfile PROFILES[FLIGHT_STATE_COUNT];
+
+    void applyNext();
+
+public:
+    Mode();
+
+    // 센서 연결 후 첫 단계 프로필 적용 시작 (재시작이면 복원한 단계)
+    // 필터 이득은 여기서 단계별로 계산 (부팅 시 한 번)
+    void begin(BMP390* bmp390, BNO085* bno085, GPS* gpsModule, Filter* altitudeFilter, FlightState initial);
+
+    // 비행 단계가 바뀌면 프로필 전환 시작 (전환이 시작되면 true), 대기 중인 장치 하나 설정
+    bool update(FlightState current);
+
+    const RateProfile& getProfile() const { return *profile; }
+    bool isApplied() const { return pending == 0; }
+    uint32_t getChangeCount() const { return changes; }
+
+    static const RateProfile& profileFor(FlightState state);
+};
+
+#endif
@@ -0,0 +1,54 @@
+// include/PID.h
+#ifndef PID_H
+#define PID_H
+
+#include <stdint.h>
+
+// 게인 한 벌 (연속 시간 기준)
+struct PIDGains {
+    float kp;
+    float ki;                // 1/s
+    float kd;                // s
+    float derivativeHz;      // 미분 저역통과 차단 주파수 (0 = 필터 없음)
+    float outMin;
+    float outMax;
+};
+
+// 고정 주기 이산 PID
+//   미분은 측정값 기준 (설정값 변화에 튀지 않음) + 1차 저역통과
+//   적분은 출력이 포화된 방향으로는 쌓지 않음 (조건부 적분 anti-windup)
+// dt가 고정이므로 configure에서 계수를 미리 계산해 update에는 곱셈/덧셈만 남김
+class PID {
+private:
+    // 미리 계산한 계수
+    float kp;
+    float kiDt;              // ki·dt
+    float dDecay;            // τ/(τ+dt)
+    float dGain;             // kd/(τ+dt)
+    float outMin;
+    float outMax;
+
+    // 상태
+    float integral;
+    float derivative;
+    float lastMeasurement;
+    float output;
+    bool primed;             // 이전 측정값이 있음
+
+public:
+    PID();
+
+    // 게인과 주기(s)로 계수 계산 (상태는 초기화)
+    void configure(const PIDGains& gains, float dt);
+
+    // 한 주기 (설정값, 측정값) -> 출력
+    float update(float setpoint, float measurement);
+
+    // 적분/미분 상태 초기화 (제어 재개 시)
+    void reset();
+
+    float getOutput() const { return output; }
+    float getIntegral() const { return integral; }
+};
+
+#endif
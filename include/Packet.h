@@ -2,47 +2,13 @@
 #ifndef PACKET_H
 #define PACKET_H
 
-#include <Arduino.h>
+#include "HAL.h"
 #include "sensors/BMP390.h"
 #include "sensors/BNO085.h"
 #include "sensors/GPS.h"
-
-// 패킷 데이터 구조체
-struct TelemetryPacket {
-    // 기본 정보
-    String teamId;
-    String missionTime;      // hh:mm:ss (UTC)
-    uint32_t packetCount;
-    char mode;               // 'F' or 'S'
-    String state;            // LAUNCH_PAD, ASCENT, etc.
-    
-    // BMP390 데이터
-    float altitude;          // m
-    float temperature;       // °C
-    float pressure;          // hPa
-    
-    // 전원 데이터
-    float voltage;           // V
-    float current;           // A
-    
-    // BNO085 데이터
-    float gyro_r;            // Roll (°)
-    float gyro_p;            // Pitch (°)
-    float gyro_y;            // Yaw (°)
-    float accel_r;           // Roll acceleration
-    float accel_p;           // Pitch acceleration
-    float accel_y;           // Yaw acceleration
-    
-    // GPS 데이터
-    String gpsTime;          // hh:mm:ss
-    float gpsAltitude;       // m
-    float gpsLatitude;       // degrees
-    float gpsLongitude;      // degrees
-    int gpsSats;             // satellite count
-    
-    // 명령어 에코
-    String cmdEcho;
-};
+#include "Telemetry.h"
+#include "TelemetryBinary.h"
+#include "XBee.h"
 
 class Packet {
 private:
@@ -51,22 +17,28 @@ private:
     BNO085* imu;
     GPS* gps;
     
+    // 무선 링크 (없으면 USB 콘솔만)
+    XBee* radio;
+    
     // 패킷 카운터
     uint32_t packetCount;
     
-    // 임시 상태 (나중에 State.h로 이동)
-    String currentState;
+    // 비행 상태 (StateMachine에서 갱신) / 모드
+    FlightState currentState;
     char currentMode;
-    String lastCommand;
+    char lastCommand[TELEMETRY_CMD_ECHO_LEN];
+    
+    // 전송 인코딩 (CSV / 바이너리)
+    TelemetryEncoding encoding;
     
     // 미션 시작 시간 (밀리초)
     unsigned long missionStartTime;
     
-    // CSV 문자열 생성 헬퍼
-    String formatCSV(const TelemetryPacket& packet);
+    // 전송 버퍼 (매 패킷 재사용)
+    char txBuffer[TELEMETRY_MAX_LEN];
     
     // 시간 포맷 헬퍼 (millis를 hh:mm:ss로 변환)
-    String formatMissionTime(unsigned long elapsedMillis);
+    void formatMissionTime(unsigned long elapsedMillis, char* out);
 
 public:
     Packet();
@@ -74,22 +46,42 @@ public:
     // 센서 연결
     void attachSensors(BMP390* bmp390, BNO085* bno085, GPS* gpsModule);
     
+    // 무선 링크 연결 (transmit이 프레임을 큐에 넣고 바로 반환)
+    void attachRadio(XBee* xbee) { radio = xbee; }
+    
     // 미션 시작 (타이머 시작)
     void beginMission();
     
-    // 패킷 데이터 수집 및 생성
-    TelemetryPacket collectData();
+    // 재시작 후 미션 이어서 진행 (카운터와 경과 시간 복원)
+    void resumeMission(uint32_t count, uint32_t elapsedMillis);
+    uint32_t getMissionElapsed();
+    
+    // 미션 시계 맞춤 (ST 명령, hh:mm:ss를 밀리초로)
+    void setMissionTime(uint32_t elapsedMillis) { missionStartTime = halMillis() - elapsedMillis; }
+    
+    // 패킷 데이터 수집 (호출자 구조체에 채움)
+    void collectData(TelemetryPacket& packet);
     
-    // CSV 문자열로 패킷 생성
-    String generatePacketString();
+    // CSV 문자열로 패킷 생성 (buffer에 기록, 길이 반환)
+    size_t generatePacketString(char* buffer, size_t size);
     
-    // 패킷 전송 (Serial)
+    // 바이너리 프레임 생성 (COBS + CRC, 구분자 포함 길이 반환)
+    size_t generatePacketBinary(uint8_t* buffer, size_t size);
+    
+    // 패킷 전송 (XBee 큐 + USB 콘솔 여유가 있을 때만, 현재 인코딩 사용)
     void transmit();
     
-    // 상태 설정 (임시 - 나중에 State 모듈로 대체)
-    void setState(String state) { currentState = state; }
+    // 인코딩 선택 (런타임)
+    void setEncoding(TelemetryEncoding enc) { encoding = enc; }
+    TelemetryEncoding getEncoding() { return encoding; }
+    
+    // 상태 설정
+    void setState(FlightState state) { currentState = state; }
     void setMode(char mode) { currentMode = mode; }
-    void setCommandEcho(String cmd) { lastCommand = cmd; }
+    void setCommandEcho(const char* cmd) { copyString(lastCommand, cmd, sizeof(lastCommand)); }
+    FlightState getState() { return currentState; }
+    char getMode() { return currentMode; }
+    const char* getCommandEcho() { return lastCommand; }
     
     // 카운터 접근
     uint32_t getPacketCount() { return packetCount; }
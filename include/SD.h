@@ -0,0 +1,213 @@
+// include/SD.h
+#ifndef SD_H
+#define SD_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 핑퐁 버퍼 크기 (섹터 배수), 두 개 사용
+#define LOG_SECTOR_SIZE     512
+#define LOG_BUFFER_SIZE     8192
+#define LOG_WRITE_CHUNK     2048     // service() 한 번에 쓰는 양 (4섹터)
+#define LOG_SYNC_INTERVAL   8        // 버퍼 N개 기록마다 sync (디렉터리 엔트리 갱신)
+#define LOG_SYNC_PERIOD_US  1000000  // 기록한 데이터가 있으면 최소 이 주기로 sync (전원 차단 대비)
+#define LOG_PREALLOCATE     (64UL * 1024 * 1024)   // 비행 한 번 분량 연속 할당
+
+#define LOG_GPS_MAX_LEN     96       // NMEA 문장 최대 길이 (82자 + 여유)
+
+#define LOG_PATH_MAX        24       // 기록 파일 이름 (8.3 + 여유)
+#define LOG_FILE_NUMBERS    1000     // 이름 뒤 세 자리 번호 (flight000.bin ~ flight999.bin)
+
+// 레코드 종류
+enum LogRecordType : uint8_t {
+    LOG_RECORD_IMU = 1,
+    LOG_RECORD_BARO = 2,
+    LOG_RECORD_GPS = 3,
+};
+
+// 레코드 헤더 (리틀엔디언, 패딩 없음) + payload length 바이트
+struct __attribute__((packed)) LogRecordHeader {
+    uint8_t type;
+    uint8_t length;          // payload 바이트 수
+    uint32_t timestamp;      // us (샘플 시각)
+};
+
+struct __attribute__((packed)) LogImuRecord {
+    float accelX, accelY, accelZ;                // m/s^2
+    float quatI, quatJ, quatK, quatReal;
+};
+
+struct __attribute__((packed)) LogBaroRecord {
+    float pressure;          // hPa
+    float temperature;       // °C
+    float altitude;          // m
+};
+
+// GPS 레코드 payload는 NMEA 문장 문자 그대로 (널 문자 없음)
+
+// 저장 장치 백엔드 (보드: SdFat SDIO, 호스트: 일반 파일)
+class LogBackend {
+public:
+    virtual ~LogBackend() {}
+
+    // 파일을 새로 만들고 preallocate 바이트를 연속 클러스터로 미리 할당
+    // 같은 이름의 파일이 이미 있으면 실패 (이전 기록을 덮어쓰지 않음)
+    virtual bool open(const char* path, uint32_t preallocate) = 0;
+    virtual bool exists(const char* path) = 0;
+    virtual size_t write(const uint8_t* data, size_t length) = 0;
+    virtual bool sync() = 0;
+    virtual void close() = 0;
+
+    // 카드가 이전 기록을 아직 처리 중 (이때 쓰면 그만큼 블로킹)
+    virtual bool isBusy() = 0;
+};
+
+// base + 세 자리 번호 + extension 중 아직 없는 첫 이름으로 새 파일 열기 (path에 이름 저장)
+bool openNextFree(LogBackend* backend, const char* base, const char* extension,
+                  uint32_t preallocate, char* path, size_t pathSize);
+
+#ifdef ARDUINO
+#include <SdFat.h>
+
+// Teensy 4.1 내장 SD 슬롯 (SDIO FIFO 모드)
+// 카드 마운트는 모든 인스턴스가 공유 (파일마다 인스턴스 하나)
+class SdFatBackend : public LogBackend {
+private:
+    static SdFs sd;
+    static bool mounted;
+    FsFile file;
+
+    static bool mount();
+
+public:
+    bool open(const char* path, uint32_t preallocate) override;
+    bool exists(const char* path) override;
+    size_t write(const uint8_t* data, size_t length) override;
+    bool sync() override;
+    void close() override;
+    bool isBusy() override;
+};
+#else
+#include <stdio.h>
+
+// 호스트: stdio 파일 (기록 결과를 디코더로 확인)
+class FileLogBackend : public LogBackend {
+private:
+    FILE* file;
+
+public:
+    FileLogBackend();
+    ~FileLogBackend();
+
+    bool open(const char* path, uint32_t preallocate) override;
+    bool exists(const char* path) override;
+    size_t write(const uint8_t* data, size_t length) override;
+    bool sync() override;
+    void close() override;
+    bool isBusy() override { return false; }
+};
+
+// 호스트: 메모리 파일 하나 (앞 capacity 바이트만 보관하고 나머지는 크기만 셈)
+// 연 적이 있는 이름은 닫은 뒤에도 있는 파일로 봄
+class MemoryLogBackend : public LogBackend {
+private:
+    uint8_t* storage;
+    size_t capacity;
+    uint64_t length;
+    bool opened;
+    char name[LOG_PATH_MAX];
+    uint32_t syncs;
+
+public:
+    MemoryLogBackend(uint8_t* buffer = nullptr, size_t size = 0);
+
+    bool open(const char* path, uint32_t preallocate) override;
+    bool exists(const char* path) override;
+    size_t write(const uint8_t* data, size_t size) override;
+    bool sync() override;
+    void close() override { opened = false; }
+    bool isBusy() override { return false; }
+
+    const uint8_t* getData() { return storage; }
+    uint64_t getLength() { return length; }
+    size_t getStoredLength() { return length < capacity ? (size_t)length : capacity; }
+    uint32_t getSyncCount() { return syncs; }
+    bool isOpen() { return opened; }
+};
+#endif
+
+// 고속 비행 기록기
+// 센서 태스크는 append만 하고 (메모리 복사만, 블로킹 없음),
+// 저우선 태스크의 service()가 가득 찬 버퍼를 섹터 정렬 청크로 나눠서 기록
+// 레코드는 버퍼 경계를 넘어 이어질 수 있으므로 기록은 항상 버퍼 전체 단위
+class SDLogger {
+private:
+    LogBackend* backend;
+    bool active;
+    char path[LOG_PATH_MAX];
+
+    // 핑퐁 버퍼 (한쪽을 채우는 동안 다른 쪽을 기록)
+    alignas(LOG_SECTOR_SIZE) uint8_t buffers[2][LOG_BUFFER_SIZE];
+    uint8_t fillIndex;           // 채우는 중인 버퍼
+    size_t fillLength;
+    bool pending[2];             // 가득 차서 기록 대기 중
+    uint8_t flushIndex;          // 다음에 기록할 버퍼
+    size_t flushOffset;          // 기록 중인 버퍼의 진행 위치
+
+    // 통계
+    uint32_t recordsWritten;
+    uint32_t recordsDropped;     // 두 버퍼가 모두 차서 버린 레코드
+    uint32_t buffersFlushed;
+    uint32_t writeErrors;
+    uint64_t bytesWritten;
+    uint32_t maxWriteMicros;     // 청크 한 번 기록 최대 시간
+    uint32_t busySkips;          // 카드가 바빠서 기록을 미룬 횟수
+
+    // 마지막 sync 이후 기록 여부 / 시각, 버퍼 N개를 채워 다음 service에서 sync할 차례
+    bool unsynced;
+    bool syncDue;
+    uint32_t lastSyncMicros;
+
+    // 레코드 하나를 버퍼에 복사 (공간이 없으면 false)
+    bool append(uint8_t type, uint32_t timestamp, const void* payload, uint8_t length);
+    void copyBytes(const uint8_t* data, size_t length);
+
+    // 다음 청크 기록 (기록 대기 버퍼가 없으면 false)
+    bool writeChunk();
+
+public:
+    SDLogger();
+
+    // 새 번호 파일 열기 (base000.ext부터 빈 이름), 실패하면 기록 없이 계속 (append는 무시됨)
+    bool begin(LogBackend* storage, const char* base, const char* extension);
+
+    // 샘플 기록 (센서 태스크에서 호출, 블로킹 없음)
+    bool logImu(uint32_t timestamp, const LogImuRecord& record);
+    bool logBaro(uint32_t timestamp, const LogBaroRecord& record);
+    bool logGps(uint32_t timestamp, const char* sentence);
+
+    // 기록 대기 버퍼가 있으면 청크 하나 기록 (저우선 태스크에서 주기 호출)
+    // 카드가 바쁘면 다음 호출로 미룸
+    void service();
+
+    // 남은 데이터 모두 기록 후 닫기 (착륙 후)
+    void end();
+
+    // 상태/통계
+    bool isActive() { return active; }
+    const char* getPath() { return path; }
+    uint32_t getRecordsWritten() { return recordsWritten; }
+    uint32_t getRecordsDropped() { return recordsDropped; }
+    uint32_t getBuffersFlushed() { return buffersFlushed; }
+    uint32_t getWriteErrors() { return writeErrors; }
+    uint64_t getBytesWritten() { return bytesWritten; }
+    uint32_t getMaxWriteMicros() { return maxWriteMicros; }
+    uint32_t getBusySkips() { return busySkips; }
+};
+
+// 기록 파일의 레코드 하나를 CSV 한 줄로 변환 (줄바꿈 제외)
+// 소비한 바이트 수 반환, 레코드가 잘렸거나 미기록 영역(종류 0)이면 0
+// 알 수 없는 종류는 빈 줄로 두고 헤더+payload만큼 건너뜀
+size_t decodeLogRecord(const uint8_t* data, size_t length, char* out, size_t outSize);
+
+#endif
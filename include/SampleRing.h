@@ -0,0 +1,106 @@
+// include/SampleRing.h
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// 타임스탬프가 붙은 센서 샘플
+template <typename T>
+struct Sample {
+    uint32_t timestamp;      // micros
+    T value;
+};
+
+// 단일 생산자 샘플 이력 링 (락프리)
+// 생산자(드라이버)는 push만 호출하고 가장 오래된 샘플을 덮어씀
+// 소비자는 읽기만 하며, 읽는 도중 덮어쓰인 슬롯은 다시 읽음 (시퀀스 검사)
+// N은 2의 거듭제곱
+template <typename T, uint32_t N>
+class SampleRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SampleRing size must be a power of two");
+
+private:
+    Sample<T> slots[N];
+    std::atomic<uint32_t> head;   // 지금까지 push된 개수
+
+    static const uint8_t MAX_RETRIES = 4;
+
+    // micros 오버플로를 고려한 시간 비교 (a가 b 이후인가)
+    static bool after(uint32_t a, uint32_t b) { return (int32_t)(a - b) > 0; }
+
+    // index번째 샘플 복사 후, 그 사이 덮어쓰였는지 확인
+    bool readSlot(uint32_t index, Sample<T>& out) const {
+        out = slots[index & (N - 1)];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // 생산자가 index + N - 1 까지 쓰기 시작하지 않았다면 유효
+        return head.load(std::memory_order_relaxed) - index < N;
+    }
+
+public:
+    SampleRing() : slots(), head(0) {}
+
+    // 생산자: 샘플 발행
+    void push(const T& value, uint32_t timestamp) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        Sample<T>& slot = slots[h & (N - 1)];
+        slot.timestamp = timestamp;
+        slot.value = value;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    // 가장 최근 샘플
+    bool latest(Sample<T>& out) const {
+        for (uint8_t retry = 0; retry < MAX_RETRIES; retry++) {
+            uint32_t h = head.load(std::memory_order_acquire);
+            if (h == 0) return false;
+            if (readSlot(h - 1, out)) return true;
+        }
+        return false;
+    }
+
+    // timestamp 이전(포함) 가장 최근 샘플 (없으면 false)
+    bool at(uint32_t timestamp, Sample<T>& out) const {
+        for (uint8_t retry = 0; retry < MAX_RETRIES; retry++) {
+            uint32_t h = head.load(std::memory_order_acquire);
+            uint32_t oldest = (h > N) ? h - N + 1 : 0;  // 덮어쓰는 중인 슬롯 하나 제외
+            bool torn = false;
+
+            for (uint32_t index = h; index > oldest; index--) {
+                if (!readSlot(index - 1, out)) { torn = true; break; }
+                if (!after(out.timestamp, timestamp)) return true;
+            }
+            if (!torn) return false;
+        }
+        return false;
+    }
+
+    // [from, to] 구간 샘플을 오래된 순서로 복사, 복사한 개수 반환
+    size_t range(uint32_t from, uint32_t to, Sample<T>* out, size_t maxCount) const {
+        uint32_t h = head.load(std::memory_order_acquire);
+        uint32_t oldest = (h > N) ? h - N + 1 : 0;
+        size_t count = 0;
+
+        for (uint32_t index = oldest; index < h && count < maxCount; index++) {
+            Sample<T> sample;
+            if (!readSlot(index, sample)) continue;  // 이미 덮어쓰인 오래된 샘플
+            if (after(from, sample.timestamp)) continue;
+            if (after(sample.timestamp, to)) break;
+            out[count++] = sample;
+        }
+        return count;
+    }
+
+    // 현재 보관 중인 샘플 수
+    uint32_t size() const {
+        uint32_t h = head.load(std::memory_order_acquire);
+        return (h > N) ? N : h;
+    }
+
+    // 발행된 총 샘플 수 (새 샘플 감지용 시퀀스)
+    uint32_t getSequence() const { return head.load(std::memory_order_acquire); }
+    uint32_t capacity() const { return N; }
+};
+
+#endif
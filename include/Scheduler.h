@@ -0,0 +1,94 @@
+// include/Scheduler.h
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SCHEDULER_MAX_TASKS 16
+
+typedef void (*TaskFunction)();
+typedef uint32_t (*ClockFunction)();    // us 단위 (보드에서는 micros)
+
+// 태스크 정의 (상수 테이블)
+struct TaskConfig {
+    const char* name;
+    TaskFunction function;
+    uint32_t periodUs;       // 0 = 연속 실행 (매 패스)
+    uint8_t priority;        // 작을수록 먼저
+    uint32_t deadlineUs;     // 예정 시각부터 완료까지 허용 시간 (0 = 주기)
+};
+
+// 태스크 실행 통계
+struct TaskStats {
+    uint32_t runs;
+    uint32_t overruns;       // 마감 초과 횟수
+    uint32_t skipped;        // 밀려서 건너뛴 주기 수
+    uint32_t lastExecUs;
+    uint32_t maxExecUs;
+    uint64_t totalExecUs;
+    uint32_t lastJitterUs;   // 예정 시각 대비 시작 지연
+    uint32_t maxJitterUs;
+};
+
+// 태스크 이름 비교 / 테이블에서 이름으로 위치 찾기 (없으면 count)
+// constexpr 테이블이면 컴파일 시간에 계산 (static_assert로 확인)
+constexpr bool taskNameEqual(const char* a, const char* b) {
+    return *a == *b && (*a == '\0' || taskNameEqual(a + 1, b + 1));
+}
+
+constexpr uint8_t taskIndex(const TaskConfig* table, uint8_t count, const char* name, uint8_t index = 0) {
+    return (index >= count || taskNameEqual(table[index].name, name)) ? index : taskIndex(table, count, name, index + 1);
+}
+
+// 고정 주기 협력형 스케줄러
+// 다음 실행 시각은 예정 시각 + 주기로 누적 (실행 시각 기준이 아니므로 드리프트 없음)
+class Scheduler {
+private:
+    const TaskConfig* tasks;
+    uint8_t taskCount;
+    ClockFunction clock;
+
+    uint32_t nextRun[SCHEDULER_MAX_TASKS];
+    uint32_t period[SCHEDULER_MAX_TASKS];   // 테이블 주기로 시작, setPeriod로 변경
+    TaskStats stats[SCHEDULER_MAX_TASKS];
+
+    // 우선순위 순서로 정렬한 인덱스
+    uint8_t order[SCHEDULER_MAX_TASKS];
+
+    // 루프 속도 측정
+    uint32_t passes;
+    uint32_t statsStart;
+
+    // 시간 비교 (micros 오버플로 대응)
+    static bool reached(uint32_t now, uint32_t target) { return (int32_t)(now - target) >= 0; }
+
+    void execute(uint8_t index, uint32_t scheduled);
+
+public:
+    Scheduler(ClockFunction clockFn);
+
+    // 태스크 테이블 등록, 모든 주기 태스크의 첫 실행 시각은 start
+    bool begin(const TaskConfig* table, uint8_t count, uint32_t start);
+    bool begin(const TaskConfig* table, uint8_t count) { return begin(table, count, clock()); }
+
+    // 한 패스 실행: 기한이 된 주기 태스크 중 우선순위가 가장 높은 것 하나 + 연속 태스크 전부
+    // 주기 태스크를 실행했으면 true
+    bool runOnce();
+
+    // 주기 태스크의 주기 변경 (다음 예정 시각부터 적용, 연속 태스크는 변경 불가)
+    bool setPeriod(uint8_t index, uint32_t periodUs);
+    uint32_t getPeriod(uint8_t index) { return period[index]; }
+
+    // 통계 접근
+    uint8_t getTaskCount() { return taskCount; }
+    const TaskConfig& getTask(uint8_t index) { return tasks[index]; }
+    const TaskStats& getStats(uint8_t index) { return stats[index]; }
+    uint32_t getNextRun(uint8_t index) { return nextRun[index]; }
+    uint32_t getPassCount() { return passes; }
+    float getLoopRate();      // 통계 초기화 이후 초당 패스 수
+    float getCpuLoad();       // 통계 초기화 이후 태스크 실행 시간 비율 (0~1)
+    void resetStats();
+};
+
+#endif
@@ -0,0 +1,58 @@
+// include/Servo.h
+#ifndef SERVO_DRIVER_H
+#define SERVO_DRIVER_H
+
+#include <stdint.h>
+#include "HAL.h"
+
+// 서보 PWM (기본 50 Hz, 펄스 폭 us)
+#define SERVO_PWM_HZ       50       // 아날로그 서보 표준 (디지털 서보는 200~333 Hz까지 가능)
+#define SERVO_MIN_US       1000
+#define SERVO_CENTER_US    1500
+#define SERVO_MAX_US       2000
+
+// 하드웨어 PWM 서보 출력
+// begin에서 analogWrite로 핀 먹스/주파수를 한 번 설정한 뒤,
+// 이후에는 FlexPWM 비교 레지스터에 펄스 폭만 직접 씀 (analogWrite 핀 테이블 탐색/나눗셈 없음)
+// 새 값은 다음 PWM 주기 시작에 반영 (LDOK)
+// 호스트: 마지막 펄스 폭만 기록
+class ServoDriver {
+private:
+    uint8_t pin;
+    uint16_t minUs;
+    uint16_t maxUs;
+    uint16_t pulseUs;
+    uint32_t periodUs;              // PWM 주기 (begin의 주파수)
+
+    // 위치(-1~1) -> 펄스 폭
+    float centerUs;
+    float halfRangeUs;
+
+#ifdef ARDUINO
+    volatile uint16_t* compare;     // 하강 시점 비교 레지스터 (VAL3 = A, VAL5 = B)
+    volatile uint16_t* control;     // MCTRL
+    uint16_t loadMask;              // LDOK 비트 (서브모듈)
+    uint32_t countsPerUsQ16;        // us -> 카운터 값 (Q16)
+#endif
+
+public:
+    ServoDriver();
+
+    // FlexPWM A/B 핀만 지원 (2, 3, 4, 5, 6, 9, 22, 23, 33), 아니면 false
+    // 같은 서브모듈을 쓰는 핀(2/3, 6/9, 4/33)은 주파수가 같이 바뀜
+    // 50 Hz보다 높은 주파수는 디지털 서보에서만 (아날로그 서보는 과열/떨림)
+    bool begin(uint8_t outputPin, uint16_t frequencyHz = SERVO_PWM_HZ,
+               uint16_t minPulse = SERVO_MIN_US, uint16_t maxPulse = SERVO_MAX_US);
+
+    // 펄스 폭 (범위 밖이면 잘라냄)
+    void writeMicroseconds(uint16_t us);
+
+    // 정규화 위치 (-1 = min, 0 = 중앙, 1 = max)
+    void write(float position);
+
+    uint16_t getPulse() const { return pulseUs; }
+    uint8_t getPin() const { return pin; }
+    uint32_t getPeriodUs() const { return periodUs; }
+};
+
+#endif
@@ -0,0 +1,55 @@
+// include/SpscRing.h
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+// 단일 생산자/단일 소비자 락프리 링 버퍼
+// 생산자(ISR 또는 드라이버)는 push만, 소비자는 pop만 호출
+// N은 2의 거듭제곱 (인덱스 마스킹)
+template <typename T, uint32_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+private:
+    T items[N];
+    std::atomic<uint32_t> head;   // 생산자가 증가
+    std::atomic<uint32_t> tail;   // 소비자가 증가
+    uint32_t dropped;             // 가득 차서 버린 개수 (생산자 전용)
+
+public:
+    SpscRing() : head(0), tail(0), dropped(0) {}
+
+    // 생산자: 가득 차면 버리고 false
+    bool push(const T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N) {
+            dropped++;
+            return false;
+        }
+        items[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 소비자: 비어 있으면 false
+    bool pop(T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    uint32_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    uint32_t capacity() const { return N; }
+    uint32_t getDropped() const { return dropped; }
+};
+
+#endif
@@ -0,0 +1,111 @@
+// include/State.h
+#ifndef STATE_H
+#define STATE_H
+
+#include <stdint.h>
+
+// 비행 상태 (순서대로만 진행, 값은 바이너리 텔레메트리 3비트 필드로 전송)
+enum FlightState : uint8_t {
+    STATE_LAUNCH_PAD = 0,
+    STATE_ASCENT,
+    STATE_APOGEE,
+    STATE_DESCENT,
+    STATE_PROBE_RELEASE,
+    STATE_LANDED,
+    FLIGHT_STATE_COUNT
+};
+
+// 상태 이름 (정적 문자열, 패킷 생성 시 복사 없음)
+constexpr const char* FLIGHT_STATE_NAMES[FLIGHT_STATE_COUNT] = {
+    "LAUNCH_PAD", "ASCENT", "APOGEE", "DESCENT", "PROBE_RELEASE", "LANDED"
+};
+
+constexpr const char* stateName(FlightState state) {
+    return state < FLIGHT_STATE_COUNT ? FLIGHT_STATE_NAMES[state] : "UNKNOWN";
+}
+
+// 전이 판정 기본값 (필터 출력 기준, 유지 시간은 샘플 시각 기준이라 BMP 주기와 무관)
+#define STATE_LAUNCH_ALTITUDE      10.0f    // m
+#define STATE_LAUNCH_VELOCITY      5.0f     // m/s
+#define STATE_LAUNCH_US            100000   // 100 ms
+#define STATE_APOGEE_DROP          2.0f     // m (최고 고도 대비 하강)
+#define STATE_APOGEE_US            200000   // 200 ms
+#define STATE_DESCENT_VELOCITY     -2.0f    // m/s
+#define STATE_DESCENT_US           100000
+#define STATE_RELEASE_ALTITUDE     100.0f   // m (지상 기준)
+#define STATE_RELEASE_US           100000
+#define STATE_LANDED_VELOCITY      0.5f     // m/s
+#define STATE_LANDED_BAND          1.0f     // m (창 안의 고도 변화 허용폭)
+#define STATE_LANDED_US            2000000  // 2 s
+
+// 조건이 유지된 시간을 재는 디바운서 (처음 참이 된 샘플부터, micros 오버플로 안전)
+struct Debounce {
+    uint32_t since;          // 조건이 처음 참이 된 샘플 시각 (us)
+    uint32_t requiredUs;
+    bool active;
+
+    void reset() { active = false; }
+    bool update(bool condition, uint32_t timestamp) {
+        if (!condition) { active = false; return false; }
+        if (!active) { active = true; since = timestamp; }
+        return timestamp - since >= requiredUs;
+    }
+};
+
+// 필터 고도/속도로 구동하는 비행 상태 기계
+// 현재 상태의 판정기 하나만 실행하므로 샘플당 작업량은 상태와 무관하게 일정
+class StateMachine {
+private:
+    FlightState state;
+    uint32_t samples;                            // 받은 샘플 수
+    uint32_t transitionSample[FLIGHT_STATE_COUNT];   // 각 상태에 들어온 샘플 번호 (미진입 0)
+
+    float maxAltitude;
+    float releaseAltitude;
+
+    Debounce launch;
+    Debounce apogee;
+    Debounce descent;
+    Debounce release;
+    Debounce landed;
+    float landedAnchor;                          // 착지 판정 창의 기준 고도
+
+    uint32_t timestamp;                          // 현재 샘플 시각 (us)
+
+    // 상태별 판정기 (다음 상태로 넘어가야 하면 true)
+    bool detectLaunch(float altitude, float velocity);
+    bool detectApogee(float altitude, float velocity);
+    bool detectDescent(float altitude, float velocity);
+    bool detectRelease(float altitude, float velocity);
+    bool detectLanded(float altitude, float velocity);
+    bool detectNone(float altitude, float velocity);
+
+    typedef bool (StateMachine::*Detector)(float altitude, float velocity);
+    static const Detector DETECTORS[FLIGHT_STATE_COUNT];
+
+    void enter(FlightState next);
+
+public:
+    StateMachine();
+
+    // 발사대 상태로 초기화
+    void reset();
+
+    // 새 필터 샘플 (지상 기준 고도 m, 수직 속도 m/s, 기압 샘플 시각 us), 현재 상태 반환
+    FlightState update(float altitude, float velocity, uint32_t sampleMicros);
+
+    // 상태 강제 설정 (명령/복구용, 판정기 초기화)
+    void setState(FlightState next);
+
+    // 프로브 분리 고도 (m)
+    void setReleaseAltitude(float altitude) { releaseAltitude = altitude; }
+
+    // 상태 접근
+    FlightState getState() { return state; }
+    const char* getStateName() { return stateName(state); }
+    float getMaxAltitude() { return maxAltitude; }
+    uint32_t getSampleCount() { return samples; }
+    uint32_t getTransitionSample(FlightState s) { return transitionSample[s]; }
+};
+
+#endif
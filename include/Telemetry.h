@@ -0,0 +1,92 @@
+// include/Telemetry.h
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "State.h"
+
+#define TEAM_ID "1062"
+
+// 고정 길이 필드 크기 (널 문자 포함)
+#define TELEMETRY_TEAM_ID_LEN   8
+#define TELEMETRY_TIME_LEN      9    // hh:mm:ss
+#define TELEMETRY_CMD_ECHO_LEN  32
+
+// CSV 한 줄 최대 길이 (모든 필드 최대폭 기준 여유 포함)
+#define TELEMETRY_MAX_LEN       320
+
+// 패킷 데이터 구조체 (힙 할당 없음)
+struct TelemetryPacket {
+    // 기본 정보
+    char teamId[TELEMETRY_TEAM_ID_LEN];
+    char missionTime[TELEMETRY_TIME_LEN];   // hh:mm:ss (UTC)
+    uint32_t packetCount;
+    char mode;                              // 'F' or 'S'
+    FlightState state;                      // LAUNCH_PAD, ASCENT, etc.
+
+    // BMP390 데이터
+    float altitude;          // m
+    float temperature;       // °C
+    float pressure;          // hPa
+
+    // 전원 데이터
+    float voltage;           // V
+    float current;           // A
+
+    // BNO085 데이터
+    float gyro_r;            // Roll (°)
+    float gyro_p;            // Pitch (°)
+    float gyro_y;            // Yaw (°)
+    float accel_r;           // Roll acceleration
+    float accel_p;           // Pitch acceleration
+    float accel_y;           // Yaw acceleration
+
+    // GPS 데이터
+    char gpsTime[TELEMETRY_TIME_LEN];       // hh:mm:ss
+    float gpsAltitude;       // m
+    float gpsLatitude;       // degrees
+    float gpsLongitude;      // degrees
+    int gpsSats;             // satellite count
+
+    // 명령어 에코
+    char cmdEcho[TELEMETRY_CMD_ECHO_LEN];
+};
+
+// 호출자가 준 버퍼에 직접 쓰는 고정 용량 CSV 작성기
+// 용량을 넘으면 잘라내고 overflow 플래그만 세움 (항상 널 종료)
+class CSVWriter {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    bool overflow;
+
+public:
+    CSVWriter(char* buf, size_t size);
+
+    void appendChar(char c);
+    void appendString(const char* str);
+    void appendUInt(uint32_t value);
+    void appendInt(int32_t value);
+
+    // 고정소수점 실수 출력 (String(float, n)과 같은 반올림, 최대 소수점 9자리)
+    void appendFloat(float value, uint8_t decimals);
+
+    // 필드 구분자
+    void separator() { appendChar(','); }
+
+    size_t size() const { return length; }
+    bool overflowed() const { return overflow; }
+};
+
+// 패킷을 CSV 한 줄로 변환 (줄바꿈 제외), 쓴 바이트 수 반환
+size_t formatTelemetryCSV(const TelemetryPacket& packet, char* buffer, size_t size);
+
+// 시/분/초를 hh:mm:ss 로 변환 (out은 TELEMETRY_TIME_LEN 이상)
+void formatClockTime(char* out, uint8_t hours, uint8_t minutes, uint8_t seconds);
+
+// 널 종료를 보장하는 문자열 복사
+void copyString(char* dest, const char* src, size_t size);
+
+#endif
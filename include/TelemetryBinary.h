@@ -0,0 +1,75 @@
+// include/TelemetryBinary.h
+#ifndef TELEMETRY_BINARY_H
+#define TELEMETRY_BINARY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Telemetry.h"
+
+// 바이너리 프레임 형식
+//   [COBS( payload | CRC16 )] 0x00
+// payload (리틀 엔디언, 고정소수점 양자화)
+//   u8  header        상위 4비트 버전, bit3 모드(1='S'), bit2..0 상태 인덱스
+//   u24 packetCount
+//   u24 missionTime   초 단위
+//   i24 altitude      0.01 m
+//   i16 temperature   0.01 °C
+//   u24 pressure      0.01 hPa
+//   u16 voltage       0.01 V
+//   i16 current       0.01 A
+//   i16 gyro r/p/y    0.01 ° (자세각 roll/pitch/yaw, ±180 °)
+//   i16 accel r/p/y   0.01 m/s²
+//   u24 gpsTime       초 단위
+//   i24 gpsAltitude   0.01 m
+//   i32 lat/lon       1e-7 °
+//   u8  gpsSats
+//   u8  cmdEcho 길이 + 문자열 (널 제외)
+#define TELEMETRY_BINARY_VERSION      3     // 3: 자이로 = 자세각 0.01 ° (2는 각속도 0.1 °/s)
+
+#define TELEMETRY_BINARY_FIXED_LEN    47
+#define TELEMETRY_BINARY_MAX_PAYLOAD  (TELEMETRY_BINARY_FIXED_LEN + TELEMETRY_CMD_ECHO_LEN)
+
+// CRC 2바이트 + COBS 오버헤드 + 구분자 0x00
+#define TELEMETRY_BINARY_MAX_FRAME    (TELEMETRY_BINARY_MAX_PAYLOAD + 2 + 2 + 1)
+
+// 텔레메트리 인코딩 방식 (런타임 선택)
+enum TelemetryEncoding {
+    ENCODING_CSV,
+    ENCODING_BINARY
+};
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+uint16_t crc16(const uint8_t* data, size_t length);
+
+// COBS 인코딩/디코딩 (0x00 없는 출력, 구분자는 포함하지 않음)
+// 디코딩 실패 시 0 반환
+size_t cobsEncode(const uint8_t* input, size_t length, uint8_t* output);
+size_t cobsDecode(const uint8_t* input, size_t length, uint8_t* output);
+
+// 패킷을 완성된 프레임(구분자 포함)으로 인코딩, 프레임 길이 반환 (공간 부족 시 0)
+size_t encodeTelemetryBinary(const TelemetryPacket& packet, uint8_t* frame, size_t size);
+
+// 구분자를 제외한 프레임 하나를 디코딩 (버전/CRC 불일치 시 false)
+bool decodeTelemetryBinary(const uint8_t* frame, size_t length, TelemetryPacket& packet);
+
+// 바이트 스트림에서 0x00 구분자로 프레임을 잘라내는 수신기 (지상국용)
+class BinaryFrameReader {
+private:
+    uint8_t buffer[TELEMETRY_BINARY_MAX_FRAME];
+    size_t length;
+    bool overflow;
+
+    uint32_t framesDecoded;
+    uint32_t framesRejected;
+
+public:
+    BinaryFrameReader();
+
+    // 한 바이트 입력, 유효한 패킷이 완성되면 true
+    bool push(uint8_t byte, TelemetryPacket& packet);
+
+    uint32_t getFramesDecoded() { return framesDecoded; }
+    uint32_t getFramesRejected() { return framesRejected; }
+};
+
+#endif
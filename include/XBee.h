@@ -0,0 +1,129 @@
+// include/XBee.h
+#ifndef XBEE_H
+#define XBEE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "HAL.h"
+
+// API 모드 2 (이스케이프) 프레임
+#define XBEE_START              0x7E
+#define XBEE_ESCAPE             0x7D
+#define XBEE_XOR                0x20
+
+#define XBEE_FRAME_TX_REQUEST   0x10
+#define XBEE_FRAME_TX_STATUS    0x8B
+#define XBEE_FRAME_RX_PACKET    0x90
+
+#define XBEE_BAUD               115200
+#define XBEE_BROADCAST          0x000000000000FFFFULL
+#define XBEE_TX_OVERHEAD        14      // 프레임 타입 ~ 옵션 (TX Request)
+// 프레임 하나의 RF 데이터 최대 = 모듈 NP (XBee 3 브로드캐스트, 암호화 없음: 84 B)
+// 더 긴 데이터는 send()가 여러 프레임으로 나눔 (지상국은 줄바꿈/COBS 구분자로 다시 이어 붙임)
+#define XBEE_MAX_PAYLOAD        84
+#define XBEE_MAX_FRAME          (XBEE_MAX_PAYLOAD + XBEE_TX_OVERHEAD + 4)   // 시작/길이/체크섬 포함
+#define XBEE_RX_MAX_FRAME       128
+#define XBEE_QUEUE_DEPTH        8       // 우선순위별 대기 프레임 수 (2의 거듭제곱)
+#define XBEE_MAX_SEND           (XBEE_MAX_PAYLOAD * (XBEE_QUEUE_DEPTH / 2))   // send() 한 번 최대 길이
+
+// 송신 우선순위 (작을수록 먼저)
+enum XBeePriority : uint8_t {
+    XBEE_PRIORITY_HIGH = 0,     // 명령 응답
+    XBEE_PRIORITY_NORMAL,       // 텔레메트리
+    XBEE_PRIORITY_COUNT
+};
+
+// 이스케이프 전 API 프레임 (시작 바이트부터 체크섬까지)
+struct XBeeFrame {
+    uint16_t length;
+    uint8_t data[XBEE_MAX_FRAME];
+};
+
+// 수신 데이터 전달 (RX Packet의 RF 데이터)
+typedef void (*XBeeReceiveHandler)(const uint8_t* data, size_t length);
+
+// XBee API 모드 드라이버
+// send()는 프레임을 만들어 큐에 넣기만 하고 바로 반환,
+// service()가 UART 송신 버퍼에 들어가는 만큼만 이스케이프해서 밀어 넣음 (UART TX는 인터럽트 구동)
+class XBee {
+private:
+    UartPort* port;
+    uint64_t destination;
+
+    // 우선순위별 고정 크기 링 (가득 차면 가장 오래된 프레임을 버림)
+    XBeeFrame queue[XBEE_PRIORITY_COUNT][XBEE_QUEUE_DEPTH];
+    uint8_t head[XBEE_PRIORITY_COUNT];
+    uint8_t tail[XBEE_PRIORITY_COUNT];
+
+    // 송신 중인 프레임
+    const XBeeFrame* sending;
+    uint8_t sendingPriority;
+    uint16_t sendOffset;
+    bool pendingEscape;          // 이스케이프 두 번째 바이트가 아직 안 나감
+
+    uint8_t nextFrameId;
+
+    // 수신 파서
+    uint8_t rxFrame[XBEE_RX_MAX_FRAME];
+    uint16_t rxLength;
+    uint16_t rxIndex;
+    uint8_t rxState;
+    uint8_t rxChecksum;
+    bool rxEscape;
+    XBeeReceiveHandler receiveHandler;
+
+    // 통계
+    uint32_t framesQueued;
+    uint32_t framesSent;
+    uint32_t framesDropped;
+    uint32_t bytesSent;          // UART로 나간 바이트 (이스케이프 포함)
+    uint32_t txDelivered;        // TX Status 성공
+    uint32_t txFailed;           // TX Status 실패 (재시도 초과, 경로 없음 등)
+    uint32_t rxErrors;           // 체크섬/길이 오류
+    uint8_t maxDepth;
+
+    static bool needsEscape(uint8_t byte) {
+        return byte == XBEE_START || byte == XBEE_ESCAPE || byte == 0x11 || byte == 0x13;
+    }
+
+    // 프레임 하나 (NP 이하) 큐에 넣기
+    bool enqueue(const uint8_t* data, size_t length, uint8_t priority);
+
+    // 송신 중인 프레임의 다음 UART 바이트 (이스케이프 포함), 프레임 끝이면 false
+    bool nextTxByte(uint16_t& offset, bool& escape, uint8_t& byte);
+
+    void pumpTx();
+    void pumpRx();
+    void handleFrame();
+
+public:
+    XBee(UartPort* uart);
+
+    void begin(uint32_t baud);
+
+    // 목적지 64비트 주소 (기본: 브로드캐스트)
+    void setDestination(uint64_t address) { destination = address; }
+
+    // RF 데이터를 NP 단위 TX Request 프레임으로 나눠 큐에 넣음 (XBEE_MAX_SEND 초과면 false)
+    bool send(const uint8_t* data, size_t length, XBeePriority priority = XBEE_PRIORITY_NORMAL);
+
+    // 송신 큐를 UART로 밀어 넣고 수신 프레임 처리 (루프에서 자주 호출)
+    void service();
+
+    // 수신 콜백 등록 (지상국 명령 등)
+    void setReceiveHandler(XBeeReceiveHandler handler) { receiveHandler = handler; }
+
+    // 통계
+    uint8_t getQueueDepth();
+    uint8_t getMaxQueueDepth() { return maxDepth; }
+    uint32_t getFramesQueued() { return framesQueued; }
+    uint32_t getFramesSent() { return framesSent; }
+    uint32_t getFramesDropped() { return framesDropped; }
+    uint32_t getBytesSent() { return bytesSent; }
+    uint32_t getDelivered() { return txDelivered; }
+    uint32_t getFailed() { return txFailed; }
+    uint32_t getOutstanding() { return framesSent - txDelivered - txFailed; }   // 응답 대기 중
+    uint32_t getRxErrors() { return rxErrors; }
+};
+
+#endif
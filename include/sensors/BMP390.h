@@ -2,36 +2,234 @@
 #ifndef BMP390_H
 #define BMP390_H
 
-#include <Arduino.h>
-#include <Wire.h>
-#include <Adafruit_BMP3XX.h>
+#include <string.h>
+#include "HAL.h"
+#include "SampleRing.h"
+#include "Altitude.h"
+#include "Boot.h"
+#include "sensors/PressureSource.h"
 
+#define BMP390_ADDRESS 0x77
+
+// 레지스터 맵
+#define BMP390_REG_CHIP_ID   0x00
+#define BMP390_REG_ERR       0x02
+#define BMP390_REG_STATUS    0x03   // 0x03~0x09: STATUS + 압력/온도 데이터 (연속 읽기)
+#define BMP390_REG_PWR_CTRL  0x1B
+#define BMP390_REG_OSR       0x1C
+#define BMP390_REG_ODR       0x1D
+#define BMP390_REG_CONFIG    0x1F
+#define BMP390_REG_CALIB     0x31   // 0x31~0x45 보정 계수 21바이트
+#define BMP390_REG_CMD       0x7E
+
+#define BMP390_CHIP_ID       0x60
+#define BMP390_CMD_SOFTRESET 0xB6
+#define BMP390_RESET_WAIT_US 5000    // 소프트 리셋 후 NVM 로드 시간
+
+#define BMP390_STATUS_DRDY_PRESS 0x20
+#define BMP390_STATUS_DRDY_TEMP  0x40
+
+// PWR_CTRL: 압력/온도 활성 + normal 모드 / sleep 모드
+#define BMP390_PWR_NORMAL    0x33
+#define BMP390_PWR_SLEEP     0x03
+
+// 오버샘플링 (OSR 레지스터 값)
+#define BMP390_OSR_1X  0
+#define BMP390_OSR_2X  1
+#define BMP390_OSR_4X  2
+#define BMP390_OSR_8X  3
+#define BMP390_OSR_16X 4
+#define BMP390_OSR_32X 5
+
+// 출력 주기 (ODR 레지스터 값)
+#define BMP390_ODR_200_HZ 0x00
+#define BMP390_ODR_100_HZ 0x01
+#define BMP390_ODR_50_HZ  0x02
+#define BMP390_ODR_25_HZ  0x03
+#define BMP390_ODR_12P5_HZ 0x04
+
+// ODR 레지스터 값 -> 샘플 주기 (us), 200 Hz에서 한 단계마다 두 배
+constexpr uint32_t bmp390OdrPeriodUs(uint8_t odr) { return 5000UL << odr; }
+
+// IIR 필터 계수 (CONFIG 레지스터 값, 1비트 시프트 전)
+#define BMP390_IIR_COEFF_3 2
+
+// 샘플 이력 크기 (50Hz 기준 약 0.6초)
+#define BMP390_SAMPLE_RING_SIZE 32
+
+// 한 번의 변환 결과
+struct BaroSample {
+    float pressure;          // hPa
+    float temperature;       // °C
+    float altitude;          // m (기준 기압 대비)
+};
+
+// NVM 보정 계수 (데이터시트 스케일 적용 후)
+struct BMP390Calibration {
+    double t1, t2, t3;
+    double p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11;
+};
+
+// NVM 보정 계수 21바이트 (0x31~0x45) -> 데이터시트 스케일
+void bmp390ParseCalibration(const uint8_t* raw, BMP390Calibration& out);
+
+// 원시값 보정 (데이터시트 부동소수점 식), 온도 °C / 기압 Pa
+double bmp390CompensateTemperature(const BMP390Calibration& calib, uint32_t raw);
+double bmp390CompensatePressure(const BMP390Calibration& calib, uint32_t raw, double tempC);
+
+// BMP390 레지스터 직접 제어 드라이버
+// normal 모드로 설정된 ODR마다 센서가 스스로 변환하고,
+// update()는 STATUS의 data-ready만 확인해서 새 샘플일 때만 보정 계산
+// 기압 공급원을 붙이면 센서 대신 그 값을 같은 고도/샘플/캘리브레이션 경로로 처리 (시뮬레이션 모드)
 class BMP390 {
 private:
-    Adafruit_BMP3XX bmp;
-    float baseAltitude;
+    I2CBus* bus;
+    BMP390Calibration calib;
     bool initialized;
+    
+    // 외부 기압 공급원 (nullptr이면 센서)
+    PressureSource* source;
+    
+    // 단계별 초기화 진행 상태
+    enum InitPhase : uint8_t { PHASE_PROBE, PHASE_RESET_WAIT };
+    InitPhase initPhase;
+    uint32_t initWaitUntil;
+
+    // 출력 주기/오버샘플링 (레지스터 값)
+    uint8_t odr;
+    uint8_t pressureOsr;
+    uint8_t temperatureOsr;
+
+    // 기압 -> 고도 (기준: 해수면, 캘리브레이션 후 지상 기압)
+    AltitudeConverter altitudeModel;
+
+    // 마지막 샘플 (새 샘플마다 한 번만 계산)
+    float pressure;          // hPa
+    float temperature;       // °C
+    float altitude;          // m
+    bool hasSample;
+
+    // 비블로킹 캘리브레이션 누적
+    int calibrationTarget;
+    int calibrationCount;
+    double calibrationSum;       // 기압 합 (hPa)
+
+    // 타임스탬프 샘플 이력
+    SampleRing<BaroSample, BMP390_SAMPLE_RING_SIZE> samples;
+
+    // 레지스터 접근
+    bool readRegisters(uint8_t reg, uint8_t* buffer, uint8_t length);
+    bool writeRegister(uint8_t reg, uint8_t value);
+
+    bool readCalibration();
+
+    // sleep -> OSR/ODR -> normal (설정은 sleep 모드에서만 바꿀 수 있음), ERR 레지스터 반환
+    uint8_t applyRate();
+
+    // 센서에서 새 변환 결과 읽기 (data-ready일 때만 true)
+    bool readSensor(PressureReading& out);
+
+    // 기압 한 건을 고도로 바꿔 이력에 넣고 캘리브레이션 누적
+    void process(const PressureReading& reading);
 
 public:
-    BMP390();
-    
-    // 초기화 (Wire 사용 - 핀 18/19)
+    BMP390(I2CBus* i2c);
+
+    // 초기화 (보드: Wire - 핀 18/19), 끝날 때까지 beginStep 반복
     bool begin();
     
-    // 센서 데이터 읽기
+    // 재개 가능한 초기화 한 단계 (리셋 대기 중에는 바로 반환)
+    InitStatus beginStep();
+
+    // 출력 주기/오버샘플링 변경 (대기 없이 레지스터 4개만 씀, 초기화 전이면 begin에서 적용)
+    // 변환 시간이 ODR 주기 안에 들어가야 함 (예: 100 Hz는 압력 2x + 온도 1x까지)
+    bool configureRate(uint8_t odrValue, uint8_t pressureOversampling, uint8_t temperatureOversampling);
+    uint8_t getOdr() { return odr; }
+
+    // 새 샘플이 있으면 읽어서 true (변환을 기다리지 않음, 공급원에 쌓인 값은 모두 처리)
     bool update();
-    
-    // 데이터 접근
+
+    // 기압 공급원 교체 (nullptr이면 센서로 복귀)
+    void setSource(PressureSource* pressureSource) { source = pressureSource; }
+    PressureSource* getSource() { return source; }
+
+    // 데이터 접근 (마지막 샘플)
     float getTemperature();      // 온도 (°C)
     float getPressure();         // 기압 (hPa)
-    float getAltitude();         // 고도 (m)
-    float getRelativeAltitude(); // 상대 고도 (m)
-    
-    // 고도 캘리브레이션
-    void calibrateAltitude(int samples = 100);
-    
+    float getAltitude();         // 기준 기압 대비 고도 (m)
+
+    // 고도 캘리브레이션 시작 (이후 update()에서 기압을 평균해 지상 기준으로 설정)
+    void calibrateAltitude(int sampleCount = 100);
+    bool isCalibrating() { return calibrationTarget > 0; }
+
+    // 기준 기압 (hPa)
+    float getGroundPressure() { return altitudeModel.getReference(); }
+    void setGroundPressure(float pressureHpa) { altitudeModel.setReference(pressureHpa); }
+
     // 상태 확인
     bool isInitialized() { return initialized; }
+    bool isActive() { return initialized || source != nullptr; }   // 샘플을 낼 수 있는 상태
+
+    // 샘플 이력 (최신/시점/구간 조회)
+    const SampleRing<BaroSample, BMP390_SAMPLE_RING_SIZE>& getSamples() { return samples; }
+};
+
+#ifndef ARDUINO
+#define BMP390_ERR_CONF      0x04   // ERR: 변환 시간이 ODR 주기보다 김
+
+// 호스트: BMP390 레지스터를 흉내내는 I2C 버스
+// CHIP_ID와 보정 계수 NVM을 내주고, normal 모드에서는 ODR 주기마다 변환을 끝내 STATUS에 DRDY를 세움
+// STATUS부터 압력 데이터까지 읽으면 DRDY가 지워짐, 데이터는 설정한 기압/온도를 역보정한 원시값
+// 전송 바이트만큼 시계를 진행 (블로킹 읽기, 바이트당 9클럭)
+class FakeBmp390Bus : public I2CBus {
+private:
+    uint8_t registers[128];
+    BMP390Calibration calib;
+    uint32_t clockHz;
+    bool present;
+
+    // normal 모드 변환 (시작 시각부터 ODR 주기마다 하나)
+    bool normal;
+    uint32_t normalSince;
+    uint32_t conversionsRead;    // 데이터를 읽어 간 변환 수
+
+    // 환경 (다음 데이터 읽기에 반영)
+    double pressurePa;
+    double temperatureC;
+
+    // 통계
+    uint32_t statusReads;
+    uint32_t dataReads;
+
+    uint32_t completedConversions();
+    void startNormal();
+    void advanceBus(size_t bytes);
+
+public:
+    // 대표적인 NVM 값 (리틀엔디언, 0x31~0x45)
+    static const uint8_t DEFAULT_NVM[21];
+
+    FakeBmp390Bus();
+
+    void begin(uint32_t clock) override { clockHz = clock; }
+    bool readRegisters(uint8_t address, uint8_t reg, uint8_t* buffer, size_t length) override;
+    bool writeRegister(uint8_t address, uint8_t reg, uint8_t value) override;
+
+    // 장치 유무 / 보정 계수 / 환경
+    void setPresent(bool connected) { present = connected; }
+    void setCalibration(const uint8_t* nvm);
+    void setEnvironment(double pascals, double celsius) { pressurePa = pascals; temperatureC = celsius; }
+
+    // 보정 식의 역 (이 원시값을 드라이버가 보정하면 주어진 값에 가장 가까움)
+    uint32_t rawTemperatureFor(double celsius);
+    uint32_t rawPressureFor(double pascals, uint32_t rawTemperature);
+
+    // 아직 읽지 않은 변환이 있음 (STATUS DRDY)
+    bool dataReady() { return normal && completedConversions() > conversionsRead; }
+    uint8_t getRegister(uint8_t reg) { return registers[reg & 0x7F]; }
+    uint32_t getStatusReads() { return statusReads; }
+    uint32_t getDataReads() { return dataReads; }
 };
+#endif
 
-#endif
\ No newline at end of file
+#endif
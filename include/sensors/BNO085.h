@@ -2,24 +2,133 @@
 #ifndef BNO085_H
 #define BNO085_H
 
-#include <Arduino.h>
-#include <Wire.h>
-#include <Adafruit_BNO08x.h>
+#include <string.h>
+#include "HAL.h"
+#include "SpscRing.h"
+#include "SampleRing.h"
+#include "Boot.h"
+#include "QuatMath.h"
 
 #define BNO085_INT 15
 
+// 전송 방식 (빌드 시 선택)
+//   기본: I2C (Wire1, 핀 17/16), 400 kHz - BNO085의 클럭 스트레칭은 LPI2C 하드웨어가 기다려 줌
+//   BNO085_TRANSPORT_SPI: SPI (PS0/PS1 HIGH 배선 필요), SHTP 패킷 길이 제한 없이 한 번에 읽음
+#define BNO085_I2C_CLOCK          400000
+#define BNO085_SPI_CLOCK          1000000  // Adafruit 라이브러리 설정
+
+#ifdef BNO085_TRANSPORT_SPI
+#define BNO085_CS 10
+#define BNO085_FAST_INTERVAL_US   2500     // 400 Hz
+#else
+#define BNO085_I2C_ADDRESS        0x4A
+#define BNO085_FAST_INTERVAL_US   5000     // 200 Hz (Wire 버퍼 32바이트라 배치 패킷이 여러 번에 나뉨)
+#endif
+
+// SH2 센서 ID (SH-2 레퍼런스 매뉴얼 6.5, 보드 구현에서 SH2_* 값과 같은지 확인)
+#define BNO085_REPORT_ACCELEROMETER  0x01
+#define BNO085_REPORT_GYROSCOPE      0x02   // 보정된 자이로
+#define BNO085_REPORT_ROTATION       0x05   // 회전 벡터
+
+// SHTP 패킷 크기 (헤더 + 기준 시각 레코드 + 리포트)
+#define BNO085_SHTP_HEADER_SIZE      4
+#define BNO085_BASE_TIMESTAMP_SIZE   5
+#define BNO085_I2C_CHUNK_SIZE        32     // Wire 버퍼 (이어 읽을 때마다 헤더 4바이트를 다시 읽음)
+
+// 인터럽트 한 번에 처리할 SHTP 패킷 수 (H_INTN이 계속 LOW면 이어서 읽음)
+#define BNO085_MAX_TRANSFERS 4
+
+// 초기화 대기 (us)
+#define BNO085_SETTLE_US      500000    // 전원 인가 후 버스 안정화
+#define BNO085_RETRY_WAIT_US  500000    // 연결 재시도 간격
+#define BNO085_ATTEMPTS       3
+
+// 리포트 주기 (us)
+#define BNO085_REPORT_INTERVAL_US 50000
+
+// 이벤트 링 크기 (2의 거듭제곱)
+#define BNO085_EVENT_RING_SIZE 64
+
+// 인터럽트 한 번에 모으는 리포트 수 (패킷당 리포트 3개 x BNO085_MAX_TRANSFERS, 여유 포함)
+#define BNO085_BATCH_SIZE 24
+
+// 샘플 이력 크기
+#define BNO085_SAMPLE_RING_SIZE 64
+
+// 링에 쌓이는 원본 이벤트 (타임스탬프 포함)
+struct ImuEvent {
+    uint32_t timestamp;      // micros (SH2 리포트 시각을 인터럽트 시각 기준으로 옮긴 값)
+    uint8_t sensorId;        // BNO085_REPORT_*
+    float x, y, z, w;        // 가속도/자이로: xyz, 쿼터니언: ijk + real
+};
+
+// 회전 벡터 하나와 같은 패킷의 가속도/자이로 (원시 값만, 파생 값은 ImuSnapshot)
+struct ImuSample {
+    uint32_t sequence;       // 발행 순번 (1부터)
+    Vec3 accel;              // m/s² (센서 좌표계)
+    Vec3 rate;               // rad/s (보정된 자이로, 센서 좌표계)
+    Quat quat;               // 센서 -> 월드
+};
+
+// 샘플 하나와 그 파생 값 (모두 같은 순번에서 계산)
+struct ImuSnapshot {
+    uint32_t timestamp;
+    ImuSample sample;
+    float roll, pitch, yaw;  // ° (오일러각)
+    Vec3 accelWorld;         // m/s² (월드 좌표계, RPY 방향)
+};
+
+// SH2 센서 허브 연결 (보드: Adafruit BNO08x + SH2 라이브러리, 호스트: 가짜 허브)
+// service()는 SHTP 패킷 하나를 읽고 묶여 온 리포트마다 핸들러 호출 (timestamp는 허브 시각)
+class Sh2Device {
+public:
+    typedef void (*ReportHandler)(void* context, const ImuEvent& event);
+
+protected:
+    ReportHandler handler;
+    void* handlerContext;
+
+public:
+    Sh2Device() : handler(nullptr), handlerContext(nullptr) {}
+    virtual ~Sh2Device() {}
+
+    void setReportHandler(ReportHandler reportHandler, void* context) {
+        handler = reportHandler;
+        handlerContext = context;
+    }
+
+    // 버스/핀 준비, 주소 스캔 결과 출력 (초기화 전 한 번)
+    virtual void open() = 0;
+    virtual void scan() = 0;
+
+    // 허브 연결 (SHTP 광고 수신까지), 연결 설명 ("0x4A, 400 kHz" 등)
+    virtual bool connect() = 0;
+    virtual const char* describe() = 0;
+
+    // 리포트 활성화 (Set Feature 명령 한 번)
+    virtual bool enableReport(uint8_t sensorId, uint32_t intervalUs) = 0;
+
+    // 허브가 리셋되어 리포트 설정을 잃었으면 true (읽으면 지워짐)
+    virtual bool wasReset() = 0;
+
+    // H_INTN이 LOW (읽을 패킷 있음) / 하강 에지 핸들러 연결
+    virtual bool interruptAsserted() = 0;
+    virtual void attachDataReady(void (*isr)()) = 0;
+
+    // SHTP 패킷 하나 읽기
+    virtual void service() = 0;
+};
+
 class BNO085 {
 private:
-    Adafruit_BNO08x bno08x;
-    sh2_SensorValue_t sensorValue;
+    Sh2Device* device;
     
-    // 센서 데이터 (원본 XYZ)
-    float accel_x, accel_y, accel_z;
-    float gyro_r, gyro_p, gyro_y;  // Roll, Pitch, Yaw (Euler angles)
-    float quat_i, quat_j, quat_k, quat_real;
+    // 최신 원시 값 (가속도/자이로는 이벤트마다, 쿼터니언은 회전 벡터마다 갱신)
+    ImuSample current;
+    uint32_t sequence;             // 발행한 샘플 수
     
-    // 변환된 가속도 (RPY 방향)
-    float accel_roll, accel_pitch, accel_yaw;
+    // 마지막으로 계산한 파생 값 (순번이 같으면 다시 계산하지 않음)
+    ImuSnapshot derived;
     
     bool initialized;
     bool has_accel;
@@ -28,47 +137,242 @@ private:
     
     unsigned long lastResetCheck;
     
-    // 쿼터니언을 오일러각으로 변환
-    void quaternionToEuler();
+    // 단계별 초기화 진행 상태
+    enum InitPhase : uint8_t { PHASE_START, PHASE_WAIT, PHASE_CONNECT };
+    InitPhase initPhase;
+    uint32_t initWaitUntil;
+    uint8_t initAttempts;
+    
+    // H_INTN 인터럽트 (ISR에서는 플래그만 세움)
+    static BNO085* instance;
+    static void onInterrupt();
+    volatile bool dataReady;
+    volatile uint32_t interruptMicros;
+    uint32_t batchMicros;          // 지금 읽는 패킷의 인터럽트 시각
+    bool batchInterrupted;         // 새 하강 에지로 시작한 배치인지 (아니면 H_INTN이 LOW로 남아 이어 읽음)
+    
+    // 인터럽트 한 번에 읽은 리포트 (timestamp는 SH2 시각 하위 32비트, 끝나면 halMicros로 옮겨 링에 넣음)
+    ImuEvent batch[BNO085_BATCH_SIZE];
+    uint8_t batchCount;
+    uint8_t anchorCount;           // 인터럽트를 일으킨 첫 패킷의 리포트 수
+    uint32_t batchDropped;
+    uint32_t clockOffset;          // SH2 시각 -> halMicros (마지막 인터럽트 기준)
+    bool clockOffsetValid;
+    uint32_t lastMappedMicros;     // 마지막으로 링에 넣은 시각 (단조 증가 유지)
+    
+    // 리포트 핸들러 (패킷 하나에 묶인 리포트마다 호출)
+    static void onReport(void* context, const ImuEvent& event);
+    void pushEvent(const ImuEvent& report);
+    void flushBatch();
     
-    // 가속도를 RPY 방향으로 변환
-    void transformAccelToRPY();
+    // 이벤트 링 (드레인 -> 처리)
+    SpscRing<ImuEvent, BNO085_EVENT_RING_SIZE> events;
+    uint32_t lastEventMicros;
+    
+    // 타임스탬프 샘플 이력
+    SampleRing<ImuSample, BNO085_SAMPLE_RING_SIZE> samples;
+    
+    // 리셋/주기 변경 후 리포트 (재)활성화 (비블로킹, 한 번에 하나씩)
+    uint32_t reportIntervalUs;
+    uint8_t pendingReports;
+    unsigned long reportRetryAt;
+    void serviceReports();
+    
+    // 이벤트 하나를 최신 값에 반영
+    void applyEvent(const ImuEvent& event);
+    
+    // 샘플의 파생 값 (회전행렬 한 번으로 오일러각과 월드 가속도), 메모이즈
+    const ImuSnapshot& derive(const Sample<ImuSample>& sample);
 
 public:
-    BNO085();
+    BNO085(Sh2Device* sh2);
+    
+    // 초기화 (보드: Wire1 - 핀 17/16 또는 SPI), 끝날 때까지 beginStep 반복
+    // warmStart: 비행 중 재시작 - 버스 스캔/안정화 대기 없이 한 번만 시도
+    bool begin(bool warmStart = false);
     
-    // 초기화 (Wire1 사용 - 핀 17/16)
-    bool begin();
+    // 재개 가능한 초기화 한 단계 (대기 중에는 바로 반환)
+    // 리포트는 연결 후 update()에서 하나씩 활성화
+    InitStatus beginStep(bool warmStart = false);
     
-    // 센서 데이터 읽기 (폴링 방식)
+    // 리포트 주기 변경 (다음 update부터 리포트를 하나씩 다시 활성화)
+    void setReportInterval(uint32_t intervalUs);
+    uint32_t getReportInterval() { return reportIntervalUs; }
+    
+    // 대기 중인 센서 이벤트를 링으로 드레인 (인터럽트가 없으면 I2C 접근 없이 즉시 반환)
+    void service();
+    
+    // 드레인 후 링의 이벤트를 최신 값에 반영
     void update();
     
-    // 가속도 데이터 접근 (m/s²) - 원본 XYZ
-    float getAccelX() { return accel_x; }
-    float getAccelY() { return accel_y; }
-    float getAccelZ() { return accel_z; }
+    // 마지막 발행 샘플과 파생 값 한 벌 (필드가 서로 다른 이벤트에서 섞이지 않음)
+    // 파생 값은 처음 요청될 때 계산하고 같은 순번 동안 재사용
+    ImuSnapshot snapshot();
     
-    // 가속도 데이터 접근 (m/s²) - RPY 방향 (변환된 값)
-    float getAccelRoll() { return accel_roll; }
-    float getAccelPitch() { return accel_pitch; }
-    float getAccelYaw() { return accel_yaw; }
+    // timestamp 시점의 샘플과 파생 값 (이력에 없으면 false)
+    bool snapshotAt(uint32_t timestamp, ImuSnapshot& out);
+    uint32_t getSequence() { return sequence; }
+    
+    // 가속도 데이터 접근 (m/s²) - 원본 XYZ
+    float getAccelX() { return current.accel.x; }
+    float getAccelY() { return current.accel.y; }
+    float getAccelZ() { return current.accel.z; }
     
-    // 자이로 데이터 접근 (도, degrees)
-    float getGyroRoll() { return gyro_r; }
-    float getGyroPitch() { return gyro_p; }
-    float getGyroYaw() { return gyro_y; }
+    // 각속도 (°/s, 센서 X/Y/Z)
+    float getRateX() { return current.rate.x * QM_RAD_TO_DEG; }
+    float getRateY() { return current.rate.y * QM_RAD_TO_DEG; }
+    float getRateZ() { return current.rate.z * QM_RAD_TO_DEG; }
     
     // 쿼터니언 데이터 접근
-    float getQuatI() { return quat_i; }
-    float getQuatJ() { return quat_j; }
-    float getQuatK() { return quat_k; }
-    float getQuatReal() { return quat_real; }
+    float getQuatI() { return current.quat.x; }
+    float getQuatJ() { return current.quat.y; }
+    float getQuatK() { return current.quat.z; }
+    float getQuatReal() { return current.quat.w; }
+    
+    // 파생 값 (여러 개를 함께 쓸 때는 snapshot 사용)
+    float getAccelRoll() { return snapshot().accelWorld.x; }
+    float getAccelPitch() { return snapshot().accelWorld.y; }
+    float getAccelYaw() { return snapshot().accelWorld.z; }
+    float getGyroRoll() { return snapshot().roll; }
+    float getGyroPitch() { return snapshot().pitch; }
+    float getGyroYaw() { return snapshot().yaw; }
     
     // 상태 확인
     bool isInitialized() { return initialized; }
     bool hasAccelData() { return has_accel; }
     bool hasGyroData() { return has_gyro; }
     bool hasQuatData() { return has_quat; }
+    
+    // 이벤트 통계
+    uint32_t getLastEventMicros() { return lastEventMicros; }
+    uint32_t getDroppedEvents() { return events.getDropped() + batchDropped; }
+    
+    // 샘플 이력 (최신/시점/구간 조회)
+    const SampleRing<ImuSample, BNO085_SAMPLE_RING_SIZE>& getSamples() { return samples; }
+};
+
+#ifdef ARDUINO
+#include <Wire.h>
+#include <SPI.h>
+#include <Adafruit_BNO08x.h>
+
+// Adafruit BNO08x (SHTP 전송) + SH2 라이브러리
+// 라이브러리 콜백은 패킷 하나에서 마지막 리포트만 남기므로 SH2 센서 콜백을 직접 받음
+class Bno08xDevice : public Sh2Device {
+private:
+    Adafruit_BNO08x bno08x;
+    sh2_SensorValue_t sensorValue;
+
+    static void onSensorEvent(void* cookie, sh2_SensorEvent_t* event);
+
+public:
+    void open() override;
+    void scan() override;
+    bool connect() override;
+    const char* describe() override;
+    bool enableReport(uint8_t sensorId, uint32_t intervalUs) override;
+    bool wasReset() override { return bno08x.wasReset(); }
+    bool interruptAsserted() override { return digitalRead(BNO085_INT) == LOW; }
+    void attachDataReady(void (*isr)()) override;
+    void service() override { sh2_service(); }
+};
+#else
+#define FAKE_SH2_REPORTS      3       // 가속도, 자이로, 회전 벡터
+#define FAKE_SH2_QUEUE_SIZE   16      // 직접 넣는 패킷 큐 (2의 거듭제곱)
+#define FAKE_SH2_PACKET_MAX   8       // 패킷 하나에 넣을 수 있는 리포트
+
+// 호스트: SH2 허브 흉내 (시뮬레이션 시계 기준)
+// 활성화된 리포트를 주기마다 같은 시각끼리 한 패킷으로 묶어 내고, 직접 넣은 패킷(버스트)을 먼저 냄
+// 전송 방식별로 버스 트랜잭션/바이트를 세고 (I2C: 32바이트 청크마다 헤더 재읽기, SPI: 헤더 + 패킷),
+// 그 전송 시간만큼 시계를 진행 (블로킹 읽기)
+// 인터럽트는 하네스가 시계를 진행한 뒤 tick()으로 H_INTN 하강 에지를 냄
+class FakeSh2Device : public Sh2Device {
+private:
+    bool spi;
+    uint32_t busClockHz;
+    uint32_t hubOffset;          // 허브 시각 = halMicros + hubOffset
+
+    bool present;
+    uint8_t failedConnects;      // 이만큼 연결 실패 후 성공
+    bool resetFlag;
+
+    uint32_t intervalUs[FAKE_SH2_REPORTS];   // 0 = 꺼짐
+    uint32_t nextDue[FAKE_SH2_REPORTS];      // 허브 시각
+
+    // 현재 운동 (생성되는 리포트 값)
+    Vec3 accel;
+    Vec3 rate;
+    Quat quat;
+
+    // 직접 넣은 패킷
+    struct QueuedPacket {
+        ImuEvent reports[FAKE_SH2_PACKET_MAX];
+        uint8_t count;
+    };
+    QueuedPacket queue[FAKE_SH2_QUEUE_SIZE];
+    uint8_t queueHead;
+    uint8_t queueTail;
+
+    // H_INTN 상태 (false = HIGH), 하강 에지 핸들러
+    bool lineLow;
+    void (*isr)();
+
+    // 통계
+    uint32_t transactions;
+    uint32_t bytesTransferred;
+    uint32_t packets;
+    uint32_t reports;
+    uint32_t reportsById[FAKE_SH2_REPORTS];
+
+    static uint8_t reportIndex(uint8_t sensorId);
+    static uint8_t reportSize(uint8_t sensorId);
+    bool nextGeneratedDue(uint32_t& due);
+    void countRead(size_t packetLength);
+
+public:
+    FakeSh2Device(bool spiTransport = false, uint32_t clockHz = 400000);
+
+    void open() override {}
+    void scan() override {}
+    bool connect() override;
+    const char* describe() override { return spi ? "fake SPI" : "fake I2C"; }
+    bool enableReport(uint8_t sensorId, uint32_t intervalUs) override;
+    bool wasReset() override;
+    bool interruptAsserted() override;
+    void attachDataReady(void (*handler)()) override { isr = handler; }
+    void service() override;
+
+    // 하네스: 시계를 진행한 뒤 호출 (읽을 패킷이 생겼으면 하강 에지 -> 핸들러)
+    void tick();
+
+    // 다음 리포트 패킷이 준비되는 시각 (halMicros 기준, 없으면 false)
+    bool nextInterruptAt(uint32_t& when);
+
+    // 허브 구성
+    void setPresent(bool connected, uint8_t failures = 0) { present = connected; failedConnects = failures; }
+    void setHubOffset(uint32_t offset) { hubOffset = offset; }
+    uint32_t hubMicros() { return halMicros() + hubOffset; }
+
+    // 생성할 리포트 값 (센서 좌표계 가속도 m/s², 각속도 rad/s, 센서 -> 월드 쿼터니언)
+    void setMotion(const Vec3& acceleration, const Vec3& angularRate, const Quat& orientation);
+
+    // 패킷 하나를 그대로 큐에 넣기 (timestamp는 허브 시각, 다음 tick에서 인터럽트)
+    bool queuePacket(const ImuEvent* events, uint8_t count);
+
+    // 허브 리셋 (리포트 설정을 잃고 wasReset이 한 번 true)
+    void reset();
+
+    uint32_t getReportInterval(uint8_t sensorId);
+    uint32_t getTransactions() { return transactions; }
+    uint32_t getBytesTransferred() { return bytesTransferred; }
+    uint32_t getPackets() { return packets; }
+    uint32_t getReports() { return reports; }
+    uint32_t getReports(uint8_t sensorId);
+    void resetCounters() { transactions = 0; bytesTransferred = 0; packets = 0; reports = 0; memset(reportsById, 0, sizeof(reportsById)); }
+
+    // SHTP 패킷 길이 (헤더 + 기준 시각 + 리포트)
+    static size_t packetLength(const uint8_t* sensorIds, uint8_t count);
 };
+#endif
 
-#endif
\ No newline at end of file
+#endif
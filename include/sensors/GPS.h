@@ -2,37 +2,123 @@
 #ifndef GPS_H
 #define GPS_H
 
-#include <Arduino.h>
-#include <Adafruit_GPS.h>
+#include <string.h>
+#include "HAL.h"
+#include "Boot.h"
+#include "SampleRing.h"
 
-#define GPSSerial Serial1
+// 수신 프로토콜 (빌드 시 선택)
+//   기본: NMEA 텍스트 (MTK3339, PMTK 설정)
+//   GPS_PROTOCOL_UBX: u-blox UBX 바이너리 NAV-PVT (CFG 메시지로 설정)
+#ifdef GPS_PROTOCOL_UBX
+#include "sensors/UBXParser.h"
+typedef UBXParser GpsParser;
+#else
+#include "sensors/NMEAParser.h"
+typedef NMEAParser GpsParser;
+#endif
+
+// 통신 설정 (두 모듈 모두 전원 인가 시 9600 baud, 1 Hz)
+#define GPS_DEFAULT_BAUD    9600
+#define GPS_FAST_BAUD       115200
+#define GPS_UPDATE_HZ       10
+#define GPS_BAUD_SWITCH_US  50000    // 속도 변경 명령 송신/적용 대기
+
+// 샘플 이력 크기
+#define GPS_SAMPLE_RING_SIZE 8
+
+// 수신한 NMEA 문장 전달 (기록용, 해석 전 원문, UBX 빌드에서는 호출되지 않음)
+typedef void (*SentenceHandler)(const char* sentence, uint32_t timestamp);
+
+// 파싱된 위치 한 벌
+struct GpsSample {
+    float latitude;          // degrees
+    float longitude;         // degrees
+    float altitude;          // m
+    uint8_t satellites;
+    bool fix;
+    uint8_t hour, minute, seconds;   // UTC
+};
 
 class GPS {
 private:
-    Adafruit_GPS gps;
+    UartPort* port;
+    GpsParser parser;
     bool initialized;
+    SentenceHandler sentenceHandler;
+
+    // 목표 통신 속도/갱신 주기
+    uint32_t baud;
+    uint8_t updateHz;
+
+    // 단계별 초기화 진행 상태
+    enum InitPhase : uint8_t { PHASE_START, PHASE_BAUD_WAIT };
+    InitPhase initPhase;
+    uint32_t initWaitUntil;
+
+    // 마지막으로 해석한 값
+    GpsSample current;
+
+    // 타임스탬프 샘플 이력
+    SampleRing<GpsSample, GPS_SAMPLE_RING_SIZE> samples;
+
+#ifdef GPS_PROTOCOL_UBX
+    // UBX 설정 메시지 송신
+    void sendMessage(uint8_t cls, uint8_t id, const uint8_t* body, uint16_t length);
+    void sendPortConfig(uint32_t baudRate);
+#else
+    // PMTK 명령 송신 ('$', 체크섬, 줄바꿈 추가)
+    void sendCommand(const char* body);
+    void sendCommand(const char* prefix, uint32_t value);
+#endif
+
+    // 속도 변경 명령 / 출력 메시지·주기 설정
+    void requestBaud();
+    void configureOutput();
+
+    // 완성된 문장/프레임을 해석해서 current 갱신, 위치 메시지였으면 true
+    bool decode(uint32_t now);
 
 public:
-    GPS();
-    
-    // 초기화 (Serial1 사용 - 핀 0/1)
+    GPS(UartPort* uart);
+
+    // 통신 속도/갱신 주기 설정 (begin 전에 호출, 9600/1이면 모듈 기본 설정 그대로)
+    void configure(uint32_t baudRate, uint8_t rateHz);
+
+    // 갱신 주기만 변경 (초기화 후면 설정 명령을 UART 송신 버퍼에 넣고 바로 반환)
+    void setUpdateRate(uint8_t rateHz);
+    uint8_t getUpdateRate() { return updateHz; }
+
+    // 초기화 (Serial1 사용 - 핀 0/1), 끝날 때까지 beginStep 반복
     bool begin();
-    
-    // GPS 데이터 읽기 (loop에서 계속 호출 필요)
+
+    // 재개 가능한 초기화 한 단계 (속도 변경 대기 중에는 바로 반환)
+    InitStatus beginStep();
+
+    // UART 수신 버퍼를 모두 읽어서 문장 단위로 해석 (loop에서 계속 호출)
     void update();
-    
+
+    // 문장 수신 콜백 등록 (nullptr이면 해제)
+    void setSentenceHandler(SentenceHandler handler) { sentenceHandler = handler; }
+
     // 데이터 접근
-    bool hasFix() { return gps.fix; }
-    float getLatitude() { return gps.latitudeDegrees; }
-    float getLongitude() { return gps.longitudeDegrees; }
-    float getAltitude() { return gps.altitude; }
-    int getSatellites() { return gps.satellites; }
-    
-    // GPS 시간 (HH:MM:SS 문자열)
-    String getTimeString();
-    
+    bool hasFix() { return current.fix; }
+    float getLatitude() { return current.latitude; }
+    float getLongitude() { return current.longitude; }
+    float getAltitude() { return current.altitude; }
+    int getSatellites() { return current.satellites; }
+
+    // GPS 시간 (HH:MM:SS 문자열, buffer는 9바이트 이상)
+    void getTimeString(char* buffer);
+
     // 상태 확인
     bool isInitialized() { return initialized; }
+
+    // 수신 통계 (문장/프레임 수, 체크섬 오류, 잘린 문장)
+    const GpsParser& getParser() { return parser; }
+
+    // 샘플 이력 (최신/시점/구간 조회)
+    const SampleRing<GpsSample, GPS_SAMPLE_RING_SIZE>& getSamples() { return samples; }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,87 @@
+// include/sensors/NMEAParser.h
+#ifndef NMEA_PARSER_H
+#define NMEA_PARSER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define NMEA_MAX_LEN     96      // '$'와 체크섬 제외 본문 최대 길이 (표준 82자 + 여유)
+#define NMEA_MAX_FIELDS  24
+
+// 해석하는 문장 종류
+enum NMEASentence : uint8_t {
+    NMEA_NONE = 0,           // 해석하지 않는 문장
+    NMEA_GGA,
+    NMEA_RMC,
+};
+
+// 마지막으로 해석한 위치/시간
+struct NMEAData {
+    double latitude;         // degrees (+N)
+    double longitude;        // degrees (+E)
+    float altitude;          // m (GGA)
+    float speedKnots;        // RMC
+    float course;            // ° (RMC)
+    uint8_t satellites;      // GGA
+    bool fix;                // GGA 품질 > 0 또는 RMC 상태 'A'
+    uint8_t hour, minute, seconds;   // UTC
+    uint16_t milliseconds;
+};
+
+// 바이트 단위 NMEA 수신기
+// 문자 분류 + 상태 전이 테이블로 '$' ~ '*hh' 경계와 체크섬을 확인하고,
+// 해석은 수신 버퍼 안에서 ','를 널 문자로 바꿔 필드 포인터만 잡음 (복사 없음)
+class NMEAParser {
+private:
+    char line[NMEA_MAX_LEN + 1];     // '$' 다음부터 '*' 전까지
+    uint8_t length;
+    uint8_t state;
+    uint8_t checksum;                // 본문 XOR
+    uint8_t received;                // '*' 뒤 16진수
+
+    const char* fields[NMEA_MAX_FIELDS];
+    uint8_t fieldCount;
+
+    NMEAData data;
+
+    // 통계
+    uint32_t sentences;              // 체크섬이 맞은 문장
+    uint32_t parsed;                 // GGA/RMC로 해석한 문장
+    uint32_t checksumErrors;
+    uint32_t dropped;                // 잘리거나 너무 길거나 형식이 틀린 문장
+
+    void tokenize();
+    void parseGGA();
+    void parseRMC();
+
+    typedef void (NMEAParser::*SentenceParser)();
+    struct SentenceEntry {
+        const char* type;            // 토커 뒤 3글자 (GP/GN/GL 공통)
+        NMEASentence id;
+        SentenceParser parser;
+    };
+    static const SentenceEntry SENTENCES[];
+
+public:
+    NMEAParser();
+
+    void reset();
+
+    // 한 바이트 처리, 체크섬까지 맞는 문장이 완성되면 true
+    bool feed(char c);
+
+    // 완성된 문장 원문 ('$'/체크섬 제외, 다음 feed 전까지 유효, parse 전에만 원문 그대로)
+    const char* sentence() const { return line; }
+
+    // 완성된 문장을 제자리에서 해석 (GGA/RMC면 data 갱신)
+    NMEASentence parse();
+
+    const NMEAData& getData() const { return data; }
+
+    uint32_t getSentenceCount() const { return sentences; }
+    uint32_t getParsedCount() const { return parsed; }
+    uint32_t getChecksumErrors() const { return checksumErrors; }
+    uint32_t getDroppedCount() const { return dropped; }
+};
+
+#endif
@@ -0,0 +1,83 @@
+// include/sensors/PressureSource.h
+#ifndef PRESSURE_SOURCE_H
+#define PRESSURE_SOURCE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "SpscRing.h"
+
+// 주입 대기 큐 크기 (BMP 태스크 주기 동안 들어올 수 있는 SIMP 수보다 넉넉히)
+#define PRESSURE_INJECT_RING_SIZE 16
+
+// 기압 한 건 (하드웨어 변환 또는 외부 값)
+struct PressureReading {
+    float pressure;          // hPa
+    float temperature;       // °C (hasTemperature일 때만 유효)
+    bool hasTemperature;
+    uint32_t timestamp;      // micros (값이 만들어지거나 수신된 시각)
+};
+
+// BMP390에 붙는 기압 공급원
+// 없으면(nullptr) 센서 레지스터를 읽고, 있으면 그 값을 같은 고도/샘플 경로로 처리
+class PressureSource {
+public:
+    virtual ~PressureSource() {}
+
+    // 새 값이 있으면 하나 꺼내고 true
+    virtual bool read(PressureReading& out) = 0;
+};
+
+// 지상국 SIMP 명령으로 들어온 기압 (수신 시각 포함)
+// 명령 처리(생산자)와 BMP 태스크(소비자)가 달라도 되도록 SPSC 링 사용
+class InjectedPressureSource : public PressureSource {
+private:
+    SpscRing<PressureReading, PRESSURE_INJECT_RING_SIZE> pending;
+
+    // 수신 -> 사용 지연
+    uint32_t consumed;
+    uint32_t lastLag;        // us
+    uint32_t maxLag;         // us
+    uint64_t totalLag;       // us
+
+public:
+    InjectedPressureSource();
+
+    // 수신 시 호출 (가득 차면 false)
+    bool inject(float pressureHpa, uint32_t timestamp);
+
+    bool read(PressureReading& out) override;
+
+    uint32_t getConsumed() const { return consumed; }
+    uint32_t getDropped() const { return pending.getDropped(); }
+    uint32_t getLastLag() const { return lastLag; }
+    uint32_t getMaxLag() const { return maxLag; }
+    uint32_t getAverageLag() const { return consumed ? (uint32_t)(totalLag / consumed) : 0; }
+    void resetStats();
+};
+
+// 기록된 기압 궤적 재생 ("경과ms,Pa" 줄, 호스트 시험 또는 지상 리허설용)
+// 텍스트는 호출자 소유 (파일을 통째로 읽은 버퍼 등), 복사하지 않음
+class TracePressureSource : public PressureSource {
+private:
+    const char* cursor;
+    uint32_t startMicros;
+
+    // 다음 줄 (시각이 되기 전까지 보관)
+    PressureReading next;
+    bool hasNext;
+
+    bool parseLine();
+
+public:
+    TracePressureSource();
+
+    // 재생 시작 (경과 시간 0 = startMicros)
+    void begin(const char* trace, uint32_t startTime);
+
+    bool read(PressureReading& out) override;
+
+    // 끝까지 재생했는지
+    bool isFinished() const { return !hasNext && (cursor == nullptr || *cursor == '\0'); }
+};
+
+#endif
@@ -0,0 +1,95 @@
+// include/sensors/UBXParser.h
+#ifndef UBX_PARSER_H
+#define UBX_PARSER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define UBX_SYNC1            0xB5
+#define UBX_SYNC2            0x62
+#define UBX_MAX_PAYLOAD      100
+
+// 메시지 클래스/ID
+#define UBX_CLASS_NAV        0x01
+#define UBX_CLASS_ACK        0x05
+#define UBX_CLASS_CFG        0x06
+#define UBX_NAV_PVT          0x07
+#define UBX_CFG_PRT          0x00
+#define UBX_CFG_MSG          0x01
+#define UBX_CFG_RATE         0x08
+
+#define UBX_NAV_PVT_LEN      92
+
+// NAV-PVT 플래그
+#define UBX_PVT_FLAG_GNSS_FIX_OK   0x01
+
+// 해석하는 메시지 종류
+enum UBXMessage : uint8_t {
+    UBX_NONE = 0,
+    UBX_PVT,
+};
+
+// NAV-PVT 주요 필드 (단위 변환 없이 정수 그대로)
+struct UBXData {
+    int32_t latitude;        // 1e-7 deg
+    int32_t longitude;       // 1e-7 deg
+    int32_t heightMSL;       // mm
+    int32_t velocityDown;    // mm/s
+    uint16_t year;
+    uint8_t month, day;
+    uint8_t hour, minute, seconds;   // UTC
+    uint8_t fixType;         // 0 없음, 2 2D, 3 3D
+    uint8_t satellites;
+    bool fix;                // gnssFixOK
+};
+
+// 바이트 단위 UBX 수신기
+// 고정 길이 바이너리 프레임 (동기 2바이트, 클래스, ID, 길이, payload, Fletcher 체크섬)
+// 필드는 정해진 오프셋의 리틀엔디언 정수라서 문자열/실수 해석이 없음
+class UBXParser {
+private:
+    uint8_t payload[UBX_MAX_PAYLOAD];
+    uint8_t state;
+    uint8_t messageClass;
+    uint8_t messageId;
+    uint16_t length;
+    uint16_t index;
+    uint8_t ckA, ckB;        // 누적 체크섬
+    uint8_t receivedA;
+
+    UBXData data;
+
+    // 통계
+    uint32_t frames;                 // 체크섬이 맞은 프레임
+    uint32_t parsed;                 // NAV-PVT로 해석한 프레임
+    uint32_t checksumErrors;
+    uint32_t dropped;                // 너무 긴 프레임
+
+    void checksum(uint8_t byte) { ckA += byte; ckB += ckA; }
+    void parsePVT();
+
+public:
+    UBXParser();
+
+    void reset();
+
+    // 한 바이트 처리, 체크섬까지 맞는 프레임이 완성되면 true
+    bool feed(uint8_t byte);
+
+    // 완성된 프레임 해석 (NAV-PVT면 data 갱신)
+    UBXMessage parse();
+
+    uint8_t getClass() const { return messageClass; }
+    uint8_t getId() const { return messageId; }
+    const UBXData& getData() const { return data; }
+
+    uint32_t getFrameCount() const { return frames; }
+    uint32_t getParsedCount() const { return parsed; }
+    uint32_t getChecksumErrors() const { return checksumErrors; }
+    uint32_t getDroppedCount() const { return dropped; }
+
+    // 송신 프레임 생성 (frame은 length + 8 바이트 이상), 프레임 길이 반환
+    static size_t buildFrame(uint8_t cls, uint8_t id, const uint8_t* body, uint16_t length, uint8_t* frame);
+};
+
+#endif
@@ -0,0 +1,98 @@
+// src/Altitude.cpp
+#include "Altitude.h"
+#include <math.h>
+
+static const float ALTITUDE_EXPONENT = 0.1903f;
+static const float ALTITUDE_SCALE = 44330.0f;
+
+// ---- 컴파일 타임 pow (테이블 생성 전용, double) ----
+
+static constexpr double CX_LN2 = 0.69314718055994530942;
+
+// ln(x), x > 0: x = m * 2^k (m은 [1, 2)) 후 atanh 급수
+static constexpr double cxLog(double x) {
+    int k = 0;
+    while (x >= 2.0) { x /= 2.0; k++; }
+    while (x < 1.0) { x *= 2.0; k--; }
+
+    double z = (x - 1.0) / (x + 1.0);
+    double z2 = z * z;
+    double term = z;
+    double sum = 0.0;
+    for (int n = 1; n < 60; n += 2) {
+        sum += term / n;
+        term *= z2;
+    }
+    return 2.0 * sum + k * CX_LN2;
+}
+
+// exp(y): y = k*ln2 + r 후 테일러 급수
+static constexpr double cxExp(double y) {
+    int k = (int)(y / CX_LN2);
+    double r = y - k * CX_LN2;
+
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 30; n++) {
+        term *= r / n;
+        sum += term;
+    }
+    while (k > 0) { sum *= 2.0; k--; }
+    while (k < 0) { sum /= 2.0; k++; }
+    return sum;
+}
+
+static constexpr double cxPow(double base, double exponent) {
+    return cxExp(exponent * cxLog(base));
+}
+
+// ---- p^0.1903 테이블 ----
+
+static constexpr float TABLE_STEP =
+    (ALTITUDE_TABLE_MAX_HPA - ALTITUDE_TABLE_MIN_HPA) / (ALTITUDE_TABLE_SIZE - 1);
+
+struct PressurePowerTable {
+    float values[ALTITUDE_TABLE_SIZE];
+
+    constexpr PressurePowerTable() : values() {
+        for (int i = 0; i < ALTITUDE_TABLE_SIZE; i++) {
+            double p = ALTITUDE_TABLE_MIN_HPA + (double)i * TABLE_STEP;
+            values[i] = (float)cxPow(p, 0.1903);
+        }
+    }
+};
+
+static constexpr PressurePowerTable PRESSURE_POWER{};
+
+// ---- AltitudeConverter ----
+
+AltitudeConverter::AltitudeConverter() {
+    setReference(ALTITUDE_SEA_LEVEL_HPA);
+}
+
+void AltitudeConverter::setReference(float pressureHpa) {
+    if (!(pressureHpa > 0.0f)) return;
+    referencePressure = pressureHpa;
+    inverseReference = 1.0f / powf(pressureHpa, ALTITUDE_EXPONENT);
+}
+
+float AltitudeConverter::pressurePower(float pressureHpa) {
+    float position = (pressureHpa - ALTITUDE_TABLE_MIN_HPA) * (1.0f / TABLE_STEP);
+
+    // 범위 밖 (또는 NaN)은 정확한 식으로
+    if (!(position >= 0.0f && position <= (float)(ALTITUDE_TABLE_SIZE - 1))) {
+        return pressureHpa > 0.0f ? powf(pressureHpa, ALTITUDE_EXPONENT) : 0.0f;
+    }
+
+    int index = (int)position;
+    if (index >= ALTITUDE_TABLE_SIZE - 1) index = ALTITUDE_TABLE_SIZE - 2;
+    float fraction = position - (float)index;
+
+    float lower = PRESSURE_POWER.values[index];
+    float upper = PRESSURE_POWER.values[index + 1];
+    return lower + (upper - lower) * fraction;
+}
+
+float AltitudeConverter::toAltitude(float pressureHpa) const {
+    return ALTITUDE_SCALE * (1.0f - pressurePower(pressureHpa) * inverseReference);
+}
@@ -0,0 +1,75 @@
+// src/Boot.cpp
+#include "Boot.h"
+#include "Telemetry.h"
+#include <string.h>
+
+static const char* const STATUS_NAMES[] = { "PENDING", "READY", "FAILED" };
+
+BootSequencer::BootSequencer(ClockFunction clockFn) {
+    steps = nullptr;
+    stepCount = 0;
+    clock = clockFn;
+    startTime = 0;
+    memset(status, 0, sizeof(status));
+    memset(finishedAt, 0, sizeof(finishedAt));
+    readyCount = 0;
+    doneCount = 0;
+}
+
+bool BootSequencer::begin(const BootStep* table, uint8_t count) {
+    if (count > BOOT_MAX_STEPS) return false;
+
+    steps = table;
+    stepCount = count;
+    startTime = clock();
+    readyCount = 0;
+    doneCount = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        status[i] = INIT_PENDING;
+        finishedAt[i] = 0;
+    }
+    return true;
+}
+
+bool BootSequencer::run() {
+    for (uint8_t i = 0; i < stepCount; i++) {
+        if (status[i] != INIT_PENDING) continue;
+
+        InitStatus result = steps[i].step();
+        uint32_t elapsed = clock() - startTime;
+
+        // 제한 시간 초과 (단계 함수가 스스로 끝내지 못한 경우)
+        if (result == INIT_PENDING && steps[i].timeoutUs && elapsed >= steps[i].timeoutUs) {
+            result = INIT_FAILED;
+        }
+
+        if (result != INIT_PENDING) {
+            status[i] = result;
+            finishedAt[i] = elapsed;
+            doneCount++;
+            if (result == INIT_READY) readyCount++;
+        }
+    }
+
+    return isDone();
+}
+
+size_t BootSequencer::formatReport(char* buffer, size_t size, uint32_t firstPacketUs) {
+    CSVWriter csv(buffer, size);
+
+    csv.appendString("BOOT");
+    csv.separator();
+    csv.appendUInt(firstPacketUs);
+
+    for (uint8_t i = 0; i < stepCount; i++) {
+        csv.separator();
+        csv.appendString(steps[i].name);
+        csv.separator();
+        csv.appendString(STATUS_NAMES[status[i]]);
+        csv.separator();
+        csv.appendUInt(status[i] == INIT_PENDING ? 0 : startTime + finishedAt[i]);
+    }
+
+    return csv.size();
+}
@@ -0,0 +1,114 @@
+// src/CMD.cpp
+#include "CMD.h"
+#include <string.h>
+
+// 앞부분 고정 토큰 (CMD, 팀 ID) 다음이 명령 이름
+#define CMD_PREFIX_TOKENS   2
+
+CommandParser::CommandParser() {
+    table = nullptr;
+    tableSize = 0;
+
+    length = 0;
+    discard = false;
+    copyString(echo, "NONE", sizeof(echo));
+
+    accepted = 0;
+    rejected = 0;
+    unknown = 0;
+    dropped = 0;
+}
+
+void CommandParser::begin(const CommandSpec* commands, uint8_t count) {
+    table = commands;
+    tableSize = count;
+}
+
+bool CommandParser::feed(char c) {
+    if (c == '\n' || c == '\r') {
+        bool executed = false;
+        if (discard) dropped++;
+        else if (length > 0) executed = process();
+
+        length = 0;
+        discard = false;
+        return executed;
+    }
+
+    if (discard) return false;
+
+    // 출력 가능한 ASCII만 (무선 잡음으로 깨진 줄은 통째로 버림)
+    if (c < ' ' || c > '~' || length >= CMD_MAX_LEN) {
+        discard = true;
+        return false;
+    }
+
+    line[length++] = c;
+    return false;
+}
+
+const CommandSpec* CommandParser::find(const char* name) {
+    int low = 0;
+    int high = (int)tableSize - 1;
+
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        int order = strcmp(name, table[mid].name);
+        if (order == 0) return &table[mid];
+        if (order < 0) high = mid - 1;
+        else low = mid + 1;
+    }
+    return nullptr;
+}
+
+bool CommandParser::process() {
+    line[length] = '\0';
+
+    // 수신 버퍼 안에서 ','를 널 문자로 바꿔 토큰 포인터만 잡음
+    const char* tokens[CMD_PREFIX_TOKENS + 1 + CMD_MAX_ARGS];
+    uint8_t tokenCount = 0;
+    const uint8_t maxTokens = sizeof(tokens) / sizeof(tokens[0]);
+
+    tokens[tokenCount++] = line;
+    for (char* p = line; *p; p++) {
+        if (*p != ',') continue;
+        if (tokenCount >= maxTokens) {
+            rejected++;
+            return false;
+        }
+        *p = '\0';
+        tokens[tokenCount++] = p + 1;
+    }
+
+    if (tokenCount <= CMD_PREFIX_TOKENS || strcmp(tokens[0], "CMD") != 0 || strcmp(tokens[1], TEAM_ID) != 0) {
+        rejected++;
+        return false;
+    }
+
+    const CommandSpec* spec = table ? find(tokens[CMD_PREFIX_TOKENS]) : nullptr;
+    if (spec == nullptr) {
+        unknown++;
+        return false;
+    }
+
+    CommandArgs args;
+    args.argc = tokenCount - CMD_PREFIX_TOKENS - 1;
+    for (uint8_t i = 0; i < args.argc; i++) {
+        args.argv[i] = tokens[CMD_PREFIX_TOKENS + 1 + i];
+    }
+
+    if (args.argc < spec->minArgs || args.argc > spec->maxArgs || !spec->handler(args)) {
+        rejected++;
+        return false;
+    }
+
+    // 에코: 명령 이름과 인자를 구분자 없이 이어 붙임
+    CSVWriter text(echo, sizeof(echo));
+    text.appendString(spec->name);
+    for (uint8_t i = 0; i < args.argc; i++) {
+        text.appendString(args.argv[i]);
+    }
+
+    accepted++;
+    return true;
+}
@@ -0,0 +1,390 @@
+// src/Camera.cpp
+#include "Camera.h"
+#include <string.h>
+
+// ---- 장치 ----
+
+#ifdef ARDUINO
+
+ArduCamDevice::ArduCamDevice() : cam(OV2640, CAMERA_CS), settings(CAMERA_SPI_CLOCK, MSBFIRST, SPI_MODE0) {
+    transferDone = false;
+    readDestination = nullptr;
+    readLength = 0;
+
+    transferEvent.setContext(this);
+    transferEvent.attachImmediate(onTransfer);
+}
+
+void ArduCamDevice::onTransfer(EventResponderRef event) {
+    // DMA 완료 인터럽트 - 플래그만 세움
+    ((ArduCamDevice*)event.getContext())->transferDone = true;
+}
+
+bool ArduCamDevice::begin() {
+    pinMode(CAMERA_CS, OUTPUT);
+    digitalWrite(CAMERA_CS, HIGH);
+    SPI.begin();
+
+    // SPI 연결 확인 (테스트 레지스터 쓰고 다시 읽기)
+    cam.write_reg(ARDUCHIP_TEST1, 0x55);
+    if (cam.read_reg(ARDUCHIP_TEST1) != 0x55) {
+        Serial.println("카메라 초기화 실패! SPI 연결 확인 필요 (CS=9)");
+        return false;
+    }
+
+    // 센서 설정은 SCCB(Wire) 레지스터 테이블 (약 0.1 s 블로킹, 부팅 때 한 번)
+    cam.set_format(JPEG);
+    cam.InitCAM();
+    cam.OV2640_set_JPEG_size(OV2640_320x240);
+    cam.clear_fifo_flag();
+
+    Serial.println("카메라 초기화 성공!");
+    return true;
+}
+
+void ArduCamDevice::startCapture() {
+    cam.flush_fifo();
+    cam.clear_fifo_flag();
+    cam.start_capture();
+}
+
+bool ArduCamDevice::captureDone(uint32_t& length) {
+    if (!cam.get_bit(ARDUCHIP_TRIG, CAP_DONE_MASK)) return false;
+    length = cam.read_fifo_length();
+    return true;
+}
+
+void ArduCamDevice::beginRead() {
+    // 버스트 읽기 동안 CS 유지
+    SPI.beginTransaction(settings);
+    cam.CS_LOW();
+    cam.set_fifo_burst();
+}
+
+void ArduCamDevice::startRead(uint8_t* destination, size_t length) {
+    readDestination = destination;
+    readLength = length;
+    transferDone = false;
+    SPI.transfer(nullptr, destination, length, transferEvent);
+}
+
+bool ArduCamDevice::readDone() {
+    if (!transferDone) return false;
+
+    // DMA가 쓴 영역의 캐시 라인 무효화 (OCRAM/PSRAM은 캐시됨)
+    arm_dcache_delete(readDestination, readLength);
+    return true;
+}
+
+void ArduCamDevice::endRead() {
+    cam.CS_HIGH();
+    SPI.endTransaction();
+    cam.clear_fifo_flag();
+}
+
+void ArduCamDevice::discard() {
+    cam.clear_fifo_flag();
+}
+
+#else
+
+FakeCameraDevice::FakeCameraDevice(uint32_t captureTimeUs, uint32_t minBytes, uint32_t maxBytes, float readBytesPerUs) {
+    captureUs = captureTimeUs;
+    minLength = minBytes;
+    maxLength = maxBytes;
+    bytesPerUs = readBytesPerUs;
+
+    sequence = 0;
+    frameLength = 0;
+    readyAt = 0;
+    capturing = false;
+    readOffset = 0;
+}
+
+void FakeCameraDevice::startCapture() {
+    sequence++;
+    frameLength = minLength + (sequence * 2654435761u) % (maxLength - minLength + 1);
+    readyAt = halMicros() + captureUs;
+    capturing = true;
+}
+
+bool FakeCameraDevice::captureDone(uint32_t& length) {
+    if (!capturing || (int32_t)(halMicros() - readyAt) < 0) return false;
+    length = frameLength;
+    return true;
+}
+
+void FakeCameraDevice::startRead(uint8_t* destination, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        destination[i] = patternByte(sequence, readOffset + i);
+    }
+    readOffset += length;
+    readyAt = halMicros() + (uint32_t)(length / bytesPerUs);
+}
+
+bool FakeCameraDevice::readDone() {
+    return (int32_t)(halMicros() - readyAt) >= 0;
+}
+
+#endif
+
+// ---- 캡처기 ----
+
+Camera::Camera() {
+    device = nullptr;
+    memset(frames, 0, sizeof(frames));
+    frameCount = 0;
+    frameSize = 0;
+
+    phase = PHASE_IDLE;
+    ready = false;
+    recording = false;
+    intervalUs = 0;
+    nextCaptureAt = 0;
+    captureStartedAt = 0;
+
+    current = 0;
+    readOffset = 0;
+    readLength = 0;
+
+    sequence = 0;
+    framesCaptured = 0;
+    framesDropped = 0;
+    framesOversize = 0;
+    captureTimeouts = 0;
+    framesReleased = 0;
+    lastLatencyUs = 0;
+    maxLatencyUs = 0;
+    totalLatencyUs = 0;
+}
+
+bool Camera::begin(CameraDevice* camera, uint8_t* memory, size_t bufferSize, uint8_t count) {
+    if (!camera || !memory || count == 0 || count > CAMERA_MAX_FRAMES) return false;
+    if (bufferSize <= CAMERA_HEADER_SIZE || bufferSize % LOG_SECTOR_SIZE != 0) return false;
+
+    device = camera;
+    frameSize = bufferSize;
+    frameCount = count;
+    for (uint8_t i = 0; i < count; i++) {
+        frames[i].buffer = memory + (size_t)i * bufferSize;
+        freeFrames.push(i);
+    }
+
+    ready = device->begin();
+    return ready;
+}
+
+void Camera::start(uint32_t captureIntervalUs) {
+    intervalUs = captureIntervalUs;
+    nextCaptureAt = halMicros();
+    recording = true;
+}
+
+void Camera::service() {
+    if (!ready) return;
+    uint32_t now = halMicros();
+
+    switch (phase) {
+        case PHASE_IDLE:
+            if (!recording || (int32_t)(now - nextCaptureAt) < 0) return;
+            device->startCapture();
+            captureStartedAt = now;
+            nextCaptureAt = now + intervalUs;
+            phase = PHASE_CAPTURE;
+            return;
+
+        case PHASE_CAPTURE: {
+            uint32_t length;
+            if (!device->captureDone(length)) {
+                if (now - captureStartedAt > CAMERA_CAPTURE_TIMEOUT_US) {
+                    captureTimeouts++;
+                    device->discard();
+                    phase = PHASE_IDLE;
+                }
+                return;
+            }
+
+            // 버린 프레임도 순번은 증가 (기록 파일에서 빈 순번 = 손실)
+            sequence++;
+            if (length == 0 || length > frameSize - CAMERA_HEADER_SIZE) {
+                framesOversize++;
+                device->discard();
+                phase = PHASE_IDLE;
+                return;
+            }
+            if (!freeFrames.pop(current)) {
+                framesDropped++;
+                device->discard();
+                phase = PHASE_IDLE;
+                return;
+            }
+
+            CameraFrame& frame = frames[current];
+            frame.sequence = sequence;
+            frame.capturedAt = now;
+            frame.length = length;
+
+            readOffset = 0;
+            readLength = length < CAMERA_READ_CHUNK ? length : CAMERA_READ_CHUNK;
+            device->beginRead();
+            device->startRead(frame.buffer + CAMERA_HEADER_SIZE, readLength);
+            phase = PHASE_READ;
+            return;
+        }
+
+        case PHASE_READ: {
+            if (!device->readDone()) return;
+
+            CameraFrame& frame = frames[current];
+            readOffset += readLength;
+            if (readOffset < frame.length) {
+                uint32_t remaining = frame.length - readOffset;
+                readLength = remaining < CAMERA_READ_CHUNK ? remaining : CAMERA_READ_CHUNK;
+                device->startRead(frame.buffer + CAMERA_HEADER_SIZE + readOffset, readLength);
+                return;
+            }
+
+            device->endRead();
+            finishFrame();
+            phase = PHASE_IDLE;
+            return;
+        }
+    }
+}
+
+void Camera::finishFrame() {
+    CameraFrame& frame = frames[current];
+
+    // 섹터 배수로 0 패딩 (기록이 항상 섹터 정렬로 이어지도록)
+    uint32_t used = CAMERA_HEADER_SIZE + frame.length;
+    frame.storedSize = (used + LOG_SECTOR_SIZE - 1) / LOG_SECTOR_SIZE * LOG_SECTOR_SIZE;
+    memset(frame.buffer + used, 0, frame.storedSize - used);
+
+    CameraFrameHeader header;
+    header.magic = CAMERA_FRAME_MAGIC;
+    header.sequence = frame.sequence;
+    header.timestamp = frame.capturedAt;
+    header.length = frame.length;
+    header.storedSize = frame.storedSize;
+    memset(frame.buffer, 0, CAMERA_HEADER_SIZE);
+    memcpy(frame.buffer, &header, sizeof(header));
+
+    // 인덱스는 풀 크기만큼만 돌므로 큐가 넘치지 않음
+    fullFrames.push(current);
+    framesCaptured++;
+}
+
+CameraFrame* Camera::acquire() {
+    uint8_t index;
+    if (!fullFrames.pop(index)) return nullptr;
+    return &frames[index];
+}
+
+void Camera::release(CameraFrame* frame) {
+    lastLatencyUs = halMicros() - frame->capturedAt;
+    if (lastLatencyUs > maxLatencyUs) maxLatencyUs = lastLatencyUs;
+    totalLatencyUs += lastLatencyUs;
+    framesReleased++;
+
+    freeFrames.push((uint8_t)(frame - frames));
+}
+
+// ---- 기록기 ----
+
+CameraRecorder::CameraRecorder() {
+    backend = nullptr;
+    camera = nullptr;
+    active = false;
+    path[0] = '\0';
+
+    writing = nullptr;
+    writeOffset = 0;
+
+    framesWritten = 0;
+    writeErrors = 0;
+    bytesWritten = 0;
+    maxWriteMicros = 0;
+    busySkips = 0;
+
+    unsynced = false;
+    lastSyncMicros = 0;
+}
+
+bool CameraRecorder::begin(LogBackend* storage, const char* base, const char* extension, Camera* source) {
+    backend = storage;
+    camera = source;
+    active = camera && openNextFree(backend, base, extension, CAMERA_PREALLOCATE, path, sizeof(path));
+    lastSyncMicros = halMicros();
+    return active;
+}
+
+bool CameraRecorder::writeChunk() {
+    if (writing == nullptr) {
+        writing = camera->acquire();
+        writeOffset = 0;
+        if (writing == nullptr) return false;
+    }
+
+    // 프레임 버퍼에서 바로 기록 (복사 없음)
+    uint32_t remaining = writing->storedSize - writeOffset;
+    uint32_t count = remaining < CAMERA_WRITE_CHUNK ? remaining : CAMERA_WRITE_CHUNK;
+
+    uint32_t start = halMicros();
+    size_t written = backend->write(writing->buffer + writeOffset, count);
+    uint32_t elapsed = halMicros() - start;
+    if (elapsed > maxWriteMicros) maxWriteMicros = elapsed;
+
+    if (written != count) {
+        // 다음 호출에서 같은 청크 재시도
+        writeErrors++;
+        return true;
+    }
+
+    bytesWritten += count;
+    writeOffset += count;
+    unsynced = true;
+
+    if (writeOffset == writing->storedSize) {
+        camera->release(writing);
+        writing = nullptr;
+        framesWritten++;
+
+        if (framesWritten % CAMERA_SYNC_INTERVAL == 0) {
+            backend->sync();
+            unsynced = false;
+            lastSyncMicros = halMicros();
+        }
+    }
+    return true;
+}
+
+void CameraRecorder::service() {
+    if (!active) return;
+
+    if (backend->isBusy()) {
+        busySkips++;
+        return;
+    }
+    if (writeChunk()) return;
+
+    // 촬영 간격이 길어도 기록한 프레임은 1초 안에 디렉터리에 반영
+    if (unsynced && halMicros() - lastSyncMicros >= CAMERA_SYNC_PERIOD_US) {
+        backend->sync();
+        unsynced = false;
+        lastSyncMicros = halMicros();
+    }
+}
+
+void CameraRecorder::end() {
+    if (!active) return;
+
+    // 기록 중/대기 중인 프레임 전부 (오류가 계속되면 포기)
+    uint32_t errorLimit = writeErrors + 8;
+    do {
+        writeChunk();
+    } while ((writing != nullptr || camera->getQueuedFrames() > 0) && writeErrors < errorLimit);
+
+    backend->sync();
+    backend->close();
+    active = false;
+}
@@ -0,0 +1,146 @@
+// src/Filter.cpp
+#include "Filter.h"
+#include <string.h>
+
+Filter::Filter() {
+    altitude = 0.0;
+    velocity = 0.0;
+    bias = 0.0;
+    memset(P, 0, sizeof(P));
+
+    fixedGain = false;
+    gain[0] = gain[1] = gain[2] = 0.0;
+    initialized = false;
+
+    configure(FILTER_ACCEL_NOISE, FILTER_BIAS_NOISE, FILTER_ALTITUDE_NOISE);
+}
+
+void Filter::configure(float accelNoise, float biasNoise, float altitudeNoise) {
+    accelVariance = accelNoise * accelNoise;
+    biasVariance = biasNoise * biasNoise;
+    altitudeVariance = altitudeNoise * altitudeNoise;
+}
+
+void Filter::begin(float initialAltitude) {
+    altitude = initialAltitude;
+    velocity = 0.0;
+    bias = 0.0;
+    resetCovariance();
+    initialized = true;
+}
+
+void Filter::resetCovariance() {
+    // 초기 불확실성
+    memset(P, 0, sizeof(P));
+    P[0][0] = altitudeVariance;
+    P[1][1] = 1.0;
+    P[2][2] = 0.25;
+}
+
+void Filter::predictCovariance(float dt) {
+    // F = [1 dt -dt²/2; 0 1 -dt; 0 0 1]
+    float halfDt2 = 0.5f * dt * dt;
+    float F[3][3] = {
+        { 1.0f, dt,   -halfDt2 },
+        { 0.0f, 1.0f, -dt },
+        { 0.0f, 0.0f, 1.0f }
+    };
+
+    // FP
+    float FP[3][3];
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            FP[i][j] = F[i][0] * P[0][j] + F[i][1] * P[1][j] + F[i][2] * P[2][j];
+        }
+    }
+
+    // FPFᵀ
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            P[i][j] = FP[i][0] * F[j][0] + FP[i][1] * F[j][1] + FP[i][2] * F[j][2];
+        }
+    }
+
+    // Q = σa² G Gᵀ (G = [dt²/2, dt, 0]) + 바이어스 랜덤워크
+    P[0][0] += accelVariance * halfDt2 * halfDt2;
+    P[0][1] += accelVariance * halfDt2 * dt;
+    P[1][0] += accelVariance * halfDt2 * dt;
+    P[1][1] += accelVariance * dt * dt;
+    P[2][2] += biasVariance * dt;
+}
+
+void Filter::updateCovariance(float k[3]) {
+    // H = [1 0 0]
+    float innovationVariance = P[0][0] + altitudeVariance;
+    for (uint8_t i = 0; i < 3; i++) {
+        k[i] = P[i][0] / innovationVariance;
+    }
+
+    // P = (I - KH) P
+    float row0[3] = { P[0][0], P[0][1], P[0][2] };
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            P[i][j] -= k[i] * row0[j];
+        }
+    }
+}
+
+FilterGain Filter::solveFixedGain(float dt, uint8_t predictsPerUpdate) {
+    if (predictsPerUpdate == 0) predictsPerUpdate = 1;
+
+    // 공분산을 정상상태까지 반복 (사용 중인 공분산은 보관 후 복원)
+    float saved[3][3];
+    memcpy(saved, P, sizeof(P));
+    resetCovariance();
+
+    FilterGain result = { { 0.0f, 0.0f, 0.0f } };
+    for (uint16_t iteration = 0; iteration < 2000; iteration++) {
+        for (uint8_t i = 0; i < predictsPerUpdate; i++) {
+            predictCovariance(dt);
+        }
+        updateCovariance(result.k);
+    }
+
+    memcpy(P, saved, sizeof(P));
+    return result;
+}
+
+void Filter::setFixedGain(const FilterGain& fixed) {
+    gain[0] = fixed.k[0];
+    gain[1] = fixed.k[1];
+    gain[2] = fixed.k[2];
+    fixedGain = true;
+}
+
+void Filter::predict(float accelUp, float dt) {
+    if (!initialized || dt <= 0.0f) return;
+
+    float a = accelUp - bias;
+    altitude += velocity * dt + 0.5f * a * dt * dt;
+    velocity += a * dt;
+
+    if (!fixedGain) {
+        predictCovariance(dt);
+    }
+}
+
+void Filter::update(float measuredAltitude) {
+    if (!initialized) {
+        begin(measuredAltitude);
+        return;
+    }
+
+    float k[3];
+    if (fixedGain) {
+        k[0] = gain[0];
+        k[1] = gain[1];
+        k[2] = gain[2];
+    } else {
+        updateCovariance(k);
+    }
+
+    float innovation = measuredAltitude - altitude;
+    altitude += k[0] * innovation;
+    velocity += k[1] * innovation;
+    bias += k[2] * innovation;
+}
@@ -0,0 +1,555 @@
+// src/Flight.cpp
+#include "Flight.h"
+
+// ---- 장치 ----
+
+#ifdef ARDUINO
+// 버스
+WireBus baroBus(Wire);
+SerialPort gpsPort(Serial1);
+SerialPort radioPort(Serial2);
+
+// BNO085 (Wire1 I2C 또는 SPI, 빌드 플래그)
+Bno08xDevice imuDevice;
+
+// 내장 SD 슬롯 (비행 기록, 프레임 기록 파일마다 하나)
+SdFatBackend sdCard;
+SdFatBackend frameCard;
+
+// ArduCAM SPI DMA, 프레임 버퍼 풀 256KB는 OCRAM (DMAMEM), PSRAM을 달았으면 EXTMEM으로 옮겨도 됨
+DMAMEM uint8_t cameraPool[CAMERA_MAX_FRAMES * CAMERA_FRAME_SIZE] __attribute__((aligned(32)));
+ArduCamDevice cameraDevice;
+
+// 재시작 복구 저널 (EEPROM)
+EepromStore recoveryStore;
+#else
+// 호스트: 같은 비행 코드를 가짜 장치로 (재생 하네스가 환경 값을 넣고 시계를 진행)
+FakeBmp390Bus baroBus;
+LoopbackPort gpsPort;
+LoopbackPort radioPort;
+FakeSh2Device imuDevice;
+MemoryLogBackend sdCard;
+MemoryLogBackend frameCard;
+alignas(32) uint8_t cameraPool[CAMERA_MAX_FRAMES * CAMERA_FRAME_SIZE];
+FakeCameraDevice cameraDevice(40000, 8000, 24000, 1.0f);    // 캡처 40 ms, 8~24KB, SPI 8 MHz
+MemoryStore recoveryStore;
+#endif
+
+// 센서 객체 생성
+BMP390 bmp(&baroBus);
+BNO085 imu(&imuDevice);
+GPS gps(&gpsPort);
+
+// 패킷 객체 생성
+Packet telemetry;
+
+// 지상국 무선 링크 (XBee, API 모드 2)
+XBee radio(&radioPort);
+
+// 지상국 명령
+CommandParser commands;
+bool telemetryEnabled = true;
+bool simulationEnabled = false;     // SIM ENABLE 다음 ACTIVATE여야 시뮬레이션 모드
+
+// 시뮬레이션 모드 기압 (SIMP 수신 시각과 함께 BMP390 경로로 주입)
+InjectedPressureSource simulatedPressure;
+
+// 비행 기록 (내장 SD 슬롯)
+SDLogger logger;
+
+// 하강 촬영 (카메라 -> 프레임 버퍼 풀 -> 별도 파일)
+Camera camera;
+CameraRecorder frameRecorder;
+
+// 재시작 복구 저널
+Recovery recovery;
+
+// 고도/수직속도 필터
+Filter altitudeFilter;
+StateMachine flightState;
+
+// 비행 단계별 센서 주기
+Mode rates;
+uint32_t lastImuTimestamp = 0;
+uint32_t lastBaroTimestamp = 0;
+
+// 태스크 함수
+void imuTask() {
+    imu.update();
+    
+    // 새 IMU 샘플마다 필터 예측 (월드 좌표계 수직 가속도 - 중력)
+    Sample<ImuSample> batch[8];
+    size_t count = imu.getSamples().range(lastImuTimestamp + 1, halMicros(), batch, 8);
+    for (size_t i = 0; i < count; i++) {
+        const ImuSample& s = batch[i].value;
+        LogImuRecord record = { s.accel.x, s.accel.y, s.accel.z, s.quat.x, s.quat.y, s.quat.z, s.quat.w };
+        logger.logImu(batch[i].timestamp, record);
+        
+        if (lastImuTimestamp != 0) {
+            float dt = (batch[i].timestamp - lastImuTimestamp) * 1e-6f;
+            altitudeFilter.predict(rotateZ(s.quat, s.accel) - GRAVITY, dt);
+        }
+        lastImuTimestamp = batch[i].timestamp;
+    }
+}
+
+// 분리 후 탐사체 회전 감쇠 (요 각속도 -> 꼬리날개 서보)
+// 핀 22 = FlexPWM4 SM0 A: 주파수는 서브모듈 단위라 같은 서브모듈 핀의 PWM도 200 Hz가 됨
+const uint8_t SPIN_SERVO_PIN = 22;
+const uint16_t SPIN_SERVO_HZ = 200;             // 디지털 서보 전용 (아날로그 서보면 SERVO_PWM_HZ)
+const uint32_t CONTROL_PERIOD_US = 5000;        // 200 Hz (서보 PWM 주기와 같음)
+const uint32_t CONTROL_STALE_US = 20000;        // IMU 샘플이 이보다 오래되면 중립
+const PIDGains SPIN_GAINS = { 0.015f, 0.01f, 0.0005f, 20.0f, -1.0f, 1.0f };  // °/s -> 정규화 서보 위치
+
+ServoDriver spinServo;
+PID spinControl;
+bool spinControlEnabled = true;     // MEC,SPIN,ON|OFF
+bool spinControlActive = false;
+
+void controlTask() {
+    PROFILE_SCOPE(PROBE_CONTROL);
+    
+    Sample<ImuSample> latest;
+    bool active = spinControlEnabled && flightState.getState() == STATE_PROBE_RELEASE &&
+                  imu.getSamples().latest(latest) && halMicros() - latest.timestamp < CONTROL_STALE_US;
+    
+    // 비활성화되면 중립으로 한 번만 되돌리고, 다시 시작할 때는 적분 없이 시작
+    if (!active) {
+        if (spinControlActive) {
+            spinServo.write(0.0f);
+            spinControl.reset();
+            spinControlActive = false;
+        }
+        return;
+    }
+    
+    spinControlActive = true;
+    spinServo.write(spinControl.update(0.0f, latest.value.rate.z * QM_RAD_TO_DEG));
+}
+
+Scheduler scheduler(halMicros);
+bool schedulerStarted = false;
+
+void bmpTask() {
+    if (!bmp.update()) return;
+    
+    // 새 기압 샘플마다 필터 보정 (시뮬레이션 모드에서는 한 주기에 여러 개가 들어올 수 있음)
+    Sample<BaroSample> batch[PRESSURE_INJECT_RING_SIZE];
+    size_t count = bmp.getSamples().range(lastBaroTimestamp + 1, halMicros(), batch, PRESSURE_INJECT_RING_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        const BaroSample& baro = batch[i].value;
+        altitudeFilter.update(baro.altitude);
+        
+        // 보정된 고도/속도로 비행 상태 판정 (BMP 샘플마다 한 번)
+        telemetry.setState(flightState.update(altitudeFilter.getAltitude(), altitudeFilter.getVelocity(), batch[i].timestamp));
+        
+        LogBaroRecord record = { baro.pressure, baro.temperature, baro.altitude };
+        logger.logBaro(batch[i].timestamp, record);
+        lastBaroTimestamp = batch[i].timestamp;
+    }
+}
+
+void gpsTask() { gps.update(); }
+
+// 부팅 -> 첫 패킷 시간 (리셋 기준 us, 0 = 아직 없음)
+uint32_t firstPacketMicros = 0;
+
+void telemetryTask() {
+    if (!telemetryEnabled) return;
+    telemetry.transmit();
+    if (firstPacketMicros == 0) firstPacketMicros = halMicros();
+}
+// 착륙하면 남은 기록을 모두 쓰고 파일을 닫음 (전원 차단 전에 디렉터리 엔트리 확정)
+void logTask() {
+    if (flightState.getState() == STATE_LANDED && logger.isActive()) {
+        logger.end();
+        return;
+    }
+    logger.service();
+}
+
+// 정점부터 분리까지 촬영 (최대 10 fps)
+const uint32_t CAMERA_INTERVAL_US = 100000;
+
+void cameraTask() {
+    FlightState state = flightState.getState();
+    bool descending = state >= STATE_APOGEE && state <= STATE_PROBE_RELEASE;
+    if (descending && !camera.isRecording()) camera.start(CAMERA_INTERVAL_US);
+    if (!descending && camera.isRecording()) camera.stop();
+    camera.service();
+}
+void frameTask() {
+    if (flightState.getState() == STATE_LANDED && frameRecorder.isActive()) {
+        frameRecorder.end();
+        return;
+    }
+    frameRecorder.service();
+}
+
+// 명령 한 바이트 처리 (무선/USB 공통), 실행되면 에코 갱신
+void feedCommand(char c) {
+    if (commands.feed(c)) telemetry.setCommandEcho(commands.getEcho());
+}
+
+void onRadioReceive(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) feedCommand((char)data[i]);
+}
+
+// 비행 단계 전환 (BMP 태스크 주기를 바꾸므로 태스크 테이블 아래에 정의)
+void modeTask();
+
+void radioTask() {
+    radio.service();
+    
+    // 지상 시험용 USB 콘솔 명령
+    while (Serial.available() > 0) feedCommand((char)Serial.read());
+}
+
+// 재시작 시 이어갈 상태 저장 (상태/명령 등이 바뀌면 바로, 아니면 1분마다 기록)
+void recoveryTask() {
+    RecoverySnapshot snapshot;
+    snapshot.packetCount = telemetry.getPacketCount();
+    snapshot.missionElapsedMs = telemetry.getMissionElapsed();
+    snapshot.groundPressure = bmp.getGroundPressure();
+    snapshot.state = flightState.getState();
+    snapshot.mode = telemetry.getMode();
+    copyString(snapshot.lastCommand, telemetry.getCommandEcho(), sizeof(snapshot.lastCommand));
+    recovery.save(snapshot);
+}
+
+// GPS 원문을 그대로 기록
+void onGpsSentence(const char* sentence, uint32_t timestamp) {
+    logger.logGps(timestamp, sentence);
+}
+
+#ifdef FSW_PROFILING
+// 프로브 통계를 진단 패킷으로 출력
+void diagnosticsTask() {
+    char line[TELEMETRY_MAX_LEN];
+    size_t length = Profiler::formatDiagnostics(line, sizeof(line));
+    Serial.write((const uint8_t*)line, length);
+    Serial.println();
+    
+    // 현재 프로필의 CPU/기압 I2C 점유율 (직전 진단 이후)
+    static uint32_t lastDiagnostics = 0;
+    uint32_t now = halMicros();
+    CSVWriter load(line, sizeof(line));
+    load.appendString("LOAD");                                        load.separator();
+    load.appendString(rates.getProfile().name);                       load.separator();
+    load.appendFloat(scheduler.getCpuLoad() * 100.0f, 1);             load.separator();
+    load.appendFloat(baroBus.getUtilization(400000, now - lastDiagnostics) * 100.0f, 2);
+    Serial.write((const uint8_t*)line, load.size());
+    Serial.println();
+    
+    scheduler.resetStats();
+    baroBus.resetCounters();
+    lastDiagnostics = now;
+}
+#endif
+
+// ---- 명령 핸들러 ----
+
+// ON/OFF 인자 해석
+bool parseSwitch(const char* arg, bool& on) {
+    if (strcmp(arg, "ON") == 0) on = true;
+    else if (strcmp(arg, "OFF") == 0) on = false;
+    else return false;
+    return true;
+}
+
+// 두 자리 숫자 (limit 이상이면 false)
+bool parseTwoDigits(const char* s, uint8_t limit, uint32_t& out) {
+    if (s[0] < '0' || s[0] > '9' || s[1] < '0' || s[1] > '9') return false;
+    out = (s[0] - '0') * 10 + (s[1] - '0');
+    return out < limit;
+}
+
+// CX,ON|OFF: 텔레메트리 송신 켜기/끄기
+bool commandCX(const CommandArgs& args) {
+    return parseSwitch(args.argv[0], telemetryEnabled);
+}
+
+// ST,hh:mm:ss|GPS: 미션 시계 맞춤
+bool commandST(const CommandArgs& args) {
+    const char* t = args.argv[0];
+    char gpsTime[TELEMETRY_TIME_LEN];
+    
+    if (strcmp(t, "GPS") == 0) {
+        if (!gps.hasFix()) return false;
+        gps.getTimeString(gpsTime);
+        t = gpsTime;
+    }
+    
+    uint32_t hours, minutes, seconds;
+    if (strlen(t) != 8 || t[2] != ':' || t[5] != ':') return false;
+    if (!parseTwoDigits(t, 24, hours) || !parseTwoDigits(t + 3, 60, minutes) || !parseTwoDigits(t + 6, 60, seconds)) return false;
+    
+    telemetry.setMissionTime(((hours * 60 + minutes) * 60 + seconds) * 1000);
+    return true;
+}
+
+// SIM,ENABLE|ACTIVATE|DISABLE: 시뮬레이션 모드 (ENABLE 다음 ACTIVATE)
+bool commandSIM(const CommandArgs& args) {
+    const char* action = args.argv[0];
+    if (strcmp(action, "ENABLE") == 0) {
+        simulationEnabled = true;
+    } else if (strcmp(action, "ACTIVATE") == 0) {
+        if (!simulationEnabled) return false;
+        simulatedPressure.resetStats();
+        bmp.setSource(&simulatedPressure);
+        telemetry.setMode('S');
+    } else if (strcmp(action, "DISABLE") == 0) {
+        simulationEnabled = false;
+        bmp.setSource(nullptr);
+        telemetry.setMode('F');
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// SIMP,<Pa>: 시뮬레이션 기압 (시뮬레이션 모드에서만)
+bool commandSIMP(const CommandArgs& args) {
+    if (telemetry.getMode() != 'S') return false;
+    
+    const char* p = args.argv[0];
+    if (*p == '\0') return false;
+    
+    uint32_t pascals = 0;
+    for (; *p; p++) {
+        if (*p < '0' || *p > '9' || pascals > 1000000) return false;
+        pascals = pascals * 10 + (*p - '0');
+    }
+    return simulatedPressure.inject(pascals / 100.0f, halMicros());
+}
+
+// CAL: 현재 위치를 고도 0으로 (이후 BMP 샘플 평균), 비행 상태/저널 초기화
+bool commandCAL(const CommandArgs& args) {
+    (void)args;
+    bmp.calibrateAltitude(50);
+    flightState.reset();
+    telemetry.setState(flightState.getState());
+    recovery.clear();
+    return true;
+}
+
+// MEC,<장치>,ON|OFF: 기구 수동 동작 (SPIN: 회전 감쇠 제어)
+bool commandMEC(const CommandArgs& args) {
+    if (strcmp(args.argv[0], "SPIN") == 0) return parseSwitch(args.argv[1], spinControlEnabled);
+    return false;
+}
+
+// 명령 테이블: 이름, 핸들러, 최소/최대 인자 수 (이름 오름차순 - 이진 탐색)
+constexpr CommandSpec COMMANDS[] = {
+    { "CAL",  commandCAL,  0, 0 },
+    { "CX",   commandCX,   1, 1 },
+    { "MEC",  commandMEC,  2, 2 },
+    { "SIM",  commandSIM,  1, 1 },
+    { "SIMP", commandSIMP, 1, 1 },
+    { "ST",   commandST,   1, 1 },
+};
+const uint8_t COMMAND_COUNT = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+static_assert(commandTableSorted(COMMANDS, COMMAND_COUNT), "COMMANDS must be sorted by name");
+
+// 태스크 테이블: 이름, 함수, 주기(us), 우선순위, 마감(us)
+constexpr TaskConfig TASKS[] = {
+    { "IMU",       imuTask,         5000,    0, 2500 },   // 200 Hz
+    { "CONTROL",   controlTask,     CONTROL_PERIOD_US, 0, 1000 },  // IMU 바로 다음 (같은 우선순위는 테이블 순서)
+    { "BMP",       bmpTask,         10000,   1, 5000 },   // 센서 ODR의 두 배로 폴링 (Mode가 변경)
+    { "TELEMETRY", telemetryTask,   1000000, 2, 50000 },  // 1 Hz
+    { "RECOVERY",  recoveryTask,    1000000, 4, 0 },      // 1 Hz
+    { "MODE",      modeTask,        10000,   4, 0 },      // 100 Hz (단계 전환 후 30 ms 안에 세 장치 설정)
+    { "GPS",       gpsTask,         0,       3, 0 },      // 연속 (UART 드레인)
+    { "XBEE",      radioTask,       1000,    3, 0 },      // 1 ms마다 송신 버퍼 채우기 (115200 baud = 11.5 B/ms)
+    { "LOG",       logTask,         2000,    5, 0 },      // 청크 2KB씩, 최대 1MB/s
+    { "CAMERA",    cameraTask,      1000,    3, 0 },      // 캡처 완료/DMA 청크(4KB, 8 MHz에서 약 4 ms) 확인
+    { "FRAMES",    frameTask,       2000,    5, 0 },      // 청크 4KB씩, 최대 2MB/s
+#ifdef FSW_PROFILING
+    { "DIAG",      diagnosticsTask, 10000000, 6, 0 },     // 0.1 Hz
+#endif
+};
+constexpr uint8_t TASK_COUNT = sizeof(TASKS) / sizeof(TASKS[0]);
+constexpr uint8_t TASK_BMP = taskIndex(TASKS, TASK_COUNT, "BMP");
+static_assert(TASK_BMP < TASK_COUNT, "TASKS must contain BMP");
+
+// 비행 단계가 바뀌면 센서 주기 전환 (바뀐 장치는 호출마다 하나씩 설정)
+void modeTask() {
+    if (rates.update(flightState.getState())) {
+        scheduler.setPeriod(TASK_BMP, rates.getProfile().baroPollUs());
+    }
+}
+
+// ---- 부팅 ----
+
+// 비행 중 재시작 여부 (flightSetup에서 저널을 보고 결정)
+bool warmStart = false;
+
+InitStatus bmpInit() { return bmp.beginStep(); }
+InitStatus imuInit() { return imu.beginStep(warmStart); }
+InitStatus gpsInit() { return gps.beginStep(); }
+
+InitStatus logInit() {
+    // 재시작해도 이전 기록을 덮어쓰지 않도록 항상 새 번호 파일
+    if (!logger.begin(&sdCard, "flight", ".bin")) {
+        Serial.println("SD 로거 초기화 실패! 카드 확인 필요");
+        return INIT_FAILED;
+    }
+    Serial.print("SD 로거 초기화 성공! ");
+    Serial.println(logger.getPath());
+    gps.setSentenceHandler(onGpsSentence);
+    return INIT_READY;
+}
+
+// 센서 설정에 Wire(SCCB)를 쓰므로 BMP 단계가 버스를 연 다음 (테이블 순서), 약 0.1 s 블로킹
+InitStatus cameraInit() {
+    if (!camera.begin(&cameraDevice, cameraPool, CAMERA_FRAME_SIZE, CAMERA_MAX_FRAMES)) return INIT_FAILED;
+    if (!frameRecorder.begin(&frameCard, "frames", ".frm", &camera)) {
+        Serial.println("프레임 기록 파일 열기 실패!");
+        return INIT_FAILED;
+    }
+    return INIT_READY;
+}
+
+// 초기화 테이블: 이름, 단계 함수, 제한 시간(us)
+// 버스가 서로 달라서 (Wire, Wire1, Serial1, SDIO, SPI) 번갈아 진행해도 간섭 없음
+const BootStep BOOT_STEPS[] = {
+    { "BMP", bmpInit, 100000 },
+    { "IMU", imuInit, 2500000 },     // 안정화 0.5 s + 재시도 최대 3회
+    { "GPS", gpsInit, 100000 },
+    { "SD",  logInit, 1000000 },
+    { "CAM", cameraInit, 1000000 },
+};
+const uint8_t BOOT_STEP_COUNT = sizeof(BOOT_STEPS) / sizeof(BOOT_STEPS[0]);
+
+BootSequencer boot(halMicros);
+bool bootReported = false;
+
+bool anySensorReady() {
+    return bmp.isInitialized() || imu.isInitialized() || gps.isInitialized();
+}
+
+// 부팅 결과와 첫 패킷 시각 보고 (한 번)
+void reportBoot() {
+    char line[TELEMETRY_MAX_LEN];
+    size_t length = boot.formatReport(line, sizeof(line), firstPacketMicros);
+    Serial.write((const uint8_t*)line, length);
+    Serial.println();
+}
+
+void flightSetup() {
+    // 비행 중 재시작이면 캘리브레이션 없이 저장된 상태로 이어서 진행
+    RecoverySnapshot snapshot;
+    recovery.begin(&recoveryStore);
+    warmStart = recovery.load(snapshot) &&
+                snapshot.state >= STATE_ASCENT && snapshot.state <= STATE_PROBE_RELEASE;
+    
+    Serial.println("=== Teensy 4.1 CanSat FSW ===");
+    if (warmStart) Serial.println("*** 웜 스타트 (저널 복원) ***");
+    Serial.println();
+    
+    Profiler::begin();
+    
+    radio.begin(XBEE_BAUD);
+    radio.setReceiveHandler(onRadioReceive);
+    commands.begin(COMMANDS, COMMAND_COUNT);
+    
+    // 고도 캘리브레이션 (선택사항)
+    // bmp.calibrateAltitude(100);
+    
+    // 회전 감쇠 제어 (고정 dt로 계수 미리 계산)
+    spinControl.configure(SPIN_GAINS, CONTROL_PERIOD_US * 1e-6f);
+    spinServo.begin(SPIN_SERVO_PIN, SPIN_SERVO_HZ);
+    
+    // 패킷 시스템에 센서 연결
+    telemetry.attachSensors(&bmp, &imu, &gps);
+    telemetry.attachRadio(&radio);
+    
+    // 센서 주기와 필터 고정 이득은 현재 단계 프로필로 시작 (초기화 전이면 각 드라이버가 begin에서 적용)
+    rates.begin(&bmp, &imu, &gps, &altitudeFilter, warmStart ? (FlightState)snapshot.state : STATE_LAUNCH_PAD);
+    
+    if (warmStart) {
+        // 저장된 기준 기압/상태/카운터로 이어서 진행
+        bmp.setGroundPressure(snapshot.groundPressure);
+        flightState.setState((FlightState)snapshot.state);
+        telemetry.setState((FlightState)snapshot.state);
+        telemetry.setMode(snapshot.mode);
+        telemetry.setCommandEcho(snapshot.lastCommand);
+        telemetry.resumeMission(snapshot.packetCount, snapshot.missionElapsedMs);
+    } else {
+        // 미션 시작 (이전 미션 저널은 무효화)
+        recovery.clear();
+        telemetry.beginMission();
+        
+        // CSV 헤더 출력
+        Serial.println("TEAM_ID,MISSION_TIME,PACKET_COUNT,MODE,STATE,ALTITUDE,TEMPERATURE,ATM_PRESSURE,VOLTAGE,CURRENT,GYRO_R,GYRO_P,GYRO_Y,ACCEL_R,ACCEL_P,ACCEL_Y,GPS_TIME,GPS_ALTITUDE,GPS_LATITUDE,GPS_LONGITUDE,GPS_SATS,CMD_ECHO");
+    }
+    
+    // 센서 초기화는 loop에서 단계별로 진행
+    boot.begin(BOOT_STEPS, BOOT_STEP_COUNT);
+}
+
+void flightLoop() {
+    if (!boot.isDone()) {
+        boot.run();
+    }
+    
+    // 센서가 하나라도 준비되면 스케줄러 시작 (텔레메트리 1Hz 위상은 여기서 고정)
+    if (!schedulerStarted) {
+        if (!anySensorReady() && !boot.isDone()) return;
+        scheduler.begin(TASKS, TASK_COUNT);
+        scheduler.setPeriod(TASK_BMP, rates.getProfile().baroPollUs());
+        schedulerStarted = true;
+    }
+    
+    scheduler.runOnce();
+    
+    if (!bootReported && boot.isDone() && (firstPacketMicros != 0 || !anySensorReady())) {
+        reportBoot();
+        bootReported = true;
+    }
+}
+
+#ifndef ARDUINO
+#include <new>
+
+void flightReset() {
+    // 재생을 여러 번 하기 위해 전역 객체를 다시 생성 (소멸자는 없거나 파일을 쓰지 않음)
+    new (&baroBus) FakeBmp390Bus();
+    new (&gpsPort) LoopbackPort();
+    new (&radioPort) LoopbackPort();
+    new (&imuDevice) FakeSh2Device();
+    new (&sdCard) MemoryLogBackend();
+    new (&frameCard) MemoryLogBackend();
+    new (&cameraDevice) FakeCameraDevice(40000, 8000, 24000, 1.0f);
+    
+    new (&bmp) BMP390(&baroBus);
+    new (&imu) BNO085(&imuDevice);
+    new (&gps) GPS(&gpsPort);
+    new (&telemetry) Packet();
+    new (&radio) XBee(&radioPort);
+    new (&commands) CommandParser();
+    new (&simulatedPressure) InjectedPressureSource();
+    new (&logger) SDLogger();
+    new (&camera) Camera();
+    new (&frameRecorder) CameraRecorder();
+    new (&recovery) Recovery();
+    new (&altitudeFilter) Filter();
+    new (&flightState) StateMachine();
+    new (&rates) Mode();
+    new (&spinServo) ServoDriver();
+    new (&spinControl) PID();
+    new (&scheduler) Scheduler(halMicros);
+    new (&boot) BootSequencer(halMicros);
+    
+    telemetryEnabled = true;
+    simulationEnabled = false;
+    spinControlEnabled = true;
+    spinControlActive = false;
+    lastImuTimestamp = 0;
+    lastBaroTimestamp = 0;
+    firstPacketMicros = 0;
+    schedulerStarted = false;
+    warmStart = false;
+    bootReported = false;
+}
+#endif
@@ -0,0 +1,140 @@
+// src/HAL.cpp
+#include "HAL.h"
+
+#ifndef ARDUINO
+#include <stdio.h>
+#endif
+
+#ifdef ARDUINO
+
+void WireBus::begin(uint32_t clockHz) {
+    wire.begin();
+    wire.setClock(clockHz);
+}
+
+bool WireBus::readRegisters(uint8_t address, uint8_t reg, uint8_t* buffer, size_t length) {
+    transactions++;
+
+    wire.beginTransmission(address);
+    wire.write(reg);
+    if (wire.endTransmission(false) != 0) return false;
+
+    if (wire.requestFrom(address, (uint8_t)length) != length) return false;
+    for (size_t i = 0; i < length; i++) {
+        buffer[i] = wire.read();
+    }
+
+    // 주소(W) + 레지스터 + 주소(R) + 데이터
+    bytesTransferred += 3 + length;
+    return true;
+}
+
+bool WireBus::writeRegister(uint8_t address, uint8_t reg, uint8_t value) {
+    transactions++;
+
+    wire.beginTransmission(address);
+    wire.write(reg);
+    wire.write(value);
+    bool ok = wire.endTransmission() == 0;
+
+    bytesTransferred += 3;
+    return ok;
+}
+
+#else
+
+// ---- 호스트 시뮬레이션 시계 ----
+
+// 64비트로 누적 (millis가 micros와 같이 71분에 넘치지 않도록)
+static uint64_t simulatedMicros = 0;
+
+uint32_t halMicros() {
+    return (uint32_t)simulatedMicros;
+}
+
+uint32_t halMillis() {
+    return (uint32_t)(simulatedMicros / 1000);
+}
+
+void halSetMicros(uint32_t now) {
+    simulatedMicros = now;
+}
+
+void halAdvanceMicros(uint32_t delta) {
+    simulatedMicros += delta;
+}
+
+// ---- 호스트 콘솔 ----
+
+HostConsole Serial;
+
+void HostConsole::printNumber(unsigned long long value, bool negative, int base) {
+    char digits[24];
+    int count = 0;
+    do {
+        int digit = (int)(value % base);
+        digits[count++] = (char)(digit < 10 ? '0' + digit : 'A' + digit - 10);
+        value /= base;
+    } while (value > 0);
+
+    if (negative) print('-');
+    while (count > 0) print(digits[--count]);
+}
+
+void HostConsole::print(const char* text) {
+    if (enabled) fputs(text, stdout);
+}
+
+void HostConsole::print(char c) {
+    if (enabled) fputc(c, stdout);
+}
+
+void HostConsole::print(double value, int digits) {
+    if (enabled) printf("%.*f", digits, value);
+}
+
+size_t HostConsole::write(const uint8_t* data, size_t length) {
+    if (enabled) fwrite(data, 1, length, stdout);
+    return length;
+}
+
+int HostConsole::read() {
+    if (inputHead == inputTail) return -1;
+    return (uint8_t)input[inputTail++ % HOST_CONSOLE_INPUT_SIZE];
+}
+
+void HostConsole::inject(const char* text) {
+    for (; *text && inputHead - inputTail < HOST_CONSOLE_INPUT_SIZE; text++) {
+        input[inputHead++ % HOST_CONSOLE_INPUT_SIZE] = *text;
+    }
+}
+
+// ---- 호스트 루프백 UART ----
+
+int LoopbackPort::read() {
+    if (head == tail) return -1;
+    return buffer[tail++ % LOOPBACK_BUFFER_SIZE];
+}
+
+int LoopbackPort::availableForWrite() {
+    size_t space = LOOPBACK_BUFFER_SIZE - (head - tail);
+    return (int)(space < writeBudget ? space : writeBudget);
+}
+
+size_t LoopbackPort::write(const uint8_t* data, size_t length) {
+    size_t count = (size_t)availableForWrite();
+    if (length < count) count = length;
+    for (size_t i = 0; i < count; i++) {
+        buffer[head++ % LOOPBACK_BUFFER_SIZE] = data[i];
+    }
+    writeBudget -= count;
+    return count;
+}
+
+void LoopbackPort::inject(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length && head - tail < LOOPBACK_BUFFER_SIZE; i++) {
+        buffer[head++ % LOOPBACK_BUFFER_SIZE] = data[i];
+    }
+}
+
+#endif
@@ -0,0 +1,117 @@
+// src/Mode.cpp
+#include "Mode.h"
+#include <string.h>
+
+// 설정할 장치
+#define MODE_DEVICE_BMP     0x01
+#define MODE_DEVICE_IMU     0x02
+#define MODE_DEVICE_GPS     0x04
+#define MODE_DEVICE_FILTER  0x08
+#define MODE_DEVICE_ALL     0x0F
+
+// 단계별 프로필 (FlightState 순서)
+// IMU 최대 주기(BNO085_FAST_INTERVAL_US)는 전송 방식에 따라: SPI 400 Hz, I2C 400 kHz는 200 Hz
+// (I2C는 43 B 패킷을 헤더 + 32 B 청크 두 번, 54 B로 읽어 샘플당 1.2 ms 블로킹 - 400 Hz면 주기의 절반, test_bno085)
+// 목표 400 Hz는 SPI 빌드(-DBNO085_TRANSPORT_SPI)에서만 달성
+// 변환 시간 (데이터시트 3.9.2): 234 + 392 + 2020·2^osr_p + 163 + 2020·2^osr_t us 가 ODR 주기 안에 들어가야 함
+const RateProfile Mode::PROFILES[FLIGHT_STATE_COUNT] = {
+    // 이름              IMU(us)  BMP ODR              압력 OSR        온도 OSR        GPS(Hz)
+    { "PAD",             20000,   BMP390_ODR_25_HZ,    BMP390_OSR_8X,  BMP390_OSR_1X,  1  },  // 발사 감지만
+    { "ASCENT",          BNO085_FAST_INTERVAL_US, BMP390_ODR_100_HZ,   BMP390_OSR_2X,  BMP390_OSR_1X,  10 },  // IMU 400 Hz (I2C 200 Hz)
+    { "APOGEE",          BNO085_FAST_INTERVAL_US, BMP390_ODR_100_HZ,   BMP390_OSR_2X,  BMP390_OSR_1X,  10 },  // IMU 400 Hz (I2C 200 Hz)
+    { "DESCENT",         10000,   BMP390_ODR_50_HZ,    BMP390_OSR_4X,  BMP390_OSR_2X,  10 },
+    { "PROBE_RELEASE",   BNO085_FAST_INTERVAL_US, BMP390_ODR_100_HZ,   BMP390_OSR_2X,  BMP390_OSR_1X,  10 },  // 자세 제어, IMU 400 Hz (I2C 200 Hz)
+    { "LANDED",          100000,  BMP390_ODR_12P5_HZ,  BMP390_OSR_8X,  BMP390_OSR_1X,  1  },  // 위치 보고만
+};
+
+static bool sameRates(const RateProfile& a, const RateProfile& b) {
+    return a.imuIntervalUs == b.imuIntervalUs && a.baroOdr == b.baroOdr &&
+           a.baroPressureOsr == b.baroPressureOsr && a.baroTemperatureOsr == b.baroTemperatureOsr &&
+           a.gpsHz == b.gpsHz;
+}
+
+Mode::Mode() {
+    bmp = nullptr;
+    imu = nullptr;
+    gps = nullptr;
+    filter = nullptr;
+    memset(gains, 0, sizeof(gains));
+
+    state = STATE_LAUNCH_PAD;
+    profile = &PROFILES[STATE_LAUNCH_PAD];
+    pending = 0;
+    changes = 0;
+}
+
+const RateProfile& Mode::profileFor(FlightState state) {
+    return PROFILES[state < FLIGHT_STATE_COUNT ? state : STATE_LAUNCH_PAD];
+}
+
+void Mode::begin(BMP390* bmp390, BNO085* bno085, GPS* gpsModule, Filter* altitudeFilter, FlightState initial) {
+    bmp = bmp390;
+    imu = bno085;
+    gps = gpsModule;
+    filter = altitudeFilter;
+
+    // 단계별 정상상태 이득 (예측 주기 = IMU 주기, 보정 주기 = BMP ODR)
+    if (filter) {
+        for (uint8_t i = 0; i < FLIGHT_STATE_COUNT; i++) {
+            const RateProfile& rates = PROFILES[i];
+            if (i > 0 && sameRates(rates, PROFILES[i - 1])) {
+                gains[i] = gains[i - 1];
+                continue;
+            }
+            gains[i] = filter->solveFixedGain(rates.imuIntervalUs * 1e-6f, rates.predictsPerUpdate());
+        }
+    }
+
+    state = initial;
+    profile = &profileFor(initial);
+    pending = MODE_DEVICE_ALL;
+}
+
+bool Mode::update(FlightState current) {
+    bool changed = false;
+    if (current != state) {
+        state = current;
+        const RateProfile* next = &profileFor(current);
+
+        // 주기가 같은 단계끼리는 다시 설정하지 않음 (상승 -> 정점 등)
+        if (!sameRates(*next, *profile)) {
+            pending = MODE_DEVICE_ALL;
+            changes++;
+            changed = true;
+        }
+        profile = next;
+    }
+
+    if (pending) applyNext();
+    return changed;
+}
+
+void Mode::applyNext() {
+    if (pending & MODE_DEVICE_BMP) {
+        pending &= ~MODE_DEVICE_BMP;
+        if (bmp) bmp->configureRate(profile->baroOdr, profile->baroPressureOsr, profile->baroTemperatureOsr);
+        return;
+    }
+
+    if (pending & MODE_DEVICE_IMU) {
+        // 리포트 재활성화는 BNO085::update가 하나씩 진행
+        pending &= ~MODE_DEVICE_IMU;
+        if (imu) imu->setReportInterval(profile->imuIntervalUs);
+        return;
+    }
+
+    if (pending & MODE_DEVICE_GPS) {
+        pending &= ~MODE_DEVICE_GPS;
+        if (gps) gps->setUpdateRate(profile->gpsHz);
+        return;
+    }
+
+    if (pending & MODE_DEVICE_FILTER) {
+        // 새 주기가 모두 적용된 뒤 이득 전환 (필터 상태는 유지)
+        pending &= ~MODE_DEVICE_FILTER;
+        if (filter) filter->setFixedGain(gains[state < FLIGHT_STATE_COUNT ? state : STATE_LAUNCH_PAD]);
+    }
+}
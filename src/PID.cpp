@@ -0,0 +1,61 @@
+// src/PID.cpp
+#include "PID.h"
+
+PID::PID() {
+    kp = 0.0f;
+    kiDt = 0.0f;
+    dDecay = 0.0f;
+    dGain = 0.0f;
+    outMin = -1.0f;
+    outMax = 1.0f;
+    reset();
+}
+
+void PID::configure(const PIDGains& gains, float dt) {
+    kp = gains.kp;
+    kiDt = gains.ki * dt;
+
+    // 1차 저역통과 미분 (후진 차분): D = τ/(τ+dt)·D - kd/(τ+dt)·Δy
+    float tau = gains.derivativeHz > 0.0f ? 1.0f / (2.0f * 3.14159265f * gains.derivativeHz) : 0.0f;
+    dDecay = tau / (tau + dt);
+    dGain = gains.kd / (tau + dt);
+
+    outMin = gains.outMin;
+    outMax = gains.outMax;
+    reset();
+}
+
+void PID::reset() {
+    integral = 0.0f;
+    derivative = 0.0f;
+    lastMeasurement = 0.0f;
+    output = 0.0f;
+    primed = false;
+}
+
+float PID::update(float setpoint, float measurement) {
+    float error = setpoint - measurement;
+
+    // 첫 주기는 Δy가 없으므로 미분 0
+    if (!primed) {
+        lastMeasurement = measurement;
+        primed = true;
+    }
+    derivative = dDecay * derivative - dGain * (measurement - lastMeasurement);
+    lastMeasurement = measurement;
+
+    float unsaturated = kp * error + integral + derivative;
+    float out = unsaturated;
+    if (out > outMax) out = outMax;
+    if (out < outMin) out = outMin;
+
+    // 포화 방향으로 더 미는 오차는 적분하지 않음
+    if ((unsaturated < outMax || error < 0.0f) && (unsaturated > outMin || error > 0.0f)) {
+        integral += kiDt * error;
+        if (integral > outMax) integral = outMax;
+        if (integral < outMin) integral = outMin;
+    }
+
+    output = out;
+    return out;
+}
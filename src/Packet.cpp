@@ -1,15 +1,18 @@
 // src/Packet.cpp
 #include "Packet.h"
+#include "Profiler.h"
 
 Packet::Packet() {
     bmp = nullptr;
     imu = nullptr;
     gps = nullptr;
+    radio = nullptr;
     
     packetCount = 0;
-    currentState = "LAUNCH_PAD";
+    currentState = STATE_LAUNCH_PAD;
     currentMode = 'F';
-    lastCommand = "NONE";
+    copyString(lastCommand, "NONE", sizeof(lastCommand));
+    encoding = ENCODING_CSV;
     missionStartTime = 0;
 }
 
@@ -22,26 +25,39 @@ void Packet::attachSensors(BMP390* bmp390, BNO085* bno085, GPS* gpsModule) {
 }
 
 void Packet::beginMission() {
-    missionStartTime = millis();
+    missionStartTime = halMillis();
     packetCount = 0;
     Serial.println("Packet - 미션 시작!");
 }
 
-TelemetryPacket Packet::collectData() {
-    TelemetryPacket packet;
-    
+void Packet::resumeMission(uint32_t count, uint32_t elapsedMillis) {
+    // 부팅 직후 millis가 작아도 부호 없는 뺄셈이라 경과 시간은 그대로 이어짐
+    missionStartTime = halMillis() - elapsedMillis;
+    packetCount = count;
+    Serial.println("Packet - 미션 재개!");
+}
+
+uint32_t Packet::getMissionElapsed() {
+    return halMillis() - missionStartTime;
+}
+
+void Packet::collectData(TelemetryPacket& packet) {
     // 기본 정보
-    packet.teamId = "1062";
-    packet.missionTime = formatMissionTime(millis() - missionStartTime);
+    copyString(packet.teamId, TEAM_ID, sizeof(packet.teamId));
+    formatMissionTime(halMillis() - missionStartTime, packet.missionTime);
     packet.packetCount = packetCount;
     packet.mode = currentMode;
     packet.state = currentState;
     
+    // 모든 센서를 같은 시점 기준으로 읽음 (수집 중 새로 들어온 샘플은 제외)
+    uint32_t snapshotTime = halMicros();
+    
     // BMP390 데이터
-    if (bmp && bmp->isInitialized()) {
-        packet.altitude = bmp->getAltitude();
-        packet.temperature = bmp->getTemperature();
-        packet.pressure = bmp->getPressure();
+    Sample<BaroSample> baro;
+    if (bmp && bmp->isActive() && bmp->getSamples().at(snapshotTime, baro)) {
+        packet.altitude = baro.value.altitude;
+        packet.temperature = baro.value.temperature;
+        packet.pressure = baro.value.pressure;
     } else {
         packet.altitude = 0.0;
         packet.temperature = 0.0;
@@ -52,16 +68,17 @@ TelemetryPacket Packet::collectData() {
     packet.voltage = 0.0;
     packet.current = 0.0;
     
-    // BNO085 자이로 데이터
-    if (imu && imu->isInitialized()) {
-        packet.gyro_r = imu->getGyroRoll();
-        packet.gyro_p = imu->getGyroPitch();
-        packet.gyro_y = imu->getGyroYaw();
+    // BNO085 자이로 데이터 (자세각, 회전 벡터에서)
+    ImuSnapshot imuSnapshot;
+    if (imu && imu->isInitialized() && imu->snapshotAt(snapshotTime, imuSnapshot)) {
+        packet.gyro_r = imuSnapshot.roll;
+        packet.gyro_p = imuSnapshot.pitch;
+        packet.gyro_y = imuSnapshot.yaw;
         
         // 가속도 데이터 - RPY 방향으로 변환된 값 사용
-        packet.accel_r = imu->getAccelRoll();
-        packet.accel_p = imu->getAccelPitch();
-        packet.accel_y = imu->getAccelYaw();
+        packet.accel_r = imuSnapshot.accelWorld.x;
+        packet.accel_p = imuSnapshot.accelWorld.y;
+        packet.accel_y = imuSnapshot.accelWorld.z;
     } else {
         packet.gyro_r = 0.0;
         packet.gyro_p = 0.0;
@@ -72,22 +89,15 @@ TelemetryPacket Packet::collectData() {
     }
     
     // GPS 데이터
-    if (gps && gps->isInitialized()) {
-        if (gps->hasFix()) {
-            packet.gpsTime = gps->getTimeString();
-            packet.gpsAltitude = gps->getAltitude();
-            packet.gpsLatitude = gps->getLatitude();
-            packet.gpsLongitude = gps->getLongitude();
-            packet.gpsSats = gps->getSatellites();
-        } else {
-            packet.gpsTime = "00:00:00";
-            packet.gpsAltitude = 0.0;
-            packet.gpsLatitude = 0.0;
-            packet.gpsLongitude = 0.0;
-            packet.gpsSats = 0;
-        }
+    Sample<GpsSample> fix;
+    if (gps && gps->isInitialized() && gps->getSamples().at(snapshotTime, fix) && fix.value.fix) {
+        formatClockTime(packet.gpsTime, fix.value.hour, fix.value.minute, fix.value.seconds);
+        packet.gpsAltitude = fix.value.altitude;
+        packet.gpsLatitude = fix.value.latitude;
+        packet.gpsLongitude = fix.value.longitude;
+        packet.gpsSats = fix.value.satellites;
     } else {
-        packet.gpsTime = "00:00:00";
+        copyString(packet.gpsTime, "00:00:00", sizeof(packet.gpsTime));
         packet.gpsAltitude = 0.0;
         packet.gpsLatitude = 0.0;
         packet.gpsLongitude = 0.0;
@@ -95,73 +105,50 @@ TelemetryPacket Packet::collectData() {
     }
     
     // 명령어 에코
-    packet.cmdEcho = lastCommand;
-    
-    return packet;
+    copyString(packet.cmdEcho, lastCommand, sizeof(packet.cmdEcho));
 }
 
-String Packet::generatePacketString() {
-    TelemetryPacket packet = collectData();
-    return formatCSV(packet);
+size_t Packet::generatePacketString(char* buffer, size_t size) {
+    TelemetryPacket packet;
+    collectData(packet);
+    return formatTelemetryCSV(packet, buffer, size);
 }
 
-String Packet::formatCSV(const TelemetryPacket& packet) {
-    // CSV 형식: 각 필드를 쉼표로 구분
-    String csv = "";
-    
-    csv += packet.teamId + ",";
-    csv += packet.missionTime + ",";
-    csv += String(packet.packetCount) + ",";
-    csv += String(packet.mode) + ",";
-    csv += packet.state + ",";
-    
-    // BMP390
-    csv += String(packet.altitude, 2) + ",";
-    csv += String(packet.temperature, 2) + ",";
-    csv += String(packet.pressure, 2) + ",";
-    
-    // 전원
-    csv += String(packet.voltage, 2) + ",";
-    csv += String(packet.current, 2) + ",";
-    
-    // BNO085 자이로
-    csv += String(packet.gyro_r, 2) + ",";
-    csv += String(packet.gyro_p, 2) + ",";
-    csv += String(packet.gyro_y, 2) + ",";
-    
-    // BNO085 가속도
-    csv += String(packet.accel_r, 2) + ",";
-    csv += String(packet.accel_p, 2) + ",";
-    csv += String(packet.accel_y, 2) + ",";
-    
-    // GPS
-    csv += packet.gpsTime + ",";
-    csv += String(packet.gpsAltitude, 2) + ",";
-    csv += String(packet.gpsLatitude, 6) + ",";
-    csv += String(packet.gpsLongitude, 6) + ",";
-    csv += String(packet.gpsSats) + ",";
-    
-    // 명령어 에코
-    csv += packet.cmdEcho;
-    
-    return csv;
+size_t Packet::generatePacketBinary(uint8_t* buffer, size_t size) {
+    TelemetryPacket packet;
+    collectData(packet);
+    return encodeTelemetryBinary(packet, buffer, size);
 }
 
 void Packet::transmit() {
-    String packetStr = generatePacketString();
-    Serial.println(packetStr);
+    PROFILE_SCOPE(PROBE_PACKET_TRANSMIT);
+    
+    size_t length;
+    if (encoding == ENCODING_BINARY) {
+        // 프레임 끝 0x00 구분자가 포함되어 있으므로 줄바꿈 없음
+        length = generatePacketBinary((uint8_t*)txBuffer, sizeof(txBuffer));
+    } else {
+        length = generatePacketString(txBuffer, sizeof(txBuffer) - 1);
+        txBuffer[length++] = '\n';
+    }
+    
+    // 무선은 큐에 넣기만 함 (실제 송신은 XBee::service)
+    if (radio) radio->send((const uint8_t*)txBuffer, length, XBEE_PRIORITY_NORMAL);
+    
+    // USB 콘솔은 송신 버퍼에 다 들어갈 때만 (막히면 이번 패킷은 건너뜀)
+    if ((size_t)Serial.availableForWrite() >= length) {
+        Serial.write((const uint8_t*)txBuffer, length);
+    }
     packetCount++;  // 전송 후 카운터 증가
 }
 
-String Packet::formatMissionTime(unsigned long elapsedMillis) {
+void Packet::formatMissionTime(unsigned long elapsedMillis, char* out) {
     // millis를 hh:mm:ss로 변환
     unsigned long totalSeconds = elapsedMillis / 1000;
     
-    int hours = (totalSeconds / 3600) % 24;
-    int minutes = (totalSeconds / 60) % 60;
-    int seconds = totalSeconds % 60;
+    uint8_t hours = (totalSeconds / 3600) % 24;
+    uint8_t minutes = (totalSeconds / 60) % 60;
+    uint8_t seconds = totalSeconds % 60;
     
-    char timeStr[9];
-    sprintf(timeStr, "%02d:%02d:%02d", hours, minutes, seconds);
-    return String(timeStr);
-}
\ No newline at end of file
+    formatClockTime(out, hours, minutes, seconds);
+}
@@ -0,0 +1,116 @@
+// src/Profiler.cpp
+#include "Profiler.h"
+#include "Telemetry.h"
+#include <string.h>
+
+#if defined(__IMXRT1062__)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+static const char* const PROBE_NAMES[PROBE_COUNT] = {
+    "IMU", "BMP", "GPS", "TX", "CTRL"
+};
+
+ProbeStats Profiler::stats[PROBE_COUNT];
+
+void Profiler::begin() {
+#if defined(__IMXRT1062__)
+    ARM_DEMCR |= ARM_DEMCR_TRCENA;
+    ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+#endif
+    reset();
+}
+
+uint32_t Profiler::now() {
+#if defined(__IMXRT1062__)
+    return ARM_DWT_CYCCNT;
+#else
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+float Profiler::ticksToMicros(uint32_t ticks) {
+#if defined(__IMXRT1062__)
+    return ticks / (F_CPU_ACTUAL / 1000000.0f);
+#else
+    return ticks / 1000.0f;
+#endif
+}
+
+void Profiler::reset() {
+    memset(stats, 0, sizeof(stats));
+    for (uint8_t i = 0; i < PROBE_COUNT; i++) {
+        stats[i].minTicks = UINT32_MAX;
+    }
+}
+
+uint8_t Profiler::bucketIndex(uint32_t ticks) {
+    if (ticks < (1u << PROFILER_SUB_BITS)) return ticks;
+
+    uint8_t msb = 31 - __builtin_clz(ticks);
+    uint8_t sub = (ticks >> (msb - PROFILER_SUB_BITS)) & ((1u << PROFILER_SUB_BITS) - 1);
+    return ((msb - PROFILER_SUB_BITS + 1) << PROFILER_SUB_BITS) + sub;
+}
+
+uint32_t Profiler::bucketUpperBound(uint8_t index) {
+    if (index < (1u << PROFILER_SUB_BITS)) return index;
+
+    uint8_t shift = (index >> PROFILER_SUB_BITS) - 1;
+    uint32_t sub = index & ((1u << PROFILER_SUB_BITS) - 1);
+    uint64_t upper = ((uint64_t)((1u << PROFILER_SUB_BITS) + sub + 1) << shift) - 1;
+    return upper > UINT32_MAX ? UINT32_MAX : (uint32_t)upper;
+}
+
+void Profiler::record(ProbeId probe, uint32_t ticks) {
+    ProbeStats& s = stats[probe];
+    s.count++;
+    s.totalTicks += ticks;
+    if (ticks < s.minTicks) s.minTicks = ticks;
+    if (ticks > s.maxTicks) s.maxTicks = ticks;
+    s.buckets[bucketIndex(ticks)]++;
+}
+
+const char* Profiler::probeName(ProbeId probe) {
+    return (probe < PROBE_COUNT) ? PROBE_NAMES[probe] : "?";
+}
+
+uint32_t Profiler::percentile(ProbeId probe, float fraction) {
+    const ProbeStats& s = stats[probe];
+    if (s.count == 0) return 0;
+
+    uint32_t target = (uint32_t)(s.count * fraction);
+    if (target >= s.count) target = s.count - 1;
+
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) {
+        seen += s.buckets[i];
+        if (seen > target) {
+            uint32_t upper = bucketUpperBound(i);
+            return upper < s.maxTicks ? upper : s.maxTicks;
+        }
+    }
+    return s.maxTicks;
+}
+
+size_t Profiler::formatDiagnostics(char* buffer, size_t size) {
+    CSVWriter csv(buffer, size);
+    csv.appendString("DIAG");
+
+    for (uint8_t i = 0; i < PROBE_COUNT; i++) {
+        ProbeId probe = (ProbeId)i;
+        const ProbeStats& s = stats[i];
+        float mean = s.count ? ticksToMicros((uint32_t)(s.totalTicks / s.count)) : 0.0f;
+
+        csv.separator(); csv.appendString(PROBE_NAMES[i]);
+        csv.separator(); csv.appendUInt(s.count);
+        csv.separator(); csv.appendFloat(s.count ? ticksToMicros(s.minTicks) : 0.0f, 1);
+        csv.separator(); csv.appendFloat(mean, 1);
+        csv.separator(); csv.appendFloat(ticksToMicros(percentile(probe, 0.99f)), 1);
+        csv.separator(); csv.appendFloat(ticksToMicros(s.maxTicks), 1);
+    }
+
+    return csv.size();
+}
@@ -0,0 +1,150 @@
+// src/Recovery.cpp
+#include "Recovery.h"
+#include "TelemetryBinary.h"
+#include <string.h>
+
+// ---- 저장소 ----
+
+#ifdef ARDUINO
+#include <EEPROM.h>
+
+size_t EepromStore::size() {
+    return EEPROM.length();
+}
+
+void EepromStore::read(uint32_t address, uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        data[i] = EEPROM.read(address + i);
+    }
+}
+
+void EepromStore::write(uint32_t address, const uint8_t* data, size_t length) {
+    // update는 값이 같으면 플래시를 건드리지 않음
+    for (size_t i = 0; i < length; i++) {
+        EEPROM.update(address + i, data[i]);
+    }
+}
+
+#else
+
+MemoryStore::MemoryStore() {
+    memset(data, 0xFF, sizeof(data));
+    byteWrites = 0;
+}
+
+void MemoryStore::read(uint32_t address, uint8_t* out, size_t length) {
+    memcpy(out, &data[address], length);
+}
+
+void MemoryStore::write(uint32_t address, const uint8_t* in, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (data[address + i] != in[i]) {
+            data[address + i] = in[i];
+            byteWrites++;
+        }
+    }
+}
+
+#endif
+
+// ---- 저널 ----
+
+Recovery::Recovery() {
+    store = nullptr;
+    valid = false;
+    memset(&latest, 0, sizeof(latest));
+    nextSlot = 0;
+    saves = 0;
+    unchanged = 0;
+}
+
+uint16_t Recovery::slotCrc(const RecoverySlot& slot) {
+    // magic/crc 필드 이후 전체
+    const uint8_t* start = (const uint8_t*)&slot.sequence;
+    size_t length = sizeof(RecoverySlot) - offsetof(RecoverySlot, sequence);
+    return crc16(start, length);
+}
+
+bool Recovery::sameSignificant(const RecoverySnapshot& a, const RecoverySnapshot& b) {
+    // 매초 바뀌는 패킷 번호/경과 시간은 제외
+    return a.state == b.state && a.mode == b.mode && a.groundPressure == b.groundPressure &&
+           strncmp(a.lastCommand, b.lastCommand, sizeof(a.lastCommand)) == 0;
+}
+
+bool Recovery::begin(RecoveryStore* storage) {
+    store = storage;
+    valid = false;
+    nextSlot = 0;
+
+    if (!store || store->size() < RECOVERY_JOURNAL_BASE + RECOVERY_SLOT_SIZE * RECOVERY_SLOT_COUNT) {
+        store = nullptr;
+        return false;
+    }
+
+    for (uint8_t i = 0; i < RECOVERY_SLOT_COUNT; i++) {
+        RecoverySlot slot;
+        store->read(slotAddress(i), (uint8_t*)&slot, sizeof(slot));
+        if (slot.magic != RECOVERY_MAGIC || slot.crc != slotCrc(slot)) continue;
+
+        // sequence 비교 (오버플로 대응)
+        if (!valid || (int32_t)(slot.sequence - latest.sequence) > 0) {
+            latest = slot;
+            valid = true;
+            nextSlot = (i + 1) % RECOVERY_SLOT_COUNT;
+        }
+    }
+
+    return valid;
+}
+
+bool Recovery::load(RecoverySnapshot& snapshot) {
+    if (!valid) return false;
+    snapshot = latest.snapshot;
+    return true;
+}
+
+void Recovery::save(const RecoverySnapshot& snapshot) {
+    if (!store) return;
+
+    // 패딩까지 CRC/비교에 들어가므로 0으로 채운 뒤 필드 단위 복사
+    RecoverySlot slot;
+    memset(&slot, 0, sizeof(slot));
+    slot.snapshot.packetCount = snapshot.packetCount;
+    slot.snapshot.missionElapsedMs = snapshot.missionElapsedMs;
+    slot.snapshot.groundPressure = snapshot.groundPressure;
+    slot.snapshot.state = snapshot.state;
+    slot.snapshot.mode = snapshot.mode;
+    copyString(slot.snapshot.lastCommand, snapshot.lastCommand, sizeof(slot.snapshot.lastCommand));
+
+    // 매번 쓰면 카운터 때문에 매초 플래시 기록이 생기므로 중요 필드 변화 또는 주기로만
+    if (valid && sameSignificant(slot.snapshot, latest.snapshot) &&
+        slot.snapshot.missionElapsedMs - latest.snapshot.missionElapsedMs < RECOVERY_PERIOD_MS) {
+        unchanged++;
+        return;
+    }
+
+    slot.magic = RECOVERY_MAGIC;
+    slot.sequence = valid ? latest.sequence + 1 : 1;
+    slot.crc = slotCrc(slot);
+
+    store->write(slotAddress(nextSlot), (const uint8_t*)&slot, sizeof(slot));
+
+    latest = slot;
+    valid = true;
+    nextSlot = (nextSlot + 1) % RECOVERY_SLOT_COUNT;
+    saves++;
+}
+
+void Recovery::clear() {
+    if (!store) return;
+
+    // magic만 지우면 모든 슬롯이 무효
+    uint16_t erased = 0;
+    for (uint8_t i = 0; i < RECOVERY_SLOT_COUNT; i++) {
+        store->write(slotAddress(i), (const uint8_t*)&erased, sizeof(erased));
+    }
+
+    valid = false;
+    memset(&latest, 0, sizeof(latest));
+    nextSlot = 0;
+}
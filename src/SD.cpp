@@ -0,0 +1,384 @@
+// src/SD.cpp
+#include "SD.h"
+#include "HAL.h"
+#include "Telemetry.h"
+#include <string.h>
+
+// ---- 백엔드 ----
+
+#ifdef ARDUINO
+
+SdFs SdFatBackend::sd;
+bool SdFatBackend::mounted = false;
+
+bool SdFatBackend::mount() {
+    if (!mounted) mounted = sd.begin(SdioConfig(FIFO_SDIO));
+    return mounted;
+}
+
+bool SdFatBackend::open(const char* path, uint32_t preallocate) {
+    if (!mount()) return false;
+
+    // 이미 있으면 실패 (이전 비행 기록 보호)
+    if (!file.open(path, O_RDWR | O_CREAT | O_EXCL)) return false;
+
+    // 연속 클러스터를 미리 잡아두면 기록 중 FAT 갱신이 없어 지연이 일정함
+    if (preallocate > 0 && !file.preAllocate(preallocate)) {
+        file.close();
+        return false;
+    }
+    return true;
+}
+
+bool SdFatBackend::exists(const char* path) {
+    return mount() && sd.exists(path);
+}
+
+size_t SdFatBackend::write(const uint8_t* data, size_t length) {
+    return file.write(data, length);
+}
+
+bool SdFatBackend::sync() {
+    return file.sync();
+}
+
+void SdFatBackend::close() {
+    // 미리 할당한 영역 중 쓰지 않은 부분 반환
+    file.truncate();
+    file.close();
+}
+
+bool SdFatBackend::isBusy() {
+    return mounted && sd.card()->isBusy();
+}
+
+#else
+
+FileLogBackend::FileLogBackend() {
+    file = nullptr;
+}
+
+FileLogBackend::~FileLogBackend() {
+    close();
+}
+
+bool FileLogBackend::open(const char* path, uint32_t preallocate) {
+    (void)preallocate;
+    close();
+    file = fopen(path, "wbx");       // 이미 있으면 실패
+    return file != nullptr;
+}
+
+bool FileLogBackend::exists(const char* path) {
+    FILE* existing = fopen(path, "rb");
+    if (!existing) return false;
+    fclose(existing);
+    return true;
+}
+
+size_t FileLogBackend::write(const uint8_t* data, size_t length) {
+    if (!file) return 0;
+    return fwrite(data, 1, length, file);
+}
+
+bool FileLogBackend::sync() {
+    return file && fflush(file) == 0;
+}
+
+void FileLogBackend::close() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+MemoryLogBackend::MemoryLogBackend(uint8_t* buffer, size_t size) {
+    storage = buffer;
+    capacity = buffer ? size : 0;
+    length = 0;
+    opened = false;
+    name[0] = '\0';
+    syncs = 0;
+}
+
+bool MemoryLogBackend::open(const char* path, uint32_t preallocate) {
+    (void)preallocate;
+    if (opened || exists(path)) return false;
+    strncpy(name, path, sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    length = 0;
+    syncs = 0;
+    opened = true;
+    return true;
+}
+
+bool MemoryLogBackend::exists(const char* path) {
+    return name[0] != '\0' && strcmp(name, path) == 0;
+}
+
+size_t MemoryLogBackend::write(const uint8_t* data, size_t size) {
+    if (!opened) return 0;
+    for (size_t i = 0; i < size; i++) {
+        if (length + i < capacity) storage[length + i] = data[i];
+    }
+    length += size;
+    return size;
+}
+
+bool MemoryLogBackend::sync() {
+    if (!opened) return false;
+    syncs++;
+    return true;
+}
+
+#endif
+
+bool openNextFree(LogBackend* backend, const char* base, const char* extension,
+                  uint32_t preallocate, char* path, size_t pathSize) {
+    if (!backend || !path || pathSize == 0) return false;
+    path[0] = '\0';
+
+    for (uint16_t number = 0; number < LOG_FILE_NUMBERS; number++) {
+        CSVWriter name(path, pathSize);
+        name.appendString(base);
+        name.appendChar('0' + number / 100);
+        name.appendChar('0' + number / 10 % 10);
+        name.appendChar('0' + number % 10);
+        name.appendString(extension);
+
+        if (backend->exists(path)) continue;
+        return backend->open(path, preallocate);
+    }
+    return false;
+}
+
+// ---- 기록기 ----
+
+SDLogger::SDLogger() {
+    backend = nullptr;
+    active = false;
+    path[0] = '\0';
+
+    fillIndex = 0;
+    fillLength = 0;
+    pending[0] = false;
+    pending[1] = false;
+    flushIndex = 0;
+    flushOffset = 0;
+
+    recordsWritten = 0;
+    recordsDropped = 0;
+    buffersFlushed = 0;
+    writeErrors = 0;
+    bytesWritten = 0;
+    maxWriteMicros = 0;
+    busySkips = 0;
+
+    unsynced = false;
+    syncDue = false;
+    lastSyncMicros = 0;
+}
+
+bool SDLogger::begin(LogBackend* storage, const char* base, const char* extension) {
+    backend = storage;
+    active = openNextFree(backend, base, extension, LOG_PREALLOCATE, path, sizeof(path));
+    lastSyncMicros = halMicros();
+    return active;
+}
+
+void SDLogger::copyBytes(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        size_t room = LOG_BUFFER_SIZE - fillLength;
+        size_t count = length < room ? length : room;
+        memcpy(&buffers[fillIndex][fillLength], data, count);
+        fillLength += count;
+        data += count;
+        length -= count;
+
+        // 가득 차면 기록 대기로 넘기고 반대쪽 버퍼로 전환
+        if (fillLength == LOG_BUFFER_SIZE) {
+            pending[fillIndex] = true;
+            fillIndex ^= 1;
+            fillLength = 0;
+        }
+    }
+}
+
+bool SDLogger::append(uint8_t type, uint32_t timestamp, const void* payload, uint8_t length) {
+    if (!active) return false;
+
+    // 기록 대기 중인 버퍼에는 쓸 수 없음 (레코드 단위로 전부 넣거나 버림)
+    size_t freeBytes = pending[fillIndex] ? 0 : LOG_BUFFER_SIZE - fillLength;
+    if (!pending[fillIndex ^ 1]) freeBytes += LOG_BUFFER_SIZE;
+
+    size_t total = sizeof(LogRecordHeader) + length;
+    if (total > freeBytes) {
+        recordsDropped++;
+        return false;
+    }
+
+    LogRecordHeader header;
+    header.type = type;
+    header.length = length;
+    header.timestamp = timestamp;
+
+    copyBytes((const uint8_t*)&header, sizeof(header));
+    copyBytes((const uint8_t*)payload, length);
+    recordsWritten++;
+    return true;
+}
+
+bool SDLogger::logImu(uint32_t timestamp, const LogImuRecord& record) {
+    return append(LOG_RECORD_IMU, timestamp, &record, sizeof(record));
+}
+
+bool SDLogger::logBaro(uint32_t timestamp, const LogBaroRecord& record) {
+    return append(LOG_RECORD_BARO, timestamp, &record, sizeof(record));
+}
+
+bool SDLogger::logGps(uint32_t timestamp, const char* sentence) {
+    if (!sentence) return false;
+
+    // 줄바꿈 제외, 최대 길이까지만
+    size_t length = 0;
+    while (length < LOG_GPS_MAX_LEN && sentence[length] &&
+           sentence[length] != '\r' && sentence[length] != '\n') {
+        length++;
+    }
+    return append(LOG_RECORD_GPS, timestamp, sentence, (uint8_t)length);
+}
+
+bool SDLogger::writeChunk() {
+    // 버퍼는 A, B 순서로 번갈아 가득 차므로 기록도 번갈아 진행
+    if (!pending[flushIndex]) return false;
+
+    size_t remaining = LOG_BUFFER_SIZE - flushOffset;
+    size_t count = remaining < LOG_WRITE_CHUNK ? remaining : LOG_WRITE_CHUNK;
+
+    uint32_t start = halMicros();
+    size_t written = backend->write(&buffers[flushIndex][flushOffset], count);
+    uint32_t elapsed = halMicros() - start;
+    if (elapsed > maxWriteMicros) maxWriteMicros = elapsed;
+
+    if (written != count) {
+        // 다음 호출에서 같은 청크 재시도
+        writeErrors++;
+        return true;
+    }
+
+    bytesWritten += count;
+    flushOffset += count;
+    unsynced = true;
+
+    if (flushOffset == LOG_BUFFER_SIZE) {
+        pending[flushIndex] = false;
+        flushIndex ^= 1;
+        flushOffset = 0;
+        buffersFlushed++;
+
+        // 방금 쓴 청크로 카드가 바빠졌을 수 있으므로 sync는 다음 service에서 (바쁨 확인 후)
+        if (buffersFlushed % LOG_SYNC_INTERVAL == 0) syncDue = true;
+    }
+    return true;
+}
+
+void SDLogger::service() {
+    if (!active) return;
+
+    // 카드가 내부 기록 중이면 이번에는 건너뜀 (기다리면 태스크가 블로킹됨)
+    if (backend->isBusy()) {
+        busySkips++;
+        return;
+    }
+
+    // 버퍼 N개마다 sync (이번 호출은 sync만)
+    // 기록할 버퍼가 없는 주기에는 시간 기준 sync (느린 단계에서도 1초 이상 잃지 않음)
+    if (syncDue || (!pending[flushIndex] && unsynced && halMicros() - lastSyncMicros >= LOG_SYNC_PERIOD_US)) {
+        backend->sync();
+        unsynced = false;
+        syncDue = false;
+        lastSyncMicros = halMicros();
+        return;
+    }
+    writeChunk();
+}
+
+void SDLogger::end() {
+    if (!active) return;
+
+    // 대기 중인 버퍼 전부 (오류가 계속되면 포기)
+    uint32_t errorLimit = writeErrors + 8;
+    while (writeChunk()) {
+        if (writeErrors >= errorLimit) break;
+    }
+
+    // 채우던 버퍼의 남은 부분 (마지막 한 번은 섹터 배수가 아니어도 됨)
+    if (!pending[fillIndex] && fillLength > 0) {
+        if (backend->write(buffers[fillIndex], fillLength) == fillLength) {
+            bytesWritten += fillLength;
+        } else {
+            writeErrors++;
+        }
+        fillLength = 0;
+    }
+
+    backend->sync();
+    backend->close();
+    active = false;
+}
+
+// ---- 디코더 ----
+
+size_t decodeLogRecord(const uint8_t* data, size_t length, char* out, size_t outSize) {
+    CSVWriter csv(out, outSize);
+
+    LogRecordHeader header;
+    if (length < sizeof(header)) return 0;
+    memcpy(&header, data, sizeof(header));
+    if (header.type == 0) return 0;
+
+    size_t total = sizeof(header) + header.length;
+    if (length < total) return 0;
+    const uint8_t* payload = data + sizeof(header);
+
+    switch (header.type) {
+        case LOG_RECORD_IMU: {
+            if (header.length != sizeof(LogImuRecord)) break;
+            LogImuRecord imu;
+            memcpy(&imu, payload, sizeof(imu));
+            csv.appendString("IMU"); csv.separator();
+            csv.appendUInt(header.timestamp); csv.separator();
+            csv.appendFloat(imu.accelX, 3); csv.separator();
+            csv.appendFloat(imu.accelY, 3); csv.separator();
+            csv.appendFloat(imu.accelZ, 3); csv.separator();
+            csv.appendFloat(imu.quatI, 5); csv.separator();
+            csv.appendFloat(imu.quatJ, 5); csv.separator();
+            csv.appendFloat(imu.quatK, 5); csv.separator();
+            csv.appendFloat(imu.quatReal, 5);
+            break;
+        }
+        case LOG_RECORD_BARO: {
+            if (header.length != sizeof(LogBaroRecord)) break;
+            LogBaroRecord baro;
+            memcpy(&baro, payload, sizeof(baro));
+            csv.appendString("BARO"); csv.separator();
+            csv.appendUInt(header.timestamp); csv.separator();
+            csv.appendFloat(baro.pressure, 2); csv.separator();
+            csv.appendFloat(baro.temperature, 2); csv.separator();
+            csv.appendFloat(baro.altitude, 2);
+            break;
+        }
+        case LOG_RECORD_GPS: {
+            csv.appendString("GPS"); csv.separator();
+            csv.appendUInt(header.timestamp); csv.separator();
+            for (uint8_t i = 0; i < header.length; i++) {
+                csv.appendChar((char)payload[i]);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    return total;
+}
@@ -0,0 +1,131 @@
+// src/Scheduler.cpp
+#include "Scheduler.h"
+#include <string.h>
+
+Scheduler::Scheduler(ClockFunction clockFn) {
+    tasks = nullptr;
+    taskCount = 0;
+    clock = clockFn;
+    memset(nextRun, 0, sizeof(nextRun));
+    memset(period, 0, sizeof(period));
+    memset(order, 0, sizeof(order));
+    resetStats();
+}
+
+bool Scheduler::begin(const TaskConfig* table, uint8_t count, uint32_t start) {
+    if (count > SCHEDULER_MAX_TASKS) return false;
+
+    tasks = table;
+    taskCount = count;
+
+    for (uint8_t i = 0; i < count; i++) {
+        nextRun[i] = start;
+        period[i] = table[i].periodUs;
+        order[i] = i;
+    }
+
+    // 우선순위 순 삽입 정렬 (같은 우선순위는 테이블 순서 유지)
+    for (uint8_t i = 1; i < count; i++) {
+        uint8_t current = order[i];
+        uint8_t j = i;
+        while (j > 0 && tasks[order[j - 1]].priority > tasks[current].priority) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = current;
+    }
+
+    resetStats();
+    return true;
+}
+
+void Scheduler::resetStats() {
+    memset(stats, 0, sizeof(stats));
+    passes = 0;
+    statsStart = clock();
+}
+
+bool Scheduler::setPeriod(uint8_t index, uint32_t periodUs) {
+    if (index >= taskCount || period[index] == 0 || periodUs == 0) return false;
+    period[index] = periodUs;
+    return true;
+}
+
+float Scheduler::getCpuLoad() {
+    uint32_t elapsed = clock() - statsStart;
+    if (elapsed == 0) return 0.0;
+
+    uint64_t busy = 0;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        busy += stats[i].totalExecUs;
+    }
+    return (float)busy / elapsed;
+}
+
+float Scheduler::getLoopRate() {
+    uint32_t elapsed = clock() - statsStart;
+    if (elapsed == 0) return 0.0;
+    return passes * 1000000.0f / elapsed;
+}
+
+void Scheduler::execute(uint8_t index, uint32_t scheduled) {
+    const TaskConfig& task = tasks[index];
+    TaskStats& s = stats[index];
+
+    uint32_t start = clock();
+    task.function();
+    uint32_t end = clock();
+
+    uint32_t exec = end - start;
+    s.runs++;
+    s.lastExecUs = exec;
+    s.totalExecUs += exec;
+    if (exec > s.maxExecUs) s.maxExecUs = exec;
+
+    if (period[index] == 0) return;
+
+    uint32_t jitter = start - scheduled;
+    s.lastJitterUs = jitter;
+    if (jitter > s.maxJitterUs) s.maxJitterUs = jitter;
+
+    uint32_t deadline = task.deadlineUs ? task.deadlineUs : period[index];
+    if (end - scheduled > deadline) s.overruns++;
+
+    // 다음 예정 시각 (실행 시각이 아니라 예정 시각 기준으로 누적)
+    nextRun[index] = scheduled + period[index];
+
+    // 한 주기 이상 밀렸으면 놓친 주기는 건너뜀 (위상은 유지)
+    uint32_t now = clock();
+    if (reached(now, nextRun[index] + period[index])) {
+        uint32_t behind = (now - nextRun[index]) / period[index];
+        nextRun[index] += behind * period[index];
+        s.skipped += behind;
+    }
+}
+
+bool Scheduler::runOnce() {
+    bool ranPeriodic = false;
+    uint32_t now = clock();
+    passes++;
+
+    // 기한이 된 주기 태스크 중 가장 높은 우선순위 하나
+    for (uint8_t i = 0; i < taskCount; i++) {
+        uint8_t index = order[i];
+        if (period[index] == 0) continue;
+        if (!reached(now, nextRun[index])) continue;
+
+        execute(index, nextRun[index]);
+        ranPeriodic = true;
+        break;
+    }
+
+    // 연속 태스크
+    for (uint8_t i = 0; i < taskCount; i++) {
+        uint8_t index = order[i];
+        if (period[index] == 0) {
+            execute(index, now);
+        }
+    }
+
+    return ranPeriodic;
+}
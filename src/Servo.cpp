@@ -0,0 +1,98 @@
+// src/Servo.cpp
+#include "Servo.h"
+
+#ifdef ARDUINO
+// Teensy 4.1 FlexPWM 핀 (모듈, 서브모듈, 채널 A/B)
+struct ServoPwmPin {
+    uint8_t pin;
+    IMXRT_FLEXPWM_t* module;
+    uint8_t submodule;
+    bool channelB;
+};
+
+static const ServoPwmPin SERVO_PWM_PINS[] = {
+    { 2,  &IMXRT_FLEXPWM4, 2, false },
+    { 3,  &IMXRT_FLEXPWM4, 2, true  },
+    { 4,  &IMXRT_FLEXPWM2, 0, false },
+    { 5,  &IMXRT_FLEXPWM2, 1, false },
+    { 6,  &IMXRT_FLEXPWM2, 2, false },
+    { 9,  &IMXRT_FLEXPWM2, 2, true  },
+    { 22, &IMXRT_FLEXPWM4, 0, false },
+    { 23, &IMXRT_FLEXPWM4, 1, false },
+    { 33, &IMXRT_FLEXPWM2, 0, true  },
+};
+#endif
+
+ServoDriver::ServoDriver() {
+    pin = 0xFF;
+    minUs = SERVO_MIN_US;
+    maxUs = SERVO_MAX_US;
+    pulseUs = SERVO_CENTER_US;
+    periodUs = 1000000 / SERVO_PWM_HZ;
+    centerUs = SERVO_CENTER_US;
+    halfRangeUs = (SERVO_MAX_US - SERVO_MIN_US) / 2.0f;
+
+#ifdef ARDUINO
+    compare = nullptr;
+    control = nullptr;
+    loadMask = 0;
+    countsPerUsQ16 = 0;
+#endif
+}
+
+bool ServoDriver::begin(uint8_t outputPin, uint16_t frequencyHz, uint16_t minPulse, uint16_t maxPulse) {
+    if (frequencyHz == 0 || minPulse >= maxPulse || maxPulse >= 1000000 / frequencyHz) return false;
+
+    periodUs = 1000000 / frequencyHz;
+    minUs = minPulse;
+    maxUs = maxPulse;
+    centerUs = (minPulse + maxPulse) / 2.0f;
+    halfRangeUs = (maxPulse - minPulse) / 2.0f;
+
+#ifdef ARDUINO
+    const ServoPwmPin* entry = nullptr;
+    for (const ServoPwmPin& p : SERVO_PWM_PINS) {
+        if (p.pin == outputPin) entry = &p;
+    }
+    if (entry == nullptr) return false;
+
+    // 주파수/먹스/출력 활성화는 코어에 맡김 (한 번만)
+    analogWriteFrequency(outputPin, frequencyHz);
+    analogWrite(outputPin, 0);
+
+    IMXRT_FLEXPWM_t* module = entry->module;
+    uint8_t sm = entry->submodule;
+    compare = entry->channelB ? &module->SM[sm].VAL5 : &module->SM[sm].VAL3;
+    control = &module->MCTRL;
+    loadMask = 1 << sm;
+
+    // 주기 카운트 = VAL1 + 1 (프리스케일러는 analogWriteFrequency가 선택)
+    uint64_t periodCounts = (uint64_t)module->SM[sm].VAL1 + 1;
+    countsPerUsQ16 = (uint32_t)((periodCounts << 16) / periodUs);
+#endif
+
+    pin = outputPin;
+    writeMicroseconds((minPulse + maxPulse) / 2);
+    return true;
+}
+
+void ServoDriver::writeMicroseconds(uint16_t us) {
+    if (us < minUs) us = minUs;
+    if (us > maxUs) us = maxUs;
+    pulseUs = us;
+
+#ifdef ARDUINO
+    if (compare == nullptr) return;
+
+    // 이전 LDOK 해제 -> 비교값 -> LDOK (다음 주기 시작에 한꺼번에 반영)
+    *control |= FLEXPWM_MCTRL_CLDOK(loadMask);
+    *compare = (uint16_t)((us * countsPerUsQ16) >> 16);
+    *control |= FLEXPWM_MCTRL_LDOK(loadMask);
+#endif
+}
+
+void ServoDriver::write(float position) {
+    if (position > 1.0f) position = 1.0f;
+    if (position < -1.0f) position = -1.0f;
+    writeMicroseconds((uint16_t)(centerUs + position * halfRangeUs + 0.5f));
+}
@@ -0,0 +1,98 @@
+// src/State.cpp
+#include "State.h"
+#include <math.h>
+#include <string.h>
+
+// 상태 인덱스 -> 판정기 (상태는 순서대로만 진행)
+const StateMachine::Detector StateMachine::DETECTORS[FLIGHT_STATE_COUNT] = {
+    &StateMachine::detectLaunch,     // LAUNCH_PAD -> ASCENT
+    &StateMachine::detectApogee,     // ASCENT -> APOGEE
+    &StateMachine::detectDescent,    // APOGEE -> DESCENT
+    &StateMachine::detectRelease,    // DESCENT -> PROBE_RELEASE
+    &StateMachine::detectLanded,     // PROBE_RELEASE -> LANDED
+    &StateMachine::detectNone,       // LANDED
+};
+
+StateMachine::StateMachine() {
+    releaseAltitude = STATE_RELEASE_ALTITUDE;
+
+    launch.requiredUs = STATE_LAUNCH_US;
+    apogee.requiredUs = STATE_APOGEE_US;
+    descent.requiredUs = STATE_DESCENT_US;
+    release.requiredUs = STATE_RELEASE_US;
+    landed.requiredUs = STATE_LANDED_US;
+
+    reset();
+}
+
+void StateMachine::reset() {
+    samples = 0;
+    timestamp = 0;
+    maxAltitude = 0.0;
+    // 아직 들어가지 않은 상태는 0
+    memset(transitionSample, 0, sizeof(transitionSample));
+    setState(STATE_LAUNCH_PAD);
+}
+
+void StateMachine::setState(FlightState next) {
+    if (next >= FLIGHT_STATE_COUNT) return;
+
+    launch.reset();
+    apogee.reset();
+    descent.reset();
+    release.reset();
+    landed.reset();
+    landedAnchor = 0.0;
+
+    enter(next);
+}
+
+void StateMachine::enter(FlightState next) {
+    state = next;
+    transitionSample[next] = samples;
+}
+
+FlightState StateMachine::update(float altitude, float velocity, uint32_t sampleMicros) {
+    samples++;
+    timestamp = sampleMicros;
+    if (altitude > maxAltitude) maxAltitude = altitude;
+
+    if ((this->*DETECTORS[state])(altitude, velocity)) {
+        enter((FlightState)(state + 1));
+    }
+    return state;
+}
+
+bool StateMachine::detectLaunch(float altitude, float velocity) {
+    return launch.update(altitude > STATE_LAUNCH_ALTITUDE && velocity > STATE_LAUNCH_VELOCITY, timestamp);
+}
+
+bool StateMachine::detectApogee(float altitude, float velocity) {
+    // 속도 부호 전환 또는 최고점 대비 하강 (둘 중 먼저 오는 쪽)
+    return apogee.update(velocity <= 0.0f || altitude < maxAltitude - STATE_APOGEE_DROP, timestamp);
+}
+
+bool StateMachine::detectDescent(float altitude, float velocity) {
+    (void)altitude;
+    return descent.update(velocity < STATE_DESCENT_VELOCITY, timestamp);
+}
+
+bool StateMachine::detectRelease(float altitude, float velocity) {
+    (void)velocity;
+    return release.update(altitude <= releaseAltitude, timestamp);
+}
+
+bool StateMachine::detectLanded(float altitude, float velocity) {
+    // 기준 고도에서 벗어나면 창을 새로 시작
+    if (!landed.active || fabsf(altitude - landedAnchor) > STATE_LANDED_BAND) {
+        landedAnchor = altitude;
+        landed.reset();
+    }
+    return landed.update(fabsf(velocity) < STATE_LANDED_VELOCITY, timestamp);
+}
+
+bool StateMachine::detectNone(float altitude, float velocity) {
+    (void)altitude;
+    (void)velocity;
+    return false;
+}
@@ -0,0 +1,170 @@
+// src/Telemetry.cpp
+#include "Telemetry.h"
+#include <math.h>
+
+static const uint32_t POW10[] = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL,
+    100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+CSVWriter::CSVWriter(char* buf, size_t size) {
+    buffer = buf;
+    capacity = size;
+    length = 0;
+    overflow = (size == 0);
+
+    if (capacity > 0) {
+        buffer[0] = '\0';
+    }
+}
+
+void CSVWriter::appendChar(char c) {
+    // 널 문자 자리는 항상 남겨둠
+    if (length + 1 >= capacity) {
+        overflow = true;
+        return;
+    }
+    buffer[length++] = c;
+    buffer[length] = '\0';
+}
+
+void CSVWriter::appendString(const char* str) {
+    if (!str) return;
+    while (*str) {
+        appendChar(*str++);
+    }
+}
+
+void CSVWriter::appendUInt(uint32_t value) {
+    // 뒤에서부터 자릿수 생성 후 역순 복사
+    char digits[10];
+    uint8_t count = 0;
+
+    do {
+        digits[count++] = '0' + (value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    while (count > 0) {
+        appendChar(digits[--count]);
+    }
+}
+
+void CSVWriter::appendInt(int32_t value) {
+    if (value < 0) {
+        appendChar('-');
+        appendUInt((uint32_t)(-(value + 1)) + 1);  // INT32_MIN 안전
+    } else {
+        appendUInt((uint32_t)value);
+    }
+}
+
+void CSVWriter::appendFloat(float value, uint8_t decimals) {
+    if (isnan(value)) { appendString("nan"); return; }
+    if (isinf(value)) { appendString("inf"); return; }
+    if (value > 4294967040.0f || value < -4294967040.0f) { appendString("ovf"); return; }
+
+    if (decimals > 9) decimals = 9;
+
+    bool negative = value < 0.0f;
+    if (negative) value = -value;
+
+    // 정수부와 소수부를 나눠서 변환 (소수부 스케일은 double로 - M7 FPU는 배정밀도 지원)
+    uint32_t integerPart = (uint32_t)value;
+    double remainder = (double)value - (double)integerPart;
+    uint32_t scale = POW10[decimals];
+    uint32_t fractionPart = (uint32_t)(remainder * (double)scale + 0.5);
+
+    // 반올림 자리올림 처리 (예: 1.999 -> 2.00)
+    if (fractionPart >= scale) {
+        fractionPart -= scale;
+        integerPart++;
+    }
+
+    // -0.00 출력 방지
+    if (negative && (integerPart != 0 || fractionPart != 0)) {
+        appendChar('-');
+    }
+
+    appendUInt(integerPart);
+
+    if (decimals == 0) return;
+
+    appendChar('.');
+
+    // 소수부 앞자리 0 채우기
+    for (uint8_t i = decimals; i > 1; i--) {
+        if (fractionPart >= POW10[i - 1]) break;
+        appendChar('0');
+    }
+    if (fractionPart > 0) {
+        appendUInt(fractionPart);
+    } else {
+        appendChar('0');
+    }
+}
+
+size_t formatTelemetryCSV(const TelemetryPacket& packet, char* buffer, size_t size) {
+    CSVWriter csv(buffer, size);
+
+    csv.appendString(packet.teamId);      csv.separator();
+    csv.appendString(packet.missionTime); csv.separator();
+    csv.appendUInt(packet.packetCount);   csv.separator();
+    csv.appendChar(packet.mode);          csv.separator();
+    csv.appendString(stateName(packet.state)); csv.separator();
+
+    // BMP390
+    csv.appendFloat(packet.altitude, 2);    csv.separator();
+    csv.appendFloat(packet.temperature, 2); csv.separator();
+    csv.appendFloat(packet.pressure, 2);    csv.separator();
+
+    // 전원
+    csv.appendFloat(packet.voltage, 2); csv.separator();
+    csv.appendFloat(packet.current, 2); csv.separator();
+
+    // BNO085 자이로
+    csv.appendFloat(packet.gyro_r, 2); csv.separator();
+    csv.appendFloat(packet.gyro_p, 2); csv.separator();
+    csv.appendFloat(packet.gyro_y, 2); csv.separator();
+
+    // BNO085 가속도
+    csv.appendFloat(packet.accel_r, 2); csv.separator();
+    csv.appendFloat(packet.accel_p, 2); csv.separator();
+    csv.appendFloat(packet.accel_y, 2); csv.separator();
+
+    // GPS
+    csv.appendString(packet.gpsTime);        csv.separator();
+    csv.appendFloat(packet.gpsAltitude, 2);  csv.separator();
+    csv.appendFloat(packet.gpsLatitude, 6);  csv.separator();
+    csv.appendFloat(packet.gpsLongitude, 6); csv.separator();
+    csv.appendInt(packet.gpsSats);           csv.separator();
+
+    // 명령어 에코
+    csv.appendString(packet.cmdEcho);
+
+    return csv.size();
+}
+
+void formatClockTime(char* out, uint8_t hours, uint8_t minutes, uint8_t seconds) {
+    out[0] = '0' + (hours / 10) % 10;
+    out[1] = '0' + hours % 10;
+    out[2] = ':';
+    out[3] = '0' + minutes / 10;
+    out[4] = '0' + minutes % 10;
+    out[5] = ':';
+    out[6] = '0' + seconds / 10;
+    out[7] = '0' + seconds % 10;
+    out[8] = '\0';
+}
+
+void copyString(char* dest, const char* src, size_t size) {
+    if (size == 0) return;
+
+    size_t i = 0;
+    if (src) {
+        for (; i + 1 < size && src[i]; i++) {
+            dest[i] = src[i];
+        }
+    }
+    dest[i] = '\0';
+}
@@ -0,0 +1,249 @@
+// src/TelemetryBinary.cpp
+#include "TelemetryBinary.h"
+#include <math.h>
+#include <string.h>
+
+// 범위 밖 상태 (3비트 필드)
+static const uint8_t STATE_UNKNOWN = 7;
+
+// CRC 니블 테이블 (16 엔트리)
+static const uint16_t CRC16_TABLE[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t crc16(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc = (crc << 4) ^ CRC16_TABLE[(crc >> 12) ^ (data[i] >> 4)];
+        crc = (crc << 4) ^ CRC16_TABLE[(crc >> 12) ^ (data[i] & 0x0F)];
+    }
+    return crc;
+}
+
+size_t cobsEncode(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t readIndex = 0;
+    size_t writeIndex = 1;
+    size_t codeIndex = 0;
+    uint8_t code = 1;
+
+    while (readIndex < length) {
+        if (input[readIndex] == 0) {
+            output[codeIndex] = code;
+            code = 1;
+            codeIndex = writeIndex++;
+        } else {
+            output[writeIndex++] = input[readIndex];
+            code++;
+            if (code == 0xFF) {
+                output[codeIndex] = code;
+                code = 1;
+                codeIndex = writeIndex++;
+            }
+        }
+        readIndex++;
+    }
+
+    output[codeIndex] = code;
+    return writeIndex;
+}
+
+size_t cobsDecode(const uint8_t* input, size_t length, uint8_t* output) {
+    size_t readIndex = 0;
+    size_t writeIndex = 0;
+
+    while (readIndex < length) {
+        uint8_t code = input[readIndex];
+        if (code == 0 || readIndex + code > length) return 0;
+        readIndex++;
+
+        for (uint8_t i = 1; i < code; i++) {
+            output[writeIndex++] = input[readIndex++];
+        }
+        if (code != 0xFF && readIndex != length) {
+            output[writeIndex++] = 0;
+        }
+    }
+
+    return writeIndex;
+}
+
+// ---- 양자화 헬퍼 ----
+
+static int32_t quantize(float value, float scale, int32_t minValue, int32_t maxValue) {
+    if (isnan(value)) return 0;
+    float scaled = value * scale;
+    if (scaled >= (float)maxValue) return maxValue;
+    if (scaled <= (float)minValue) return minValue;
+    return (int32_t)lroundf(scaled);
+}
+
+static void put16(uint8_t*& p, uint32_t v) { p[0] = v; p[1] = v >> 8; p += 2; }
+static void put24(uint8_t*& p, uint32_t v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p += 3; }
+static void put32(uint8_t*& p, uint32_t v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; p += 4; }
+
+static uint32_t getU16(const uint8_t*& p) { uint32_t v = p[0] | (p[1] << 8); p += 2; return v; }
+static uint32_t getU24(const uint8_t*& p) { uint32_t v = p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16); p += 3; return v; }
+static uint32_t getU32(const uint8_t*& p) { uint32_t v = getU24(p); v |= (uint32_t)*p++ << 24; return v; }
+
+static int32_t getI16(const uint8_t*& p) { return (int16_t)getU16(p); }
+static int32_t getI24(const uint8_t*& p) {
+    uint32_t v = getU24(p);
+    if (v & 0x800000) v |= 0xFF000000;  // 부호 확장
+    return (int32_t)v;
+}
+
+// "hh:mm:ss" -> 초 (형식이 아니면 0)
+static uint32_t parseClockTime(const char* str) {
+    if (!str || strlen(str) != 8 || str[2] != ':' || str[5] != ':') return 0;
+    uint32_t h = (str[0] - '0') * 10 + (str[1] - '0');
+    uint32_t m = (str[3] - '0') * 10 + (str[4] - '0');
+    uint32_t s = (str[6] - '0') * 10 + (str[7] - '0');
+    return h * 3600 + m * 60 + s;
+}
+
+static void secondsToClock(uint32_t totalSeconds, char* out) {
+    formatClockTime(out, (totalSeconds / 3600) % 24, (totalSeconds / 60) % 60, totalSeconds % 60);
+}
+
+static uint8_t stateIndex(FlightState state) {
+    return state < FLIGHT_STATE_COUNT ? (uint8_t)state : STATE_UNKNOWN;
+}
+
+size_t encodeTelemetryBinary(const TelemetryPacket& packet, uint8_t* frame, size_t size) {
+    uint8_t payload[TELEMETRY_BINARY_MAX_PAYLOAD + 2];
+    uint8_t* p = payload;
+
+    uint8_t header = (TELEMETRY_BINARY_VERSION << 4) | stateIndex(packet.state);
+    if (packet.mode == 'S') header |= 0x08;
+    *p++ = header;
+
+    put24(p, packet.packetCount);
+    put24(p, parseClockTime(packet.missionTime));
+
+    // BMP390
+    put24(p, quantize(packet.altitude, 100.0f, -8388608, 8388607));
+    put16(p, quantize(packet.temperature, 100.0f, -32768, 32767));
+    put24(p, quantize(packet.pressure, 100.0f, 0, 16777215));
+
+    // 전원
+    put16(p, quantize(packet.voltage, 100.0f, 0, 65535));
+    put16(p, quantize(packet.current, 100.0f, -32768, 32767));
+
+    // BNO085
+    put16(p, quantize(packet.gyro_r, 100.0f, -32768, 32767));
+    put16(p, quantize(packet.gyro_p, 100.0f, -32768, 32767));
+    put16(p, quantize(packet.gyro_y, 100.0f, -32768, 32767));
+    put16(p, quantize(packet.accel_r, 100.0f, -32768, 32767));
+    put16(p, quantize(packet.accel_p, 100.0f, -32768, 32767));
+    put16(p, quantize(packet.accel_y, 100.0f, -32768, 32767));
+
+    // GPS
+    put24(p, parseClockTime(packet.gpsTime));
+    put24(p, quantize(packet.gpsAltitude, 100.0f, -8388608, 8388607));
+    put32(p, quantize(packet.gpsLatitude, 1e7f, -900000000, 900000000));
+    put32(p, quantize(packet.gpsLongitude, 1e7f, -1800000000, 1800000000));
+    *p++ = (uint8_t)quantize((float)packet.gpsSats, 1.0f, 0, 255);
+
+    // 명령어 에코
+    size_t echoLength = strnlen(packet.cmdEcho, TELEMETRY_CMD_ECHO_LEN - 1);
+    *p++ = (uint8_t)echoLength;
+    memcpy(p, packet.cmdEcho, echoLength);
+    p += echoLength;
+
+    // CRC (빅 엔디언)
+    size_t payloadLength = p - payload;
+    uint16_t crc = crc16(payload, payloadLength);
+    *p++ = crc >> 8;
+    *p++ = crc & 0xFF;
+
+    size_t rawLength = p - payload;
+    size_t maxFrame = rawLength + rawLength / 254 + 2;
+    if (size < maxFrame) return 0;
+
+    size_t encoded = cobsEncode(payload, rawLength, frame);
+    frame[encoded++] = 0x00;
+    return encoded;
+}
+
+bool decodeTelemetryBinary(const uint8_t* frame, size_t length, TelemetryPacket& packet) {
+    uint8_t payload[TELEMETRY_BINARY_MAX_FRAME];
+    if (length == 0 || length > sizeof(payload)) return false;
+
+    size_t rawLength = cobsDecode(frame, length, payload);
+    if (rawLength < TELEMETRY_BINARY_FIXED_LEN + 2) return false;
+
+    size_t payloadLength = rawLength - 2;
+    uint16_t received = (payload[payloadLength] << 8) | payload[payloadLength + 1];
+    if (crc16(payload, payloadLength) != received) return false;
+
+    const uint8_t* p = payload;
+    uint8_t header = *p++;
+    if ((header >> 4) != TELEMETRY_BINARY_VERSION) return false;
+
+    packet.state = (FlightState)(header & 0x07);   // 범위 밖이면 이름은 UNKNOWN
+    packet.mode = (header & 0x08) ? 'S' : 'F';
+
+    copyString(packet.teamId, TEAM_ID, sizeof(packet.teamId));
+    packet.packetCount = getU24(p);
+    secondsToClock(getU24(p), packet.missionTime);
+
+    packet.altitude = getI24(p) / 100.0f;
+    packet.temperature = getI16(p) / 100.0f;
+    packet.pressure = getU24(p) / 100.0f;
+
+    packet.voltage = getU16(p) / 100.0f;
+    packet.current = getI16(p) / 100.0f;
+
+    packet.gyro_r = getI16(p) / 100.0f;
+    packet.gyro_p = getI16(p) / 100.0f;
+    packet.gyro_y = getI16(p) / 100.0f;
+    packet.accel_r = getI16(p) / 100.0f;
+    packet.accel_p = getI16(p) / 100.0f;
+    packet.accel_y = getI16(p) / 100.0f;
+
+    secondsToClock(getU24(p), packet.gpsTime);
+    packet.gpsAltitude = getI24(p) / 100.0f;
+    packet.gpsLatitude = (int32_t)getU32(p) / 1e7f;
+    packet.gpsLongitude = (int32_t)getU32(p) / 1e7f;
+    packet.gpsSats = *p++;
+
+    size_t echoLength = *p++;
+    if (echoLength >= TELEMETRY_CMD_ECHO_LEN || (size_t)(p - payload) + echoLength != payloadLength) {
+        return false;
+    }
+    memcpy(packet.cmdEcho, p, echoLength);
+    packet.cmdEcho[echoLength] = '\0';
+
+    return true;
+}
+
+BinaryFrameReader::BinaryFrameReader() {
+    length = 0;
+    overflow = false;
+    framesDecoded = 0;
+    framesRejected = 0;
+}
+
+bool BinaryFrameReader::push(uint8_t byte, TelemetryPacket& packet) {
+    if (byte != 0x00) {
+        if (length < sizeof(buffer)) {
+            buffer[length++] = byte;
+        } else {
+            overflow = true;
+        }
+        return false;
+    }
+
+    // 구분자 도착 - 프레임 완성
+    bool ok = !overflow && length > 0 && decodeTelemetryBinary(buffer, length, packet);
+    if (ok) {
+        framesDecoded++;
+    } else if (length > 0 || overflow) {
+        framesRejected++;
+    }
+
+    length = 0;
+    overflow = false;
+    return ok;
+}
@@ -0,0 +1,264 @@
+// src/XBee.cpp
+#include "XBee.h"
+#include <string.h>
+
+// 수신 파서 상태
+enum XBeeRxState : uint8_t {
+    RX_START = 0,
+    RX_LENGTH_HIGH,
+    RX_LENGTH_LOW,
+    RX_DATA,
+    RX_CHECKSUM,
+};
+
+// TX Status 전달 결과 (0 = 성공)
+#define XBEE_DELIVERY_SUCCESS   0x00
+
+// RX Packet 필드 오프셋 (프레임 타입 기준)
+#define XBEE_RX_DATA_OFFSET     12
+
+XBee::XBee(UartPort* uart) {
+    port = uart;
+    destination = XBEE_BROADCAST;
+
+    memset(head, 0, sizeof(head));
+    memset(tail, 0, sizeof(tail));
+
+    sending = nullptr;
+    sendingPriority = 0;
+    sendOffset = 0;
+    pendingEscape = false;
+
+    nextFrameId = 1;
+
+    rxLength = 0;
+    rxIndex = 0;
+    rxState = RX_START;
+    rxChecksum = 0;
+    rxEscape = false;
+    receiveHandler = nullptr;
+
+    framesQueued = 0;
+    framesSent = 0;
+    framesDropped = 0;
+    bytesSent = 0;
+    txDelivered = 0;
+    txFailed = 0;
+    rxErrors = 0;
+    maxDepth = 0;
+}
+
+void XBee::begin(uint32_t baud) {
+    // 모듈은 미리 AP=2 (이스케이프 API 모드)로 설정되어 있어야 함
+    port->begin(baud);
+}
+
+bool XBee::send(const uint8_t* data, size_t length, XBeePriority priority) {
+    if (length > XBEE_MAX_SEND || priority >= XBEE_PRIORITY_COUNT) return false;
+
+    // NP를 넘는 데이터는 연속 프레임으로 (모듈이 거부하는 길이는 큐에 넣지 않음)
+    while (length > 0) {
+        size_t piece = length < XBEE_MAX_PAYLOAD ? length : XBEE_MAX_PAYLOAD;
+        if (!enqueue(data, piece, priority)) return false;
+        data += piece;
+        length -= piece;
+    }
+    return true;
+}
+
+bool XBee::enqueue(const uint8_t* data, size_t length, uint8_t priority) {
+    // 가득 차면 가장 오래된 프레임을 버림 (보내는 중인 프레임이면 새 프레임을 버림)
+    if ((uint8_t)(head[priority] - tail[priority]) >= XBEE_QUEUE_DEPTH) {
+        framesDropped++;
+        const XBeeFrame* oldest = &queue[priority][tail[priority] % XBEE_QUEUE_DEPTH];
+        if (oldest == sending) return false;
+        tail[priority]++;
+    }
+
+    XBeeFrame& frame = queue[priority][head[priority] % XBEE_QUEUE_DEPTH];
+    uint16_t frameLength = XBEE_TX_OVERHEAD + length;
+    uint8_t* p = frame.data;
+
+    *p++ = XBEE_START;
+    *p++ = frameLength >> 8;
+    *p++ = frameLength & 0xFF;
+
+    uint8_t* body = p;
+    *p++ = XBEE_FRAME_TX_REQUEST;
+    *p++ = nextFrameId;
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        *p++ = (uint8_t)(destination >> shift);
+    }
+    *p++ = 0xFF;                 // 16비트 주소 모름
+    *p++ = 0xFE;
+    *p++ = 0;                    // 브로드캐스트 반경 (최대)
+    *p++ = 0;                    // 옵션
+    memcpy(p, data, length);
+    p += length;
+
+    uint8_t sum = 0;
+    for (uint8_t* q = body; q < p; q++) sum += *q;
+    *p++ = 0xFF - sum;
+
+    frame.length = p - frame.data;
+    head[priority]++;
+    framesQueued++;
+
+    // 프레임 ID 0은 TX Status 응답 없음이라 건너뜀
+    if (++nextFrameId == 0) nextFrameId = 1;
+
+    uint8_t depth = getQueueDepth();
+    if (depth > maxDepth) maxDepth = depth;
+    return true;
+}
+
+uint8_t XBee::getQueueDepth() {
+    uint8_t depth = 0;
+    for (uint8_t i = 0; i < XBEE_PRIORITY_COUNT; i++) {
+        depth += (uint8_t)(head[i] - tail[i]);
+    }
+    return depth;
+}
+
+void XBee::service() {
+    pumpTx();
+    pumpRx();
+}
+
+bool XBee::nextTxByte(uint16_t& offset, bool& escape, uint8_t& byte) {
+    if (offset >= sending->length) return false;
+
+    uint8_t value = sending->data[offset];
+    if (escape) {
+        byte = value ^ XBEE_XOR;
+        escape = false;
+        offset++;
+    } else if (offset > 0 && needsEscape(value)) {
+        // 시작 구분자 외에는 이스케이프
+        byte = XBEE_ESCAPE;
+        escape = true;
+    } else {
+        byte = value;
+        offset++;
+    }
+    return true;
+}
+
+void XBee::pumpTx() {
+    int space = port->availableForWrite();
+
+    while (space > 0) {
+        if (sending == nullptr) {
+            // 높은 우선순위 큐부터 (프레임 중간에는 끼어들지 않음)
+            for (uint8_t i = 0; i < XBEE_PRIORITY_COUNT; i++) {
+                if (head[i] != tail[i]) {
+                    sending = &queue[i][tail[i] % XBEE_QUEUE_DEPTH];
+                    sendingPriority = i;
+                    sendOffset = 0;
+                    break;
+                }
+            }
+            if (sending == nullptr) return;
+        }
+
+        // 송신 버퍼에 들어가는 만큼 이스케이프해서 모음 (진행 위치는 아직 그대로)
+        uint8_t chunk[64];
+        size_t count = 0;
+        size_t limit = (size_t)space < sizeof(chunk) ? (size_t)space : sizeof(chunk);
+        uint16_t offset = sendOffset;
+        bool escape = pendingEscape;
+
+        while (count < limit && nextTxByte(offset, escape, chunk[count])) count++;
+
+        // 실제로 나간 바이트만큼만 진행 (나머지는 다음 호출에서 다시 만듦)
+        size_t written = port->write(chunk, count);
+        uint8_t unused;
+        for (size_t i = 0; i < written; i++) nextTxByte(sendOffset, pendingEscape, unused);
+        bytesSent += written;
+        space -= written;
+
+        if (sendOffset >= sending->length && !pendingEscape) {
+            tail[sendingPriority]++;
+            sending = nullptr;
+            framesSent++;
+        }
+        if (written < count) return;     // UART 버퍼가 가득 참
+    }
+}
+
+void XBee::pumpRx() {
+    while (port->available() > 0) {
+        uint8_t byte = (uint8_t)port->read();
+
+        // 이스케이프되지 않은 시작 구분자는 항상 새 프레임
+        if (byte == XBEE_START) {
+            if (rxState != RX_START) rxErrors++;
+            rxState = RX_LENGTH_HIGH;
+            rxEscape = false;
+            continue;
+        }
+        if (rxState == RX_START) continue;
+
+        if (byte == XBEE_ESCAPE) {
+            rxEscape = true;
+            continue;
+        }
+        if (rxEscape) {
+            byte ^= XBEE_XOR;
+            rxEscape = false;
+        }
+
+        switch (rxState) {
+            case RX_LENGTH_HIGH:
+                rxLength = (uint16_t)byte << 8;
+                rxState = RX_LENGTH_LOW;
+                break;
+
+            case RX_LENGTH_LOW:
+                rxLength |= byte;
+                if (rxLength == 0 || rxLength > XBEE_RX_MAX_FRAME) {
+                    rxErrors++;
+                    rxState = RX_START;
+                    break;
+                }
+                rxIndex = 0;
+                rxChecksum = 0;
+                rxState = RX_DATA;
+                break;
+
+            case RX_DATA:
+                rxFrame[rxIndex++] = byte;
+                rxChecksum += byte;
+                if (rxIndex >= rxLength) rxState = RX_CHECKSUM;
+                break;
+
+            case RX_CHECKSUM:
+                rxState = RX_START;
+                if ((uint8_t)(rxChecksum + byte) != 0xFF) {
+                    rxErrors++;
+                    break;
+                }
+                handleFrame();
+                break;
+        }
+    }
+}
+
+void XBee::handleFrame() {
+    switch (rxFrame[0]) {
+        case XBEE_FRAME_TX_STATUS:
+            // 타입, ID, 16비트 주소, 재시도 횟수, 전달 결과, 탐색 결과
+            if (rxLength < 7) return;
+            if (rxFrame[5] == XBEE_DELIVERY_SUCCESS) txDelivered++;
+            else txFailed++;
+            break;
+
+        case XBEE_FRAME_RX_PACKET:
+            // 타입, 64비트 주소, 16비트 주소, 옵션, RF 데이터
+            if (rxLength < XBEE_RX_DATA_OFFSET) return;
+            if (receiveHandler) {
+                receiveHandler(&rxFrame[XBEE_RX_DATA_OFFSET], rxLength - XBEE_RX_DATA_OFFSET);
+            }
+            break;
+    }
+}
@@ -1,84 +1,421 @@
 // src/sensors/BMP390.cpp
 #include "sensors/BMP390.h"
+#include "Profiler.h"
+#include <math.h>
 
-BMP390::BMP390() {
-    baseAltitude = 0.0;
+void bmp390ParseCalibration(const uint8_t* raw, BMP390Calibration& out) {
+    uint16_t t1 = raw[0] | (raw[1] << 8);
+    uint16_t t2 = raw[2] | (raw[3] << 8);
+    int8_t t3 = (int8_t)raw[4];
+    int16_t p1 = (int16_t)(raw[5] | (raw[6] << 8));
+    int16_t p2 = (int16_t)(raw[7] | (raw[8] << 8));
+    int8_t p3 = (int8_t)raw[9];
+    int8_t p4 = (int8_t)raw[10];
+    uint16_t p5 = raw[11] | (raw[12] << 8);
+    uint16_t p6 = raw[13] | (raw[14] << 8);
+    int8_t p7 = (int8_t)raw[15];
+    int8_t p8 = (int8_t)raw[16];
+    int16_t p9 = (int16_t)(raw[17] | (raw[18] << 8));
+    int8_t p10 = (int8_t)raw[19];
+    int8_t p11 = (int8_t)raw[20];
+
+    // 데이터시트 3.11.1 스케일
+    out.t1 = t1 * 256.0;                       // / 2^-8
+    out.t2 = t2 / 1073741824.0;                // / 2^30
+    out.t3 = t3 / 281474976710656.0;           // / 2^48
+    out.p1 = (p1 - 16384) / 1048576.0;         // (P1 - 2^14) / 2^20
+    out.p2 = (p2 - 16384) / 536870912.0;       // (P2 - 2^14) / 2^29
+    out.p3 = p3 / 4294967296.0;                // / 2^32
+    out.p4 = p4 / 137438953472.0;              // / 2^37
+    out.p5 = p5 * 8.0;                         // / 2^-3
+    out.p6 = p6 / 64.0;                        // / 2^6
+    out.p7 = p7 / 256.0;                       // / 2^8
+    out.p8 = p8 / 32768.0;                     // / 2^15
+    out.p9 = p9 / 281474976710656.0;           // / 2^48
+    out.p10 = p10 / 281474976710656.0;         // / 2^48
+    out.p11 = p11 / 36893488147419103232.0;    // / 2^65
+}
+
+double bmp390CompensateTemperature(const BMP390Calibration& calib, uint32_t raw) {
+    double d1 = (double)raw - calib.t1;
+    double d2 = d1 * calib.t2;
+    return d2 + (d1 * d1) * calib.t3;
+}
+
+double bmp390CompensatePressure(const BMP390Calibration& calib, uint32_t raw, double tempC) {
+    double t2 = tempC * tempC;
+    double t3 = t2 * tempC;
+    double up = (double)raw;
+
+    double out1 = calib.p5 + calib.p6 * tempC + calib.p7 * t2 + calib.p8 * t3;
+    double out2 = up * (calib.p1 + calib.p2 * tempC + calib.p3 * t2 + calib.p4 * t3);
+    double out3 = up * up * (calib.p9 + calib.p10 * tempC) + up * up * up * calib.p11;
+    return out1 + out2 + out3;   // Pa
+}
+
+BMP390::BMP390(I2CBus* i2c) {
+    bus = i2c;
+    memset(&calib, 0, sizeof(calib));
     initialized = false;
+    source = nullptr;
+    initPhase = PHASE_PROBE;
+    initWaitUntil = 0;
+
+    // 50Hz(20ms) 안에 변환이 끝나야 normal 모드 설정 오류가 나지 않음
+    // 압력 4x + 온도 2x = 약 13ms
+    odr = BMP390_ODR_50_HZ;
+    pressureOsr = BMP390_OSR_4X;
+    temperatureOsr = BMP390_OSR_2X;
+
+    pressure = 0.0;
+    temperature = 0.0;
+    altitude = 0.0;
+    hasSample = false;
+
+    calibrationTarget = 0;
+    calibrationCount = 0;
+    calibrationSum = 0.0;
 }
 
 bool BMP390::begin() {
-    Serial.print("BMP390 초기화 중 (SDA=18, SCL=19)... ");
-    
-    Wire.begin();
-    Wire.setClock(400000); // 400kHz
-    
-    if (bmp.begin_I2C(0x77, &Wire)) {
-        Serial.println("성공!");
-        
-        // 센서 설정
-        bmp.setTemperatureOversampling(BMP3_OVERSAMPLING_8X);
-        bmp.setPressureOversampling(BMP3_OVERSAMPLING_4X);
-        bmp.setIIRFilterCoeff(BMP3_IIR_FILTER_COEFF_3);
-        bmp.setOutputDataRate(BMP3_ODR_50_HZ);
-        
-        initialized = true;
-        return true;
-    } else {
-        Serial.println("실패! 연결 확인 필요");
+    InitStatus status;
+    while ((status = beginStep()) == INIT_PENDING) {}
+    return status == INIT_READY;
+}
+
+InitStatus BMP390::beginStep() {
+    switch (initPhase) {
+        case PHASE_PROBE: {
+            bus->begin(400000); // 400kHz
+
+            uint8_t chipId = 0;
+            if (!readRegisters(BMP390_REG_CHIP_ID, &chipId, 1) || chipId != BMP390_CHIP_ID) {
+                Serial.println("BMP390 초기화 실패! 연결 확인 필요 (SDA=18, SCL=19)");
+                initialized = false;
+                return INIT_FAILED;
+            }
+
+            // 소프트 리셋 후 NVM 로드를 기다리는 동안 다른 장치 진행
+            writeRegister(BMP390_REG_CMD, BMP390_CMD_SOFTRESET);
+            initWaitUntil = halMicros() + BMP390_RESET_WAIT_US;
+            initPhase = PHASE_RESET_WAIT;
+            return INIT_PENDING;
+        }
+
+        case PHASE_RESET_WAIT:
+            if ((int32_t)(halMicros() - initWaitUntil) < 0) return INIT_PENDING;
+            break;
+    }
+
+    // 다음 begin 호출은 처음부터
+    initPhase = PHASE_PROBE;
+
+    if (!readCalibration()) {
+        Serial.println("BMP390 초기화 실패! 보정 계수 읽기 오류");
         initialized = false;
-        return false;
+        return INIT_FAILED;
+    }
+
+    // 센서 설정
+    writeRegister(BMP390_REG_CONFIG, BMP390_IIR_COEFF_3 << 1);
+    uint8_t err = applyRate();
+    if (err) {
+        Serial.print("BMP390 초기화 실패! 설정 오류 (ERR=0x");
+        Serial.print(err, HEX);
+        Serial.println(")");
+        initialized = false;
+        return INIT_FAILED;
     }
+
+    Serial.println("BMP390 초기화 성공!");
+    initialized = true;
+    return INIT_READY;
+}
+
+bool BMP390::readRegisters(uint8_t reg, uint8_t* buffer, uint8_t length) {
+    return bus->readRegisters(BMP390_ADDRESS, reg, buffer, length);
+}
+
+bool BMP390::writeRegister(uint8_t reg, uint8_t value) {
+    return bus->writeRegister(BMP390_ADDRESS, reg, value);
+}
+
+bool BMP390::readCalibration() {
+    uint8_t raw[21];
+    if (!readRegisters(BMP390_REG_CALIB, raw, sizeof(raw))) return false;
+    bmp390ParseCalibration(raw, calib);
+    return true;
+}
+
+uint8_t BMP390::applyRate() {
+    writeRegister(BMP390_REG_PWR_CTRL, BMP390_PWR_SLEEP);
+    writeRegister(BMP390_REG_OSR, (temperatureOsr << 3) | pressureOsr);
+    writeRegister(BMP390_REG_ODR, odr);
+    writeRegister(BMP390_REG_PWR_CTRL, BMP390_PWR_NORMAL);
+
+    uint8_t err = 0;
+    readRegisters(BMP390_REG_ERR, &err, 1);
+    return err;
+}
+
+bool BMP390::configureRate(uint8_t odrValue, uint8_t pressureOversampling, uint8_t temperatureOversampling) {
+    odr = odrValue;
+    pressureOsr = pressureOversampling;
+    temperatureOsr = temperatureOversampling;
+
+    if (!initialized) return true;
+    return applyRate() == 0;
 }
 
 bool BMP390::update() {
-    if (!initialized) return false;
-    return bmp.performReading();
+    if (!isActive()) return false;
+    PROFILE_SCOPE(PROBE_BMP_UPDATE);
+
+    PressureReading reading;
+    if (source == nullptr) {
+        if (!readSensor(reading)) return false;
+        process(reading);
+        return true;
+    }
+
+    // 주입 값은 BMP 주기보다 빨리 들어올 수 있으므로 쌓인 것을 모두 처리
+    bool updated = false;
+    while (source->read(reading)) {
+        process(reading);
+        updated = true;
+    }
+    return updated;
+}
+
+bool BMP390::readSensor(PressureReading& out) {
+    // STATUS + 데이터 6바이트를 한 번에 (연속 읽기 중에는 데이터가 섀도잉됨)
+    uint8_t raw[7];
+    if (!readRegisters(BMP390_REG_STATUS, raw, sizeof(raw))) return false;
+    if (!(raw[0] & BMP390_STATUS_DRDY_PRESS)) return false;  // 아직 새 샘플 없음
+
+    uint32_t rawPressure = raw[1] | (raw[2] << 8) | ((uint32_t)raw[3] << 16);
+    uint32_t rawTemperature = raw[4] | (raw[5] << 8) | ((uint32_t)raw[6] << 16);
+
+    double tempC = bmp390CompensateTemperature(calib, rawTemperature);
+    out.temperature = tempC;
+    out.hasTemperature = true;
+    out.pressure = bmp390CompensatePressure(calib, rawPressure, tempC) / 100.0;  // Pa to hPa
+    out.timestamp = halMicros();
+    return true;
+}
+
+void BMP390::process(const PressureReading& reading) {
+    // 온도가 없는 값(주입)은 마지막 센서 온도 유지
+    if (reading.hasTemperature) temperature = reading.temperature;
+    pressure = reading.pressure;
+    altitude = altitudeModel.toAltitude(pressure);
+    hasSample = true;
+
+    BaroSample sample;
+    sample.pressure = pressure;
+    sample.temperature = temperature;
+    sample.altitude = altitude;
+    samples.push(sample, reading.timestamp);
+
+    // 캘리브레이션 중이면 기압 누적
+    if (calibrationTarget > 0) {
+        calibrationSum += pressure;
+        calibrationCount++;
+
+        if (calibrationCount >= calibrationTarget) {
+            altitudeModel.setReference(calibrationSum / calibrationCount);
+            calibrationTarget = 0;
+            Serial.print("BMP390 캘리브레이션 완료! 지상 기압: ");
+            Serial.print(altitudeModel.getReference(), 2);
+            Serial.println(" hPa");
+        }
+    }
 }
 
 float BMP390::getTemperature() {
-    if (!initialized) return 0.0;
-    return bmp.temperature;
+    if (!isActive()) return 0.0;
+    return temperature;
 }
 
 float BMP390::getPressure() {
-    if (!initialized) return 0.0;
-    return bmp.pressure / 100.0; // Pa to hPa
+    if (!isActive()) return 0.0;
+    return pressure;
 }
 
 float BMP390::getAltitude() {
-    if (!initialized) return 0.0;
-    return bmp.readAltitude(1013.25); // 해수면 기압 기준
-}
-
-float BMP390::getRelativeAltitude() {
-    if (!initialized) return 0.0;
-    return getAltitude() - baseAltitude;
-}
-
-void BMP390::calibrateAltitude(int samples) {
-    if (!initialized) return;
-    
-    Serial.print("BMP390 고도 캘리브레이션 중 (");
-    Serial.print(samples);
-    Serial.print("회)... ");
-    
-    float sum = 0.0;
-    int count = 0;
-    
-    for (int i = 0; i < samples; i++) {
-        if (bmp.performReading()) {
-            sum += bmp.readAltitude(1013.25);
-            count++;
+    if (!isActive()) return 0.0;
+    return altitude;
+}
+
+void BMP390::calibrateAltitude(int sampleCount) {
+    if (!isActive() || sampleCount <= 0) return;
+
+    Serial.print("BMP390 고도 캘리브레이션 시작 (");
+    Serial.print(sampleCount);
+    Serial.println("회)");
+
+    calibrationSum = 0.0;
+    calibrationCount = 0;
+    calibrationTarget = sampleCount;
+}
+
+#ifndef ARDUINO
+
+// ---- 호스트 가짜 센서 ----
+
+// T1 27263, T2 19136, T3 -7, P1 28000, P2 -2990, P3 35, P4 1, P5 4000, P6 30144, P7 3, P8 -6, P9 16090, P10 8, P11 -60
+const uint8_t FakeBmp390Bus::DEFAULT_NVM[21] = {
+    0x7F, 0x6A, 0xC0, 0x4A, 0xF9, 0x60, 0x6D, 0x52, 0xF4, 0x23, 0x01,
+    0xA0, 0x0F, 0xC0, 0x75, 0x03, 0xFA, 0xDA, 0x3E, 0x08, 0xC4,
+};
+
+FakeBmp390Bus::FakeBmp390Bus() {
+    memset(registers, 0, sizeof(registers));
+    registers[BMP390_REG_CHIP_ID] = BMP390_CHIP_ID;
+    clockHz = 400000;
+    present = true;
+
+    normal = false;
+    normalSince = 0;
+    conversionsRead = 0;
+
+    pressurePa = 101325.0;
+    temperatureC = 25.0;
+
+    statusReads = 0;
+    dataReads = 0;
+
+    setCalibration(DEFAULT_NVM);
+}
+
+void FakeBmp390Bus::setCalibration(const uint8_t* nvm) {
+    memcpy(&registers[BMP390_REG_CALIB], nvm, 21);
+    bmp390ParseCalibration(nvm, calib);
+}
+
+uint32_t FakeBmp390Bus::rawTemperatureFor(double celsius) {
+    // T = d·t2 + d²·t3 (d = raw - t1) 의 근
+    double d = calib.t3 != 0.0
+        ? (-calib.t2 + sqrt(calib.t2 * calib.t2 + 4.0 * calib.t3 * celsius)) / (2.0 * calib.t3)
+        : celsius / calib.t2;
+    double raw = d + calib.t1;
+    if (raw < 0.0) raw = 0.0;
+    if (raw > 0xFFFFFF) raw = 0xFFFFFF;
+    return (uint32_t)(raw + 0.5);
+}
+
+uint32_t FakeBmp390Bus::rawPressureFor(double pascals, uint32_t rawTemperature) {
+    // 보정 식은 원시값에 대해 단조 -> 뉴턴 반복 (기울기는 원시값 1 차이)
+    double tempC = bmp390CompensateTemperature(calib, rawTemperature);
+    double raw = 6000000.0;
+    for (uint8_t i = 0; i < 20; i++) {
+        double value = bmp390CompensatePressure(calib, (uint32_t)raw, tempC);
+        double slope = bmp390CompensatePressure(calib, (uint32_t)raw + 1, tempC) - value;
+        if (slope == 0.0) break;
+        raw -= (value - pascals) / slope;
+        if (raw < 0.0) raw = 0.0;
+        if (raw > 0xFFFFFF) raw = 0xFFFFFF;
+    }
+
+    // 정수 원시값 중 가장 가까운 것
+    uint32_t best = (uint32_t)raw;
+    double below = fabs(bmp390CompensatePressure(calib, best, tempC) - pascals);
+    double above = fabs(bmp390CompensatePressure(calib, best + 1, tempC) - pascals);
+    return above < below ? best + 1 : best;
+}
+
+uint32_t FakeBmp390Bus::completedConversions() {
+    uint32_t period = bmp390OdrPeriodUs(registers[BMP390_REG_ODR] & 0x1F);
+    return (halMicros() - normalSince) / period;
+}
+
+void FakeBmp390Bus::startNormal() {
+    // 데이터시트 3.9.2 변환 시간 (압력 + 온도 활성)
+    uint8_t osr = registers[BMP390_REG_OSR];
+    uint32_t conversionUs = 234 + 392 + 2020 * (1UL << (osr & 0x07)) + 163 + 2020 * (1UL << ((osr >> 3) & 0x07));
+    uint32_t period = bmp390OdrPeriodUs(registers[BMP390_REG_ODR] & 0x1F);
+    if (conversionUs > period) {
+        registers[BMP390_REG_ERR] |= BMP390_ERR_CONF;
+        normal = false;
+        return;
+    }
+
+    normal = true;
+    normalSince = halMicros();
+    conversionsRead = 0;
+}
+
+void FakeBmp390Bus::advanceBus(size_t bytes) {
+    transactions++;
+    bytesTransferred += bytes;
+    halAdvanceMicros((uint32_t)(((uint64_t)bytes * 9 * 1000000 + clockHz - 1) / clockHz));
+}
+
+bool FakeBmp390Bus::readRegisters(uint8_t address, uint8_t reg, uint8_t* buffer, size_t length) {
+    if (!present || address != BMP390_ADDRESS) {
+        advanceBus(1);           // 주소 NACK
+        return false;
+    }
+
+    // STATUS (DRDY는 아직 읽지 않은 변환이 있을 때)
+    bool ready = dataReady();
+    registers[BMP390_REG_STATUS] = ready ? BMP390_STATUS_DRDY_PRESS | BMP390_STATUS_DRDY_TEMP : 0;
+
+    // 데이터 레지스터까지 읽으면 마지막 변환 결과를 내주고 DRDY 해제
+    bool readsData = reg <= 0x04 && reg + length > 0x04;
+    if (readsData && ready) {
+        uint32_t rawTemperature = rawTemperatureFor(temperatureC);
+        uint32_t rawPressure = rawPressureFor(pressurePa, rawTemperature);
+        registers[0x04] = rawPressure & 0xFF;
+        registers[0x05] = (rawPressure >> 8) & 0xFF;
+        registers[0x06] = (rawPressure >> 16) & 0xFF;
+        registers[0x07] = rawTemperature & 0xFF;
+        registers[0x08] = (rawTemperature >> 8) & 0xFF;
+        registers[0x09] = (rawTemperature >> 16) & 0xFF;
+        conversionsRead = completedConversions();
+        dataReads++;
+    }
+    if (reg <= BMP390_REG_STATUS && reg + length > BMP390_REG_STATUS) statusReads++;
+
+    for (size_t i = 0; i < length; i++) {
+        buffer[i] = registers[(reg + i) & 0x7F];
+    }
+
+    // ERR는 읽으면 지워짐
+    if (reg <= BMP390_REG_ERR && reg + length > BMP390_REG_ERR) registers[BMP390_REG_ERR] = 0;
+
+    // 주소(W) + 레지스터 + 주소(R) + 데이터
+    advanceBus(3 + length);
+    return true;
+}
+
+bool FakeBmp390Bus::writeRegister(uint8_t address, uint8_t reg, uint8_t value) {
+    if (!present || address != BMP390_ADDRESS) {
+        advanceBus(1);
+        return false;
+    }
+    advanceBus(3);
+
+    if (reg == BMP390_REG_CMD) {
+        if (value == BMP390_CMD_SOFTRESET) {
+            // 설정 레지스터 초기화 (NVM/CHIP_ID는 유지)
+            uint8_t nvm[21];
+            memcpy(nvm, &registers[BMP390_REG_CALIB], sizeof(nvm));
+            memset(registers, 0, sizeof(registers));
+            registers[BMP390_REG_CHIP_ID] = BMP390_CHIP_ID;
+            memcpy(&registers[BMP390_REG_CALIB], nvm, sizeof(nvm));
+            registers[BMP390_REG_OSR] = 0x02;
+            normal = false;
         }
-        delay(10);
+        return true;
     }
-    
-    if (count > 0) {
-        baseAltitude = sum / count;
-        Serial.print("완료! 기준 고도: ");
-        Serial.print(baseAltitude, 2);
-        Serial.println(" m");
-    } else {
-        Serial.println("실패!");
+
+    registers[reg & 0x7F] = value;
+    if (reg == BMP390_REG_PWR_CTRL) {
+        if ((value & 0x30) == 0x30) startNormal();
+        else normal = false;
     }
-}
\ No newline at end of file
+    return true;
+}
+
+#endif
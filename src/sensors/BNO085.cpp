@@ -1,184 +1,643 @@
 // src/sensors/BNO085.cpp
 #include "sensors/BNO085.h"
+#include "Profiler.h"
 #include <math.h>
 
-BNO085::BNO085() {
-    accel_x = accel_y = accel_z = 0.0;
-    gyro_r = gyro_p = gyro_y = 0.0;
-    quat_i = quat_j = quat_k = quat_real = 0.0;
-    accel_roll = accel_pitch = accel_yaw = 0.0;
+// 리셋 후 재활성화할 리포트
+static const uint8_t REPORT_IDS[] = {
+    BNO085_REPORT_ACCELEROMETER, BNO085_REPORT_GYROSCOPE, BNO085_REPORT_ROTATION
+};
+static const uint8_t REPORT_COUNT = sizeof(REPORT_IDS) / sizeof(REPORT_IDS[0]);
+static const uint8_t ALL_REPORTS = (1 << REPORT_COUNT) - 1;
+
+BNO085* BNO085::instance = nullptr;
+
+void BNO085::onInterrupt() {
+    // I2C 접근은 하지 않음 - 시각만 기록
+    if (instance) {
+        instance->interruptMicros = halMicros();
+        instance->dataReady = true;
+    }
+}
+
+BNO085::BNO085(Sh2Device* sh2) {
+    device = sh2;
+    memset(&current, 0, sizeof(current));
+    current.quat.w = 1.0f;
+    sequence = 0;
+    memset(&derived, 0, sizeof(derived));   // 순번 0 = 아직 계산한 샘플 없음
     
     initialized = false;
     has_accel = false;
     has_gyro = false;
     has_quat = false;
     lastResetCheck = 0;
+    
+    dataReady = false;
+    interruptMicros = 0;
+    batchMicros = 0;
+    batchInterrupted = false;
+    batchCount = 0;
+    anchorCount = 0;
+    batchDropped = 0;
+    clockOffset = 0;
+    clockOffsetValid = false;
+    lastMappedMicros = 0;
+    lastEventMicros = 0;
+    reportIntervalUs = BNO085_REPORT_INTERVAL_US;
+    pendingReports = 0;
+    reportRetryAt = 0;
+    
+    initPhase = PHASE_START;
+    initWaitUntil = 0;
+    initAttempts = 0;
+}
+
+bool BNO085::begin(bool warmStart) {
+    InitStatus status;
+    while ((status = beginStep(warmStart)) == INIT_PENDING) {}
+    return status == INIT_READY;
 }
 
-bool BNO085::begin() {
-    Serial.println("BNO085 초기화 시작...");
+InitStatus BNO085::beginStep(bool warmStart) {
+    switch (initPhase) {
+        case PHASE_START:
+            device->open();
+            
+            initAttempts = 0;
+            initWaitUntil = halMicros() + (warmStart ? 0 : BNO085_SETTLE_US);
+            initPhase = PHASE_WAIT;
+            return INIT_PENDING;
+            
+        case PHASE_WAIT:
+            if ((int32_t)(halMicros() - initWaitUntil) < 0) return INIT_PENDING;
+            
+            if (!warmStart && initAttempts == 0) device->scan();
+            initPhase = PHASE_CONNECT;
+            return INIT_PENDING;
+            
+        case PHASE_CONNECT:
+            break;
+    }
     
-    pinMode(BNO085_INT, INPUT);
-    Wire1.begin();
-    Wire1.setClock(100000); // 100kHz (안정성)
-    delay(500);
+    initAttempts++;
+    if (!device->connect()) {
+        uint8_t attempts = warmStart ? 1 : BNO085_ATTEMPTS;
+        if (initAttempts < attempts) {
+            // 재시도 대기 (그동안 다른 장치 진행)
+            initWaitUntil = halMicros() + BNO085_RETRY_WAIT_US;
+            initPhase = PHASE_WAIT;
+            return INIT_PENDING;
+        }
+        
+        Serial.println("BNO085 초기화 실패! RST 핀 확인 또는 센서 재부팅 필요");
+        initPhase = PHASE_START;
+        initialized = false;
+        return INIT_FAILED;
+    }
     
-    // I2C 주소 스캔
-    Serial.print("I2C Wire1 스캔 중... ");
-    Wire1.beginTransmission(0x4A);
-    byte error1 = Wire1.endTransmission();
-    Wire1.beginTransmission(0x4B);
-    byte error2 = Wire1.endTransmission();
-    Serial.print("0x4A: ");
-    Serial.print(error1 == 0 ? "발견!" : "없음");
-    Serial.print(" (오류코드: ");
-    Serial.print(error1);
-    Serial.print("), 0x4B: ");
-    Serial.print(error2 == 0 ? "발견!" : "없음");
-    Serial.print(" (오류코드: ");
-    Serial.print(error2);
+    Serial.print("BNO085 초기화 성공! (");
+    Serial.print(device->describe());
+    Serial.print(", 시도 ");
+    Serial.print(initAttempts);
     Serial.println(")");
     
-    delay(100);
-    Serial.print("BNO085 연결 시도 (0x4A)... ");
-    
-    // 여러 번 시도
-    bool bno_success = false;
-    for (int attempt = 0; attempt < 3; attempt++) {
-        if (attempt > 0) {
-            Serial.print("재시도 ");
-            Serial.print(attempt);
-            Serial.print("... ");
-            delay(500);
+    // 패킷에 묶인 리포트를 하나씩 받음
+    device->setReportHandler(onReport, this);
+    initPhase = PHASE_START;
+    initialized = true;
+    
+    // 리포트는 update()에서 비블로킹으로 활성화
+    pendingReports = ALL_REPORTS;
+    reportRetryAt = halMillis();
+    
+    // H_INTN은 active-low - 데이터가 준비되면 떨어짐
+    instance = this;
+    device->attachDataReady(onInterrupt);
+    
+    return INIT_READY;
+}
+
+void BNO085::onReport(void* context, const ImuEvent& event) {
+    ((BNO085*)context)->pushEvent(event);
+}
+
+void BNO085::pushEvent(const ImuEvent& report) {
+    // 쓰는 리포트만 (허브 시각 그대로, flushBatch에서 halMicros로 옮김)
+    if (report.sensorId != BNO085_REPORT_ACCELEROMETER && report.sensorId != BNO085_REPORT_GYROSCOPE &&
+        report.sensorId != BNO085_REPORT_ROTATION) return;
+    
+    if (batchCount >= BNO085_BATCH_SIZE) {
+        batchDropped++;
+        return;
+    }
+    batch[batchCount++] = report;
+}
+
+void BNO085::flushBatch() {
+    if (batchCount == 0) return;
+    
+    // 인터럽트를 일으킨 첫 패킷의 가장 늦은 리포트가 인터럽트 시각이 되도록 오프셋 하나를 전체에 적용
+    // (리포트 사이 간격은 허브 시각 그대로라 같은 배치의 샘플도 서로 다른 시각을 가짐)
+    // 에지 없이 이어 읽은 배치는 마지막 오프셋을 그대로 (허브 시계는 연속)
+    uint32_t offset = clockOffset;
+    if (batchInterrupted || !clockOffsetValid) {
+        uint8_t count = anchorCount ? anchorCount : batchCount;
+        uint32_t latest = batch[0].timestamp;
+        for (uint8_t i = 1; i < count; i++) {
+            if ((int32_t)(batch[i].timestamp - latest) > 0) latest = batch[i].timestamp;
         }
-        
-        if (bno08x.begin_I2C(0x4A, &Wire1, BNO085_INT)) {
-            Serial.println("성공!");
-            bno_success = true;
-            delay(100);
-            
-            // 센서 리포트 활성화
-            Serial.println("센서 리포트 활성화 중...");
-            if (bno08x.enableReport(SH2_ACCELEROMETER, 50000)) {
-                Serial.println("  - 가속도계 활성화 성공");
-            }
-            if (bno08x.enableReport(SH2_GYROSCOPE_CALIBRATED, 50000)) {
-                Serial.println("  - 자이로 활성화 성공");
-            }
-            if (bno08x.enableReport(SH2_ROTATION_VECTOR, 50000)) {
-                Serial.println("  - 회전벡터 활성화 성공");
-            }
-            break;
+        offset = (batchInterrupted ? batchMicros : halMicros()) - latest;
+        if (batchInterrupted) {
+            clockOffset = offset;
+            clockOffsetValid = true;
         }
     }
     
-    if (!bno_success) {
-        Serial.println("실패! RST 핀 확인 또는 센서 재부팅 필요");
+    for (uint8_t i = 0; i < batchCount; i++) {
+        uint32_t mapped = batch[i].timestamp + offset;
+        // 인터럽트 지연 편차로 이전 배치보다 앞서지 않게
+        if (lastMappedMicros != 0 && (int32_t)(mapped - lastMappedMicros) < 0) mapped = lastMappedMicros;
+        batch[i].timestamp = mapped;
+        lastMappedMicros = mapped;
+        events.push(batch[i]);
     }
+    batchCount = 0;
+}
+
+void BNO085::service() {
+    if (!initialized) return;
+    
+    // 인터럽트 플래그도 없고 H_INTN도 HIGH면 읽을 데이터 없음
+    if (!dataReady && !device->interruptAsserted()) return;
     
-    initialized = bno_success;
-    return bno_success;
+    halNoInterrupts();
+    batchInterrupted = dataReady;
+    dataReady = false;
+    batchMicros = interruptMicros;
+    halInterrupts();
+    
+    // SHTP 패킷 하나에 그 시점에 준비된 리포트(가속도/자이로/회전 벡터)가 모두 묶여 옴
+    // 패킷당 한 번의 전송으로 읽고, 콜백이 리포트마다 링에 넣음
+    device->service();
+    anchorCount = batchCount;
+    uint8_t transfers = 1;
+    while (transfers++ < BNO085_MAX_TRANSFERS && device->interruptAsserted()) {
+        device->service();
+    }
+    flushBatch();
+}
+
+void BNO085::serviceReports() {
+    if ((long)(halMillis() - reportRetryAt) < 0) return;  // 재시도 대기 중
+    
+    // 한 번에 리포트 하나만 활성화
+    for (uint8_t i = 0; i < REPORT_COUNT; i++) {
+        if (pendingReports & (1 << i)) {
+            if (device->enableReport(REPORT_IDS[i], reportIntervalUs)) {
+                pendingReports &= ~(1 << i);
+            } else {
+                reportRetryAt = halMillis() + 10;
+            }
+            return;
+        }
+    }
+}
+
+void BNO085::setReportInterval(uint32_t intervalUs) {
+    if (intervalUs == reportIntervalUs) return;
+    reportIntervalUs = intervalUs;
+    
+    // 초기화 전이면 연결 후 새 주기로 활성화됨
+    if (initialized) {
+        pendingReports = ALL_REPORTS;
+        reportRetryAt = halMillis();
+    }
 }
 
 void BNO085::update() {
     if (!initialized) return;
+    PROFILE_SCOPE(PROBE_IMU_UPDATE);
     
     // 리셋 체크 (1초에 한 번)
-    if (millis() - lastResetCheck > 1000) {
-        lastResetCheck = millis();
-        if (bno08x.wasReset()) {
+    if (halMillis() - lastResetCheck > 1000) {
+        lastResetCheck = halMillis();
+        if (device->wasReset()) {
             Serial.println("BNO085 - 리셋 감지됨, 재활성화 중...");
-            bno08x.enableReport(SH2_ACCELEROMETER, 50000);
-            bno08x.enableReport(SH2_GYROSCOPE_CALIBRATED, 50000);
-            bno08x.enableReport(SH2_ROTATION_VECTOR, 50000);
-            delay(100);
+            pendingReports = ALL_REPORTS;
+            reportRetryAt = halMillis();
         }
     }
     
-    // 센서 이벤트 읽기
-    while (bno08x.getSensorEvent(&sensorValue)) {
-        switch (sensorValue.sensorId) {
-            case SH2_ACCELEROMETER:
-                accel_x = sensorValue.un.accelerometer.x;
-                accel_y = sensorValue.un.accelerometer.y;
-                accel_z = sensorValue.un.accelerometer.z;
-                has_accel = true;
-                
-                // 가속도 변환 (쿼터니언 있을 때만)
-                if (has_quat) {
-                    transformAccelToRPY();
-                }
-                break;
-                
-            case SH2_GYROSCOPE_CALIBRATED:
-                has_gyro = true;
-                break;
-                
-            case SH2_ROTATION_VECTOR:
-                quat_i = sensorValue.un.rotationVector.i;
-                quat_j = sensorValue.un.rotationVector.j;
-                quat_k = sensorValue.un.rotationVector.k;
-                quat_real = sensorValue.un.rotationVector.real;
-                has_quat = true;
-                
-                // 쿼터니언을 오일러각으로 변환
-                quaternionToEuler();
-                
-                // 가속도 변환 (가속도 데이터 있을 때만)
-                if (has_accel) {
-                    transformAccelToRPY();
-                }
-                break;
+    if (pendingReports) {
+        serviceReports();
+    }
+    
+    service();
+    
+    // 링의 이벤트를 순서대로 반영
+    ImuEvent event;
+    while (events.pop(event)) {
+        applyEvent(event);
+    }
+}
+
+void BNO085::applyEvent(const ImuEvent& event) {
+    lastEventMicros = event.timestamp;
+    
+    switch (event.sensorId) {
+        case BNO085_REPORT_ACCELEROMETER:
+            current.accel.x = event.x;
+            current.accel.y = event.y;
+            current.accel.z = event.z;
+            has_accel = true;
+            return;
+            
+        case BNO085_REPORT_GYROSCOPE:
+            current.rate.x = event.x;
+            current.rate.y = event.y;
+            current.rate.z = event.z;
+            has_gyro = true;
+            return;
+            
+        case BNO085_REPORT_ROTATION:
+            current.quat.x = event.x;
+            current.quat.y = event.y;
+            current.quat.z = event.z;
+            current.quat.w = event.w;
+            has_quat = true;
+            break;
+            
+        default:
+            return;
+    }
+    
+    // 융합 출력(회전 벡터)마다 한 번, 원시 값만 발행 (오일러각/월드 가속도는 요청 시 계산)
+    current.sequence = ++sequence;
+    samples.push(current, event.timestamp);
+}
+
+const ImuSnapshot& BNO085::derive(const Sample<ImuSample>& sample) {
+    if (sample.value.sequence == derived.sample.sequence) return derived;
+    
+    // 회전행렬 한 번으로 오일러각과 월드 가속도 (R·v = q·v·q*)
+    Mat3 rotation = quatToMatrix(sample.value.quat);
+    derived.timestamp = sample.timestamp;
+    derived.sample = sample.value;
+    matrixToEuler(rotation, derived.roll, derived.pitch, derived.yaw);
+    derived.accelWorld = rotation.apply(sample.value.accel);
+    return derived;
+}
+
+ImuSnapshot BNO085::snapshot() {
+    Sample<ImuSample> latest;
+    if (!samples.latest(latest)) return derived;   // 샘플 전 (순번 0)
+    return derive(latest);
+}
+
+bool BNO085::snapshotAt(uint32_t timestamp, ImuSnapshot& out) {
+    Sample<ImuSample> sample;
+    if (!samples.at(timestamp, sample)) return false;
+    out = derive(sample);
+    return true;
+}
+
+// ---- 장치 ----
+
+#ifdef ARDUINO
+
+static_assert(BNO085_REPORT_ACCELEROMETER == SH2_ACCELEROMETER, "SH2 accelerometer id");
+static_assert(BNO085_REPORT_GYROSCOPE == SH2_GYROSCOPE_CALIBRATED, "SH2 calibrated gyroscope id");
+static_assert(BNO085_REPORT_ROTATION == SH2_ROTATION_VECTOR, "SH2 rotation vector id");
+
+void Bno08xDevice::open() {
+    pinMode(BNO085_INT, INPUT);
+#ifndef BNO085_TRANSPORT_SPI
+    Wire1.begin();
+#endif
+}
+
+void Bno08xDevice::scan() {
+#ifndef BNO085_TRANSPORT_SPI
+    // I2C 주소 스캔
+    Serial.print("I2C Wire1 스캔 - 0x4A: ");
+    Wire1.beginTransmission(0x4A);
+    Serial.print(Wire1.endTransmission() == 0 ? "발견!" : "없음");
+    Serial.print(", 0x4B: ");
+    Wire1.beginTransmission(0x4B);
+    Serial.println(Wire1.endTransmission() == 0 ? "발견!" : "없음");
+#endif
+}
+
+bool Bno08xDevice::connect() {
+#ifdef BNO085_TRANSPORT_SPI
+    if (!bno08x.begin_SPI(BNO085_CS, BNO085_INT, &SPI)) return false;
+#else
+    if (!bno08x.begin_I2C(BNO085_I2C_ADDRESS, &Wire1, BNO085_INT)) return false;
+    
+    // Wire.begin()이 클럭을 100 kHz로 되돌리므로 연결 후 설정
+    Wire1.setClock(BNO085_I2C_CLOCK);
+#endif
+    sh2_setSensorCallback(onSensorEvent, this);
+    return true;
+}
+
+const char* Bno08xDevice::describe() {
+#ifdef BNO085_TRANSPORT_SPI
+    return "SPI";
+#else
+    return "0x4A, 400 kHz";
+#endif
+}
+
+bool Bno08xDevice::enableReport(uint8_t sensorId, uint32_t intervalUs) {
+    return bno08x.enableReport((sh2_SensorId_t)sensorId, intervalUs);
+}
+
+void Bno08xDevice::attachDataReady(void (*isr)()) {
+    // H_INTN은 active-low - 데이터가 준비되면 떨어짐
+    attachInterrupt(digitalPinToInterrupt(BNO085_INT), isr, FALLING);
+}
+
+void Bno08xDevice::onSensorEvent(void* cookie, sh2_SensorEvent_t* event) {
+    Bno08xDevice* self = (Bno08xDevice*)cookie;
+    if (!self->handler) return;
+    if (sh2_decodeSensorEvent(&self->sensorValue, event) != SH2_OK) return;
+    
+    // 센서 허브가 측정한 리포트 시각 (us, 허브 시계)
+    const sh2_SensorValue_t& value = self->sensorValue;
+    ImuEvent report;
+    report.timestamp = (uint32_t)value.timestamp;
+    report.sensorId = value.sensorId;
+    
+    switch (value.sensorId) {
+        case SH2_ACCELEROMETER:
+            report.x = value.un.accelerometer.x;
+            report.y = value.un.accelerometer.y;
+            report.z = value.un.accelerometer.z;
+            report.w = 0.0;
+            break;
+            
+        case SH2_GYROSCOPE_CALIBRATED:
+            report.x = value.un.gyroscope.x;
+            report.y = value.un.gyroscope.y;
+            report.z = value.un.gyroscope.z;
+            report.w = 0.0;
+            break;
+            
+        case SH2_ROTATION_VECTOR:
+            report.x = value.un.rotationVector.i;
+            report.y = value.un.rotationVector.j;
+            report.z = value.un.rotationVector.k;
+            report.w = value.un.rotationVector.real;
+            break;
+            
+        default:
+            return;
+    }
+    
+    self->handler(self->handlerContext, report);
+}
+
+#else
+
+FakeSh2Device::FakeSh2Device(bool spiTransport, uint32_t clockHz) {
+    spi = spiTransport;
+    busClockHz = clockHz;
+    hubOffset = 0x40000000;      // 허브 시계는 호스트 시계와 무관한 값에서 시작
+    
+    present = true;
+    failedConnects = 0;
+    resetFlag = false;
+    memset(intervalUs, 0, sizeof(intervalUs));
+    memset(nextDue, 0, sizeof(nextDue));
+    
+    accel.x = 0.0f; accel.y = 0.0f; accel.z = 9.80665f;      // 정지 (중력 반력)
+    rate.x = 0.0f; rate.y = 0.0f; rate.z = 0.0f;
+    quat.w = 1.0f; quat.x = 0.0f; quat.y = 0.0f; quat.z = 0.0f;
+    
+    memset(queue, 0, sizeof(queue));
+    queueHead = 0;
+    queueTail = 0;
+    
+    lineLow = false;
+    isr = nullptr;
+    
+    transactions = 0;
+    bytesTransferred = 0;
+    packets = 0;
+    reports = 0;
+    memset(reportsById, 0, sizeof(reportsById));
+}
+
+uint8_t FakeSh2Device::reportIndex(uint8_t sensorId) {
+    for (uint8_t i = 0; i < REPORT_COUNT; i++) {
+        if (REPORT_IDS[i] == sensorId) return i;
+    }
+    return FAKE_SH2_REPORTS;
+}
+
+uint8_t FakeSh2Device::reportSize(uint8_t sensorId) {
+    // SH-2 레퍼런스 매뉴얼 6.5 (리포트 ID, 순번, 상태, 지연 4바이트 + 값)
+    switch (sensorId) {
+        case BNO085_REPORT_ACCELEROMETER: return 10;
+        case BNO085_REPORT_GYROSCOPE:     return 10;
+        case BNO085_REPORT_ROTATION:      return 14;   // ijk + real + 정확도
+        default:                          return 0;
+    }
+}
+
+size_t FakeSh2Device::packetLength(const uint8_t* sensorIds, uint8_t count) {
+    size_t length = BNO085_SHTP_HEADER_SIZE + BNO085_BASE_TIMESTAMP_SIZE;
+    for (uint8_t i = 0; i < count; i++) {
+        length += reportSize(sensorIds[i]);
+    }
+    return length;
+}
+
+bool FakeSh2Device::connect() {
+    if (!present) return false;
+    if (failedConnects > 0) {
+        failedConnects--;
+        return false;
+    }
+    return true;
+}
+
+bool FakeSh2Device::enableReport(uint8_t sensorId, uint32_t interval) {
+    uint8_t index = reportIndex(sensorId);
+    if (!present || index >= FAKE_SH2_REPORTS) return false;
+    
+    intervalUs[index] = interval;
+    nextDue[index] = hubMicros() + interval;
+    
+    // 같은 주기의 리포트는 허브가 한 패킷으로 묶어 보냄
+    for (uint8_t i = 0; i < FAKE_SH2_REPORTS; i++) {
+        if (i != index && intervalUs[i] == interval) {
+            nextDue[index] = nextDue[i];
+            break;
+        }
+    }
+    
+    // Set Feature 명령 (헤더 + 17바이트) 쓰기 한 번
+    transactions++;
+    bytesTransferred += BNO085_SHTP_HEADER_SIZE + 17 + (spi ? 0 : 1);
+    return true;
+}
+
+bool FakeSh2Device::wasReset() {
+    bool was = resetFlag;
+    resetFlag = false;
+    return was;
+}
+
+void FakeSh2Device::reset() {
+    memset(intervalUs, 0, sizeof(intervalUs));
+    queueHead = 0;
+    queueTail = 0;
+    resetFlag = true;
+}
+
+uint32_t FakeSh2Device::getReports(uint8_t sensorId) {
+    uint8_t index = reportIndex(sensorId);
+    return index < FAKE_SH2_REPORTS ? reportsById[index] : 0;
+}
+
+uint32_t FakeSh2Device::getReportInterval(uint8_t sensorId) {
+    uint8_t index = reportIndex(sensorId);
+    return index < FAKE_SH2_REPORTS ? intervalUs[index] : 0;
+}
+
+void FakeSh2Device::setMotion(const Vec3& acceleration, const Vec3& angularRate, const Quat& orientation) {
+    accel = acceleration;
+    rate = angularRate;
+    quat = orientation;
+}
+
+bool FakeSh2Device::queuePacket(const ImuEvent* events, uint8_t count) {
+    if (count == 0 || count > FAKE_SH2_PACKET_MAX) return false;
+    if ((uint8_t)(queueHead - queueTail) >= FAKE_SH2_QUEUE_SIZE) return false;
+    
+    QueuedPacket& packet = queue[queueHead % FAKE_SH2_QUEUE_SIZE];
+    memcpy(packet.reports, events, count * sizeof(ImuEvent));
+    packet.count = count;
+    queueHead++;
+    return true;
+}
+
+bool FakeSh2Device::nextGeneratedDue(uint32_t& due) {
+    bool found = false;
+    for (uint8_t i = 0; i < FAKE_SH2_REPORTS; i++) {
+        if (intervalUs[i] == 0) continue;
+        if (!found || (int32_t)(nextDue[i] - due) < 0) {
+            due = nextDue[i];
+            found = true;
         }
     }
+    return found;
+}
+
+bool FakeSh2Device::interruptAsserted() {
+    if (queueHead != queueTail) return true;
+    uint32_t due = 0;
+    return nextGeneratedDue(due) && (int32_t)(hubMicros() - due) >= 0;
+}
+
+bool FakeSh2Device::nextInterruptAt(uint32_t& when) {
+    if (queueHead != queueTail) {
+        when = halMicros();
+        return true;
+    }
+    uint32_t due = 0;
+    if (!nextGeneratedDue(due)) return false;
+    when = due - hubOffset;
+    return true;
+}
+
+void FakeSh2Device::tick() {
+    bool asserted = interruptAsserted();
+    if (asserted && !lineLow && isr) isr();
+    lineLow = asserted;
 }
 
-void BNO085::quaternionToEuler() {
-    // 쿼터니언 -> 오일러각 (Roll, Pitch, Yaw) 변환
-    // Roll (X축 회전)
-    float sinr_cosp = 2.0 * (quat_real * quat_i + quat_j * quat_k);
-    float cosr_cosp = 1.0 - 2.0 * (quat_i * quat_i + quat_j * quat_j);
-    gyro_r = atan2(sinr_cosp, cosr_cosp) * 180.0 / M_PI;
+void FakeSh2Device::countRead(size_t length) {
+    uint32_t count = 1;
+    uint32_t bytes = BNO085_SHTP_HEADER_SIZE;
+    size_t remaining = length > BNO085_SHTP_HEADER_SIZE ? length - BNO085_SHTP_HEADER_SIZE : 0;
     
-    // Pitch (Y축 회전)
-    float sinp = 2.0 * (quat_real * quat_j - quat_k * quat_i);
-    if (fabs(sinp) >= 1)
-        gyro_p = copysign(M_PI / 2, sinp) * 180.0 / M_PI;
-    else
-        gyro_p = asin(sinp) * 180.0 / M_PI;
+    if (spi) {
+        // 헤더로 길이를 읽고 패킷 전체를 한 번에
+        if (remaining > 0) {
+            count++;
+            bytes += length;
+        }
+    } else {
+        // 헤더로 길이를 읽고, Wire 버퍼 크기 청크마다 헤더를 다시 읽으며 나머지
+        while (remaining > 0) {
+            size_t cargo = BNO085_I2C_CHUNK_SIZE - BNO085_SHTP_HEADER_SIZE;
+            if (remaining < cargo) cargo = remaining;
+            count++;
+            bytes += BNO085_SHTP_HEADER_SIZE + cargo;
+            remaining -= cargo;
+        }
+        bytes += count;          // 트랜잭션마다 주소 바이트
+    }
+    transactions += count;
+    bytesTransferred += bytes;
     
-    // Yaw (Z축 회전)
-    float siny_cosp = 2.0 * (quat_real * quat_k + quat_i * quat_j);
-    float cosy_cosp = 1.0 - 2.0 * (quat_j * quat_j + quat_k * quat_k);
-    gyro_y = atan2(siny_cosp, cosy_cosp) * 180.0 / M_PI;
+    // 블로킹 전송 시간만큼 시계 진행 (I2C 바이트당 9클럭, SPI 8클럭)
+    uint64_t clocks = (uint64_t)bytes * (spi ? 8 : 9);
+    halAdvanceMicros((uint32_t)((clocks * 1000000 + busClockHz - 1) / busClockHz));
 }
 
-void BNO085::transformAccelToRPY() {
-    // 쿼터니언을 사용하여 센서 좌표계(XYZ)의 가속도를
-    // 월드 좌표계(RPY 방향)로 변환
+void FakeSh2Device::service() {
+    ImuEvent events[FAKE_SH2_PACKET_MAX];
+    uint8_t count = 0;
     
-    // 쿼터니언 회전 공식: v' = q * v * q^(-1)
-    // 여기서는 역회전을 적용 (센서->월드)
+    if (queueHead != queueTail) {
+        const QueuedPacket& packet = queue[queueTail % FAKE_SH2_QUEUE_SIZE];
+        memcpy(events, packet.reports, packet.count * sizeof(ImuEvent));
+        count = packet.count;
+        queueTail++;
+    } else {
+        // 같은 시각에 준비된 리포트를 한 패킷으로
+        uint32_t due = 0;
+        if (nextGeneratedDue(due) && (int32_t)(hubMicros() - due) >= 0) {
+            for (uint8_t i = 0; i < FAKE_SH2_REPORTS; i++) {
+                if (intervalUs[i] == 0 || nextDue[i] != due) continue;
+                
+                ImuEvent& event = events[count++];
+                event.timestamp = due;
+                event.sensorId = REPORT_IDS[i];
+                if (event.sensorId == BNO085_REPORT_ROTATION) {
+                    event.x = quat.x; event.y = quat.y; event.z = quat.z; event.w = quat.w;
+                } else {
+                    const Vec3& value = event.sensorId == BNO085_REPORT_ACCELEROMETER ? accel : rate;
+                    event.x = value.x; event.y = value.y; event.z = value.z; event.w = 0.0f;
+                }
+                nextDue[i] += intervalUs[i];
+            }
+        }
+    }
     
-    // 쿼터니언의 켤레 (역회전용)
-    float q_conj_i = -quat_i;
-    float q_conj_j = -quat_j;
-    float q_conj_k = -quat_k;
-    float q_conj_real = quat_real;
+    // 읽을 패킷이 없어도 헤더는 읽음 (길이 0)
+    uint8_t ids[FAKE_SH2_PACKET_MAX];
+    for (uint8_t i = 0; i < count; i++) ids[i] = events[i].sensorId;
+    countRead(count ? packetLength(ids, count) : BNO085_SHTP_HEADER_SIZE);
     
-    // 첫 번째 곱셈: q * v
-    float temp_real = -quat_i * accel_x - quat_j * accel_y - quat_k * accel_z;
-    float temp_i = quat_real * accel_x + quat_j * accel_z - quat_k * accel_y;
-    float temp_j = quat_real * accel_y + quat_k * accel_x - quat_i * accel_z;
-    float temp_k = quat_real * accel_z + quat_i * accel_y - quat_j * accel_x;
+    // 읽기가 시작되면 H_INTN이 올라감 (다음 패킷은 다시 하강 에지)
+    lineLow = false;
+    if (count == 0) return;
     
-    // 두 번째 곱셈: (q * v) * q^(-1)
-    accel_roll = temp_i * q_conj_real + temp_real * q_conj_i + 
-                 temp_j * q_conj_k - temp_k * q_conj_j;
-    accel_pitch = temp_j * q_conj_real + temp_real * q_conj_j + 
-                  temp_k * q_conj_i - temp_i * q_conj_k;
-    accel_yaw = temp_k * q_conj_real + temp_real * q_conj_k + 
-                temp_i * q_conj_j - temp_j * q_conj_i;
+    packets++;
+    reports += count;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t index = reportIndex(events[i].sensorId);
+        if (index < FAKE_SH2_REPORTS) reportsById[index]++;
+        if (handler) handler(handlerContext, events[i]);
+    }
 }
 
+#endif
+
 /*test*/
\ No newline at end of file
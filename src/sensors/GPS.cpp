@@ -1,38 +1,205 @@
 // src/sensors/GPS.cpp
 #include "sensors/GPS.h"
+#include "Telemetry.h"
+#include "Profiler.h"
 
-GPS::GPS() : gps(&GPSSerial) {
+GPS::GPS(UartPort* uart) {
+    port = uart;
     initialized = false;
+    sentenceHandler = nullptr;
+
+    baud = GPS_FAST_BAUD;
+    updateHz = GPS_UPDATE_HZ;
+
+    initPhase = PHASE_START;
+    initWaitUntil = 0;
+    memset(&current, 0, sizeof(current));
+}
+
+void GPS::configure(uint32_t baudRate, uint8_t rateHz) {
+    baud = baudRate;
+    updateHz = rateHz > 0 ? rateHz : 1;
+}
+
+void GPS::setUpdateRate(uint8_t rateHz) {
+    if (rateHz == 0) rateHz = 1;
+    if (rateHz == updateHz) return;
+    updateHz = rateHz;
+    if (initialized) configureOutput();
+}
+
+#ifdef GPS_PROTOCOL_UBX
+
+void GPS::sendMessage(uint8_t cls, uint8_t id, const uint8_t* body, uint16_t length) {
+    uint8_t frame[32];
+    size_t size = UBXParser::buildFrame(cls, id, body, length, frame);
+    port->write(frame, size);
+}
+
+void GPS::sendPortConfig(uint32_t baudRate) {
+    // CFG-PRT: UART1, 8N1, 입출력 모두 UBX만
+    uint8_t body[20] = { 0 };
+    body[0] = 1;                                    // portID
+    body[4] = 0xD0; body[5] = 0x08;                 // mode: 8비트, 패리티 없음, 정지 1비트
+    body[8] = baudRate & 0xFF;
+    body[9] = (baudRate >> 8) & 0xFF;
+    body[10] = (baudRate >> 16) & 0xFF;
+    body[11] = (baudRate >> 24) & 0xFF;
+    body[12] = 0x01;                                // inProtoMask: UBX
+    body[14] = 0x01;                                // outProtoMask: UBX
+    sendMessage(UBX_CLASS_CFG, UBX_CFG_PRT, body, sizeof(body));
+}
+
+void GPS::requestBaud() {
+    sendPortConfig(baud);
+}
+
+void GPS::configureOutput() {
+    // 기본 속도를 유지하는 경우에도 NMEA 출력은 끔
+    if (baud == GPS_DEFAULT_BAUD) sendPortConfig(baud);
+
+    // CFG-RATE: 측정 주기 (ms), 항법 1회/측정, UTC 기준
+    uint16_t intervalMs = 1000 / updateHz;
+    uint8_t rate[6] = { (uint8_t)(intervalMs & 0xFF), (uint8_t)(intervalMs >> 8), 1, 0, 0, 0 };
+    sendMessage(UBX_CLASS_CFG, UBX_CFG_RATE, rate, sizeof(rate));
+
+    // CFG-MSG: 현재 포트에 NAV-PVT 매 측정마다
+    uint8_t message[3] = { UBX_CLASS_NAV, UBX_NAV_PVT, 1 };
+    sendMessage(UBX_CLASS_CFG, UBX_CFG_MSG, message, sizeof(message));
+}
+
+bool GPS::decode(uint32_t now) {
+    (void)now;
+    if (parser.parse() != UBX_PVT) return false;
+
+    // 정수 필드 스케일만 적용 (문자열/실수 해석 없음)
+    const UBXData& data = parser.getData();
+    current.latitude = data.latitude * 1e-7f;
+    current.longitude = data.longitude * 1e-7f;
+    current.altitude = data.heightMSL * 1e-3f;
+    current.satellites = data.satellites;
+    current.fix = data.fix;
+    current.hour = data.hour;
+    current.minute = data.minute;
+    current.seconds = data.seconds;
+    return true;
+}
+
+#else
+
+void GPS::sendCommand(const char* body) {
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+    uint8_t checksum = 0;
+    for (const char* p = body; *p; p++) {
+        checksum ^= (uint8_t)*p;
+    }
+
+    char tail[5] = { '*', HEX_DIGITS[checksum >> 4], HEX_DIGITS[checksum & 0x0F], '\r', '\n' };
+    port->write((const uint8_t*)"$", 1);
+    port->write((const uint8_t*)body, strlen(body));
+    port->write((const uint8_t*)tail, sizeof(tail));
+}
+
+void GPS::sendCommand(const char* prefix, uint32_t value) {
+    char body[32];
+    CSVWriter command(body, sizeof(body));
+    command.appendString(prefix);
+    command.appendUInt(value);
+    sendCommand(body);
+}
+
+void GPS::requestBaud() {
+    sendCommand("PMTK251,", baud);
+}
+
+void GPS::configureOutput() {
+    // RMC + GGA만 출력, 갱신 주기 설정 (위치 계산은 최대 5 Hz)
+    uint32_t intervalMs = 1000 / updateHz;
+    sendCommand("PMTK314,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0");
+    sendCommand("PMTK220,", intervalMs);
+    sendCommand("PMTK300,", intervalMs < 200 ? 200 : intervalMs);
 }
 
+bool GPS::decode(uint32_t now) {
+    if (sentenceHandler) sentenceHandler(parser.sentence(), now);
+
+    // 수신 버퍼 안에서 바로 해석
+    if (parser.parse() == NMEA_NONE) return false;
+
+    const NMEAData& data = parser.getData();
+    current.latitude = data.latitude;
+    current.longitude = data.longitude;
+    current.altitude = data.altitude;
+    current.satellites = data.satellites;
+    current.fix = data.fix;
+    current.hour = data.hour;
+    current.minute = data.minute;
+    current.seconds = data.seconds;
+    return true;
+}
+
+#endif
+
 bool GPS::begin() {
-    Serial.print("GPS 초기화 중 (TX=0, RX=1)... ");
-    
-    gps.begin(9600);
-    gps.sendCommand(PMTK_SET_NMEA_OUTPUT_RMCGGA);
-    gps.sendCommand(PMTK_SET_NMEA_UPDATE_1HZ);
-    
-    Serial.println("완료!");
+    InitStatus status;
+    while ((status = beginStep()) == INIT_PENDING) {}
+    return status == INIT_READY;
+}
+
+InitStatus GPS::beginStep() {
+    switch (initPhase) {
+        case PHASE_START:
+            // 모듈은 전원 인가 시 기본 속도 (재시작이면 이미 빠른 속도일 수 있음 - 그래도 무해)
+            port->begin(GPS_DEFAULT_BAUD);
+            if (baud != GPS_DEFAULT_BAUD) {
+                requestBaud();
+                initWaitUntil = halMicros() + GPS_BAUD_SWITCH_US;
+                initPhase = PHASE_BAUD_WAIT;
+                return INIT_PENDING;
+            }
+            break;
+
+        case PHASE_BAUD_WAIT:
+            if ((int32_t)(halMicros() - initWaitUntil) < 0) return INIT_PENDING;
+            port->begin(baud);
+            break;
+    }
+
+    initPhase = PHASE_START;
+    configureOutput();
+
+    Serial.print("GPS 초기화 완료! (TX=0, RX=1, ");
+    Serial.print(baud);
+    Serial.print(" baud, ");
+    Serial.print(updateHz);
+    Serial.println(" Hz)");
+
+    parser.reset();
     initialized = true;
-    return true;
+    return INIT_READY;
 }
 
 void GPS::update() {
     if (!initialized) return;
-    
-    // GPS 데이터 읽기 (항상 수행)
-    char c = gps.read();
-    
-    // 새 NMEA 문장이 수신되면 파싱
-    if (gps.newNMEAreceived()) {
-        gps.parse(gps.lastNMEA());
+    PROFILE_SCOPE(PROBE_GPS_UPDATE);
+
+    // 수신 버퍼에 쌓인 바이트를 모두 처리 (한 번에 한 바이트씩 읽으면 루프가 느려질 때 넘침)
+    while (port->available() > 0) {
+        if (!parser.feed(port->read())) continue;
+
+        uint32_t now = halMicros();
+        if (decode(now)) {
+            samples.push(current, now);
+        }
     }
 }
 
-String GPS::getTimeString() {
-    if (!initialized || !gps.fix) return "NONE";
-    
-    char timeStr[9];
-    sprintf(timeStr, "%02d:%02d:%02d", gps.hour, gps.minute, gps.seconds);
-    return String(timeStr);
-}
\ No newline at end of file
+void GPS::getTimeString(char* buffer) {
+    if (!initialized || !current.fix) {
+        strcpy(buffer, "NONE");
+        return;
+    }
+
+    formatClockTime(buffer, current.hour, current.minute, current.seconds);
+}
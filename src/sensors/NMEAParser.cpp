@@ -0,0 +1,284 @@
+// src/sensors/NMEAParser.cpp
+#include "sensors/NMEAParser.h"
+#include <string.h>
+
+// ---- 문자 분류 ----
+
+enum CharClass : uint8_t {
+    CC_INVALID = 0,          // 제어 문자, 비 ASCII
+    CC_TEXT,                 // 본문 문자
+    CC_HEX,                  // 본문 문자이면서 16진수 (0-9, A-F)
+    CC_START,                // '$'
+    CC_DELIM,                // ','
+    CC_STAR,                 // '*'
+    CC_END,                  // '\r', '\n'
+    CC_COUNT
+};
+
+struct CharClassTable {
+    uint8_t cls[128];
+
+    constexpr CharClassTable() : cls() {
+        for (int c = 0x20; c < 0x7F; c++) cls[c] = CC_TEXT;
+        for (int c = '0'; c <= '9'; c++) cls[c] = CC_HEX;
+        for (int c = 'A'; c <= 'F'; c++) cls[c] = CC_HEX;
+        cls[(int)'$'] = CC_START;
+        cls[(int)','] = CC_DELIM;
+        cls[(int)'*'] = CC_STAR;
+        cls[(int)'\r'] = CC_END;
+        cls[(int)'\n'] = CC_END;
+    }
+};
+
+static constexpr CharClassTable CHAR_CLASS;
+
+// ---- 상태 전이 ----
+
+enum ParserState : uint8_t {
+    PS_IDLE = 0,             // '$' 대기
+    PS_BODY,                 // 본문
+    PS_CHECKSUM_HIGH,        // '*' 다음 첫 자리
+    PS_CHECKSUM_LOW,
+    PS_END,                  // 줄 끝 대기
+    PS_COUNT
+};
+
+enum ParserAction : uint8_t {
+    PA_IGNORE = 0,
+    PA_BEGIN,                // 새 문장 시작 (진행 중이던 문장은 버림)
+    PA_STORE,                // 본문 저장 + 체크섬
+    PA_STAR,
+    PA_HEX,                  // 체크섬 자리 누적
+    PA_FINISH,               // 체크섬 비교
+    PA_ERROR,                // 형식 오류 -> 버림
+};
+
+struct Transition {
+    uint8_t next;
+    uint8_t action;
+};
+
+// [상태][문자 분류]
+static const Transition TRANSITIONS[PS_COUNT][CC_COUNT] = {
+    // INVALID                  TEXT                      HEX                             START                 DELIM                   STAR                              END
+    { {PS_IDLE, PA_IGNORE},     {PS_IDLE, PA_IGNORE},     {PS_IDLE, PA_IGNORE},           {PS_BODY, PA_BEGIN},  {PS_IDLE, PA_IGNORE},   {PS_IDLE, PA_IGNORE},             {PS_IDLE, PA_IGNORE} },   // IDLE
+    { {PS_IDLE, PA_ERROR},      {PS_BODY, PA_STORE},      {PS_BODY, PA_STORE},            {PS_BODY, PA_BEGIN},  {PS_BODY, PA_STORE},    {PS_CHECKSUM_HIGH, PA_STAR},      {PS_IDLE, PA_ERROR} },    // BODY
+    { {PS_IDLE, PA_ERROR},      {PS_IDLE, PA_ERROR},      {PS_CHECKSUM_LOW, PA_HEX},      {PS_BODY, PA_BEGIN},  {PS_IDLE, PA_ERROR},    {PS_IDLE, PA_ERROR},              {PS_IDLE, PA_ERROR} },    // CHECKSUM_HIGH
+    { {PS_IDLE, PA_ERROR},      {PS_IDLE, PA_ERROR},      {PS_END, PA_HEX},               {PS_BODY, PA_BEGIN},  {PS_IDLE, PA_ERROR},    {PS_IDLE, PA_ERROR},              {PS_IDLE, PA_ERROR} },    // CHECKSUM_LOW
+    { {PS_IDLE, PA_ERROR},      {PS_IDLE, PA_ERROR},      {PS_IDLE, PA_ERROR},            {PS_BODY, PA_BEGIN},  {PS_IDLE, PA_ERROR},    {PS_IDLE, PA_ERROR},              {PS_IDLE, PA_FINISH} },   // END
+};
+
+// ---- 숫자 해석 (빈 필드면 false) ----
+
+static bool parseDouble(const char* s, double& out) {
+    if (!s || !*s) return false;
+
+    bool negative = false;
+    if (*s == '-') { negative = true; s++; }
+
+    double value = 0.0;
+    while (*s >= '0' && *s <= '9') {
+        value = value * 10.0 + (*s++ - '0');
+    }
+    if (*s == '.') {
+        s++;
+        double scale = 0.1;
+        while (*s >= '0' && *s <= '9') {
+            value += (*s++ - '0') * scale;
+            scale *= 0.1;
+        }
+    }
+
+    out = negative ? -value : value;
+    return true;
+}
+
+static bool parseUInt(const char* s, uint32_t& out) {
+    if (!s || !*s) return false;
+    uint32_t value = 0;
+    while (*s >= '0' && *s <= '9') {
+        value = value * 10 + (*s++ - '0');
+    }
+    out = value;
+    return true;
+}
+
+// ddmm.mmmm + 반구 -> degrees
+static bool parseCoordinate(const char* value, const char* hemisphere, double& out) {
+    double raw;
+    if (!parseDouble(value, raw) || !hemisphere || !*hemisphere) return false;
+
+    int degrees = (int)(raw / 100.0);
+    double result = degrees + (raw - degrees * 100.0) / 60.0;
+    out = (*hemisphere == 'S' || *hemisphere == 'W') ? -result : result;
+    return true;
+}
+
+static uint8_t twoDigits(const char* s) {
+    return (s[0] - '0') * 10 + (s[1] - '0');
+}
+
+// hhmmss.sss
+static void parseTime(const char* s, NMEAData& data) {
+    if (strlen(s) < 6) return;
+    data.hour = twoDigits(s);
+    data.minute = twoDigits(s + 2);
+    data.seconds = twoDigits(s + 4);
+
+    double fraction;
+    data.milliseconds = (s[6] == '.' && parseDouble(s + 6, fraction)) ? (uint16_t)(fraction * 1000.0 + 0.5) : 0;
+}
+
+// ---- 파서 ----
+
+const NMEAParser::SentenceEntry NMEAParser::SENTENCES[] = {
+    { "GGA", NMEA_GGA, &NMEAParser::parseGGA },
+    { "RMC", NMEA_RMC, &NMEAParser::parseRMC },
+};
+
+NMEAParser::NMEAParser() {
+    memset(&data, 0, sizeof(data));
+    sentences = 0;
+    parsed = 0;
+    checksumErrors = 0;
+    dropped = 0;
+    reset();
+}
+
+void NMEAParser::reset() {
+    line[0] = '\0';
+    length = 0;
+    state = PS_IDLE;
+    checksum = 0;
+    received = 0;
+    fieldCount = 0;
+}
+
+bool NMEAParser::feed(char c) {
+    uint8_t byte = (uint8_t)c;
+    uint8_t cls = byte < 128 ? CHAR_CLASS.cls[byte] : (uint8_t)CC_INVALID;
+    const Transition& t = TRANSITIONS[state][cls];
+    state = t.next;
+
+    switch (t.action) {
+        case PA_BEGIN:
+            // 끝나지 않은 문장이 있었으면 잘린 것
+            if (length > 0) dropped++;
+            length = 0;
+            checksum = 0;
+            received = 0;
+            break;
+
+        case PA_STORE:
+            if (length >= NMEA_MAX_LEN) {
+                dropped++;
+                length = 0;
+                state = PS_IDLE;
+                break;
+            }
+            line[length++] = c;
+            checksum ^= byte;
+            break;
+
+        case PA_STAR:
+            line[length] = '\0';
+            break;
+
+        case PA_HEX:
+            received = (received << 4) | (uint8_t)(c <= '9' ? c - '0' : c - 'A' + 10);
+            break;
+
+        case PA_FINISH: {
+            uint8_t expected = checksum;
+            length = 0;
+            if (received != expected) {
+                checksumErrors++;
+                return false;
+            }
+            sentences++;
+            return true;
+        }
+
+        case PA_ERROR:
+            dropped++;
+            length = 0;
+            break;
+
+        default:
+            break;
+    }
+    return false;
+}
+
+void NMEAParser::tokenize() {
+    // ','를 널 문자로 바꾸고 각 필드 시작 위치만 기록
+    fieldCount = 0;
+    char* p = line;
+    fields[fieldCount++] = p;
+    while (*p) {
+        if (*p == ',') {
+            *p = '\0';
+            if (fieldCount < NMEA_MAX_FIELDS) fields[fieldCount++] = p + 1;
+        }
+        p++;
+    }
+
+    // 없는 필드는 빈 문자열
+    for (uint8_t i = fieldCount; i < NMEA_MAX_FIELDS; i++) {
+        fields[i] = p;
+    }
+}
+
+NMEASentence NMEAParser::parse() {
+    tokenize();
+
+    // 토커(GP, GN, ...) 뒤 3글자로 구분
+    const char* type = fields[0];
+    if (strlen(type) != 5) return NMEA_NONE;
+
+    for (const SentenceEntry& entry : SENTENCES) {
+        if (strncmp(type + 2, entry.type, 3) == 0) {
+            (this->*entry.parser)();
+            parsed++;
+            return entry.id;
+        }
+    }
+    return NMEA_NONE;
+}
+
+void NMEAParser::parseGGA() {
+    // 1 시각, 2-3 위도, 4-5 경도, 6 품질, 7 위성 수, 8 HDOP, 9 고도
+    parseTime(fields[1], data);
+
+    double latitude, longitude;
+    if (parseCoordinate(fields[2], fields[3], latitude) && parseCoordinate(fields[4], fields[5], longitude)) {
+        data.latitude = latitude;
+        data.longitude = longitude;
+    }
+
+    uint32_t quality;
+    data.fix = parseUInt(fields[6], quality) && quality > 0;
+
+    uint32_t satellites;
+    if (parseUInt(fields[7], satellites)) data.satellites = satellites > 255 ? 255 : satellites;
+
+    double altitude;
+    if (parseDouble(fields[9], altitude)) data.altitude = altitude;
+}
+
+void NMEAParser::parseRMC() {
+    // 1 시각, 2 상태, 3-4 위도, 5-6 경도, 7 속도(knots), 8 방위
+    parseTime(fields[1], data);
+
+    data.fix = fields[2][0] == 'A';
+
+    double latitude, longitude;
+    if (parseCoordinate(fields[3], fields[4], latitude) && parseCoordinate(fields[5], fields[6], longitude)) {
+        data.latitude = latitude;
+        data.longitude = longitude;
+    }
+
+    double speed, course;
+    if (parseDouble(fields[7], speed)) data.speedKnots = speed;
+    if (parseDouble(fields[8], course)) data.course = course;
+}
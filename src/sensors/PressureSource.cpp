@@ -0,0 +1,88 @@
+// src/sensors/PressureSource.cpp
+#include "sensors/PressureSource.h"
+#include "HAL.h"
+#include <stdlib.h>
+
+// ---- 주입 ----
+
+InjectedPressureSource::InjectedPressureSource() {
+    resetStats();
+}
+
+bool InjectedPressureSource::inject(float pressureHpa, uint32_t timestamp) {
+    PressureReading reading;
+    reading.pressure = pressureHpa;
+    reading.temperature = 0.0;
+    reading.hasTemperature = false;
+    reading.timestamp = timestamp;
+    return pending.push(reading);
+}
+
+bool InjectedPressureSource::read(PressureReading& out) {
+    if (!pending.pop(out)) return false;
+
+    lastLag = halMicros() - out.timestamp;
+    if (lastLag > maxLag) maxLag = lastLag;
+    totalLag += lastLag;
+    consumed++;
+    return true;
+}
+
+void InjectedPressureSource::resetStats() {
+    consumed = 0;
+    lastLag = 0;
+    maxLag = 0;
+    totalLag = 0;
+}
+
+// ---- 궤적 재생 ----
+
+TracePressureSource::TracePressureSource() {
+    cursor = nullptr;
+    startMicros = 0;
+    hasNext = false;
+}
+
+void TracePressureSource::begin(const char* trace, uint32_t startTime) {
+    cursor = trace;
+    startMicros = startTime;
+    hasNext = false;
+}
+
+bool TracePressureSource::parseLine() {
+    while (cursor && *cursor) {
+        const char* line = cursor;
+
+        // 다음 줄 시작으로 이동
+        while (*cursor && *cursor != '\n') cursor++;
+        if (*cursor == '\n') cursor++;
+
+        // 머리글/빈 줄은 건너뜀
+        if (*line < '0' || *line > '9') continue;
+
+        char* end;
+        uint32_t elapsedMs = strtoul(line, &end, 10);
+        if (*end != ',') continue;
+        float pascals = strtof(end + 1, &end);
+        if (pascals <= 0.0f) continue;
+
+        next.pressure = pascals / 100.0f;
+        next.temperature = 0.0;
+        next.hasTemperature = false;
+        next.timestamp = startMicros + elapsedMs * 1000;
+        return true;
+    }
+    return false;
+}
+
+bool TracePressureSource::read(PressureReading& out) {
+    if (!hasNext) hasNext = parseLine();
+    if (!hasNext) return false;
+
+    // 기록된 시각이 되어야 내보냄
+    if ((int32_t)(halMicros() - next.timestamp) < 0) return false;
+
+    out = next;
+    hasNext = false;
+    return true;
+}
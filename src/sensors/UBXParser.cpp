@@ -0,0 +1,159 @@
+// src/sensors/UBXParser.cpp
+#include "sensors/UBXParser.h"
+#include <string.h>
+
+enum UBXState : uint8_t {
+    US_SYNC1 = 0,
+    US_SYNC2,
+    US_CLASS,
+    US_ID,
+    US_LENGTH_LOW,
+    US_LENGTH_HIGH,
+    US_PAYLOAD,
+    US_CK_A,
+    US_CK_B,
+};
+
+// 리틀엔디언 필드 읽기
+static uint16_t getU16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static int32_t getI32(const uint8_t* p) {
+    return (int32_t)((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+UBXParser::UBXParser() {
+    memset(&data, 0, sizeof(data));
+    frames = 0;
+    parsed = 0;
+    checksumErrors = 0;
+    dropped = 0;
+    reset();
+}
+
+void UBXParser::reset() {
+    state = US_SYNC1;
+    messageClass = 0;
+    messageId = 0;
+    length = 0;
+    index = 0;
+    ckA = ckB = 0;
+    receivedA = 0;
+}
+
+bool UBXParser::feed(uint8_t byte) {
+    switch (state) {
+        case US_SYNC1:
+            if (byte == UBX_SYNC1) state = US_SYNC2;
+            break;
+
+        case US_SYNC2:
+            // 0xB5 0xB5 0x62 처럼 동기 바이트가 겹쳐도 다시 맞춤
+            state = (byte == UBX_SYNC2) ? US_CLASS : (byte == UBX_SYNC1 ? US_SYNC2 : US_SYNC1);
+            break;
+
+        case US_CLASS:
+            ckA = ckB = 0;
+            checksum(byte);
+            messageClass = byte;
+            state = US_ID;
+            break;
+
+        case US_ID:
+            checksum(byte);
+            messageId = byte;
+            state = US_LENGTH_LOW;
+            break;
+
+        case US_LENGTH_LOW:
+            checksum(byte);
+            length = byte;
+            state = US_LENGTH_HIGH;
+            break;
+
+        case US_LENGTH_HIGH:
+            checksum(byte);
+            length |= (uint16_t)byte << 8;
+            if (length > UBX_MAX_PAYLOAD) {
+                // 버퍼보다 긴 프레임은 버리고 다음 동기 바이트부터
+                dropped++;
+                state = US_SYNC1;
+                break;
+            }
+            index = 0;
+            state = (length == 0) ? US_CK_A : US_PAYLOAD;
+            break;
+
+        case US_PAYLOAD:
+            checksum(byte);
+            payload[index++] = byte;
+            if (index >= length) state = US_CK_A;
+            break;
+
+        case US_CK_A:
+            receivedA = byte;
+            state = US_CK_B;
+            break;
+
+        case US_CK_B:
+            state = US_SYNC1;
+            if (receivedA != ckA || byte != ckB) {
+                checksumErrors++;
+                return false;
+            }
+            frames++;
+            return true;
+    }
+    return false;
+}
+
+UBXMessage UBXParser::parse() {
+    if (messageClass == UBX_CLASS_NAV && messageId == UBX_NAV_PVT && length == UBX_NAV_PVT_LEN) {
+        parsePVT();
+        parsed++;
+        return UBX_PVT;
+    }
+    return UBX_NONE;
+}
+
+void UBXParser::parsePVT() {
+    // NAV-PVT payload 오프셋 (u-blox 인터페이스 설명서)
+    data.year = getU16(&payload[4]);
+    data.month = payload[6];
+    data.day = payload[7];
+    data.hour = payload[8];
+    data.minute = payload[9];
+    data.seconds = payload[10];
+    data.fixType = payload[20];
+    data.fix = (payload[21] & UBX_PVT_FLAG_GNSS_FIX_OK) != 0;
+    data.satellites = payload[23];
+    data.longitude = getI32(&payload[24]);
+    data.latitude = getI32(&payload[28]);
+    data.heightMSL = getI32(&payload[36]);
+    data.velocityDown = getI32(&payload[56]);
+}
+
+size_t UBXParser::buildFrame(uint8_t cls, uint8_t id, const uint8_t* body, uint16_t length, uint8_t* frame) {
+    uint8_t* p = frame;
+    *p++ = UBX_SYNC1;
+    *p++ = UBX_SYNC2;
+    *p++ = cls;
+    *p++ = id;
+    *p++ = length & 0xFF;
+    *p++ = length >> 8;
+    if (length > 0) {
+        memcpy(p, body, length);
+        p += length;
+    }
+
+    // 체크섬은 클래스부터 payload 끝까지
+    uint8_t a = 0, b = 0;
+    for (uint8_t* q = frame + 2; q < p; q++) {
+        a += *q;
+        b += a;
+    }
+    *p++ = a;
+    *p++ = b;
+    return p - frame;
+}
@@ -0,0 +1,99 @@
+// test/test_altitude/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "Altitude.h"
+
+// 기준 식 (double)
+static double referenceAltitude(double pressure, double reference) {
+    return 44330.0 * (1.0 - pow(pressure / reference, 0.1903));
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_table_error_over_range(void) {
+    AltitudeConverter converter;
+    converter.setReference(1008.7f);
+
+    // 테이블 전 구간을 촘촘히 (격자점 사이 포함)
+    double worst = 0.0;
+    for (double p = ALTITUDE_TABLE_MIN_HPA; p <= ALTITUDE_TABLE_MAX_HPA; p += 0.0371) {
+        double error = fabs(converter.toAltitude((float)p) - referenceAltitude((float)p, 1008.7f));
+        if (error > worst) worst = error;
+    }
+    TEST_ASSERT_LESS_THAN(0.05, worst);
+
+    char line[64];
+    snprintf(line, sizeof(line), "worst table error %.4f m", worst);
+    TEST_MESSAGE(line);
+}
+
+void test_reference_is_zero_altitude(void) {
+    AltitudeConverter converter;
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 0.0f, converter.toAltitude(ALTITUDE_SEA_LEVEL_HPA));
+    TEST_ASSERT_EQUAL_FLOAT(ALTITUDE_SEA_LEVEL_HPA, converter.getReference());
+
+    converter.setReference(950.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 0.0f, converter.toAltitude(950.0f));
+    // 지상 부근 1 hPa 약 8.9 m
+    TEST_ASSERT_FLOAT_WITHIN(0.03f, (float)referenceAltitude(949.0, 950.0), converter.toAltitude(949.0f));
+}
+
+void test_out_of_range_and_invalid(void) {
+    AltitudeConverter converter;
+
+    // 테이블 밖은 정확한 식
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, (float)referenceAltitude(250.0, ALTITUDE_SEA_LEVEL_HPA), converter.toAltitude(250.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, (float)referenceAltitude(1150.0, ALTITUDE_SEA_LEVEL_HPA), converter.toAltitude(1150.0f));
+
+    // 잘못된 기준은 무시
+    converter.setReference(0.0f);
+    converter.setReference(NAN);
+    TEST_ASSERT_EQUAL_FLOAT(ALTITUDE_SEA_LEVEL_HPA, converter.getReference());
+
+    // 잘못된 기압은 NaN 대신 유한한 값
+    TEST_ASSERT_TRUE(isfinite(converter.toAltitude(-5.0f)));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, AltitudeConverter::pressurePower(NAN));
+}
+
+void test_monotonic(void) {
+    AltitudeConverter converter;
+    float previous = converter.toAltitude(ALTITUDE_TABLE_MIN_HPA);
+    for (float p = ALTITUDE_TABLE_MIN_HPA + 0.01f; p <= ALTITUDE_TABLE_MAX_HPA; p += 0.01f) {
+        float altitude = converter.toAltitude(p);
+        TEST_ASSERT_TRUE(altitude <= previous);
+        previous = altitude;
+    }
+}
+
+void test_cost_vs_powf(void) {
+    AltitudeConverter converter;
+    const int rounds = 2000000;
+    volatile float sink = 0.0f;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) sink = sink + converter.toAltitude(900.0f + (i & 1023) * 0.1f);
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) sink = sink + 44330.0f * (1.0f - powf((900.0f + (i & 1023) * 0.1f) / 1013.25f, 0.1903f));
+    auto t2 = std::chrono::steady_clock::now();
+
+    char line[96];
+    snprintf(line, sizeof(line), "toAltitude %.1f ns, powf %.1f ns (host)",
+             std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds,
+             std::chrono::duration<double, std::nano>(t2 - t1).count() / rounds);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_table_error_over_range);
+    RUN_TEST(test_reference_is_zero_altitude);
+    RUN_TEST(test_out_of_range_and_invalid);
+    RUN_TEST(test_monotonic);
+    RUN_TEST(test_cost_vs_powf);
+    return UNITY_END();
+}
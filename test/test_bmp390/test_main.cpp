@@ -0,0 +1,195 @@
+// test/test_bmp390/test_main.cpp
+// BMP390 드라이버를 가짜 레지스터 버스(FakeBmp390Bus)로: NVM 보정 계수, STATUS + 데이터 7바이트 연속 읽기, DRDY
+#include <unity.h>
+#include <stdio.h>
+#include "HAL.h"
+#include "sensors/BMP390.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// 리셋 대기 동안 시계를 진행하며 초기화
+static void startBmp(BMP390& bmp) {
+    Serial.setEnabled(false);
+    InitStatus status;
+    while ((status = bmp.beginStep()) == INIT_PENDING) halAdvanceMicros(500);
+    TEST_ASSERT_EQUAL(INIT_READY, status);
+}
+
+void test_parse_calibration(void) {
+    BMP390Calibration calib;
+    bmp390ParseCalibration(FakeBmp390Bus::DEFAULT_NVM, calib);
+
+    // 데이터시트 3.11.1 스케일 (NVM: T1 27263, T2 19136, T3 -7, P1 28000, P2 -2990, ... P11 -60)
+    TEST_ASSERT_TRUE(calib.t1 == 27263.0 * 256.0);
+    TEST_ASSERT_TRUE(calib.t2 == 19136.0 / 1073741824.0);
+    TEST_ASSERT_TRUE(calib.t3 == -7.0 / 281474976710656.0);
+    TEST_ASSERT_TRUE(calib.p1 == (28000.0 - 16384.0) / 1048576.0);
+    TEST_ASSERT_TRUE(calib.p2 == (-2990.0 - 16384.0) / 536870912.0);
+    TEST_ASSERT_TRUE(calib.p5 == 4000.0 * 8.0);
+    TEST_ASSERT_TRUE(calib.p6 == 30144.0 / 64.0);
+    TEST_ASSERT_TRUE(calib.p8 == -6.0 / 32768.0);
+    TEST_ASSERT_TRUE(calib.p9 == 16090.0 / 281474976710656.0);
+    TEST_ASSERT_TRUE(calib.p11 == -60.0 / 36893488147419103232.0);
+}
+
+// 데이터시트 8.5 부동소수점 보정 식을 위 NVM으로 유리수 정확 계산한 값
+struct CompensationVector {
+    uint32_t rawTemperature;
+    uint32_t rawPressure;
+    double celsius;
+    double pascals;
+};
+
+static const CompensationVector VECTORS[] = {
+    { 7500000, 4800000,  9.272564444,  89082.547419 },
+    { 7500000, 5500000,  9.272564444,  96926.652423 },
+    { 7500000, 6200000,  9.272564444, 104800.738275 },
+    { 8400000, 4800000, 25.268723005,  93882.220150 },
+    { 8400000, 5500000, 25.268723005, 101328.756925 },
+    { 8400000, 6200000, 25.268723005, 108805.720093 },
+    { 9200000, 4800000, 39.453708780,  98155.516577 },
+    { 9200000, 5500000, 39.453708780, 105252.103464 },
+    { 9200000, 6200000, 39.453708780, 112379.511842 },
+};
+
+void test_compensation_matches_datasheet_vectors(void) {
+    BMP390Calibration calib;
+    bmp390ParseCalibration(FakeBmp390Bus::DEFAULT_NVM, calib);
+
+    for (size_t i = 0; i < sizeof(VECTORS) / sizeof(VECTORS[0]); i++) {
+        const CompensationVector& v = VECTORS[i];
+        double celsius = bmp390CompensateTemperature(calib, v.rawTemperature);
+        double pascals = bmp390CompensatePressure(calib, v.rawPressure, celsius);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-6, v.celsius, celsius);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-3, v.pascals, pascals);
+    }
+}
+
+void test_begin_reads_nvm_and_configures(void) {
+    halSetMicros(0);
+    FakeBmp390Bus bus;
+    BMP390 bmp(&bus);
+    startBmp(bmp);
+
+    // 기본 설정: 50 Hz, 압력 4x, 온도 2x, IIR 3, normal 모드
+    TEST_ASSERT_EQUAL_HEX8(BMP390_ODR_50_HZ, bus.getRegister(BMP390_REG_ODR));
+    TEST_ASSERT_EQUAL_HEX8((BMP390_OSR_2X << 3) | BMP390_OSR_4X, bus.getRegister(BMP390_REG_OSR));
+    TEST_ASSERT_EQUAL_HEX8(BMP390_IIR_COEFF_3 << 1, bus.getRegister(BMP390_REG_CONFIG));
+    TEST_ASSERT_EQUAL_HEX8(BMP390_PWR_NORMAL, bus.getRegister(BMP390_REG_PWR_CTRL));
+
+    // 변환 하나가 끝나면 설정한 환경을 보정 경로로 그대로 돌려받음
+    bus.setEnvironment(95000.0, 12.5);
+    halAdvanceMicros(bmp390OdrPeriodUs(BMP390_ODR_50_HZ));
+    TEST_ASSERT_TRUE(bmp.update());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 950.00f, bmp.getPressure());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 12.5f, bmp.getTemperature());
+}
+
+void test_missing_chip_fails(void) {
+    halSetMicros(0);
+    FakeBmp390Bus bus;
+    bus.setPresent(false);
+    BMP390 bmp(&bus);
+    Serial.setEnabled(false);
+    TEST_ASSERT_EQUAL(INIT_FAILED, bmp.beginStep());
+    TEST_ASSERT_FALSE(bmp.isInitialized());
+}
+
+void test_one_burst_per_update_and_drdy(void) {
+    halSetMicros(0);
+    FakeBmp390Bus bus;
+    BMP390 bmp(&bus);
+    startBmp(bmp);
+    TEST_ASSERT_TRUE(bmp.configureRate(BMP390_ODR_100_HZ, BMP390_OSR_2X, BMP390_OSR_1X));
+    uint32_t period = bmp390OdrPeriodUs(BMP390_ODR_100_HZ);
+
+    // 변환 완료 -> DRDY
+    halAdvanceMicros(period);
+    TEST_ASSERT_TRUE(bus.dataReady());
+
+    // STATUS + 압력 + 온도 7바이트를 한 트랜잭션으로, 읽으면 DRDY 해제
+    bus.resetCounters();
+    TEST_ASSERT_TRUE(bmp.update());
+    TEST_ASSERT_EQUAL(1, bus.getTransactions());
+    TEST_ASSERT_EQUAL(3 + 7, bus.getBytesTransferred());
+    TEST_ASSERT_EQUAL(1, bus.getDataReads());
+    TEST_ASSERT_FALSE(bus.dataReady());
+    TEST_ASSERT_EQUAL(0, bus.getRegister(BMP390_REG_ERR));
+
+    Sample<BaroSample> latest;
+    TEST_ASSERT_TRUE(bmp.getSamples().latest(latest));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 1013.25f, latest.value.pressure);
+}
+
+void test_update_never_blocks_while_drdy_low(void) {
+    halSetMicros(0);
+    FakeBmp390Bus bus;
+    BMP390 bmp(&bus);
+    startBmp(bmp);
+    TEST_ASSERT_TRUE(bmp.configureRate(BMP390_ODR_25_HZ, BMP390_OSR_8X, BMP390_OSR_1X));
+    uint32_t period = bmp390OdrPeriodUs(BMP390_ODR_25_HZ);
+
+    halAdvanceMicros(period);
+    TEST_ASSERT_TRUE(bmp.update());
+    uint32_t sequence = bmp.getSamples().getSequence();
+
+    // 다음 변환 전까지: 매번 STATUS 한 번만 읽고 바로 false (대기/재시도 없음)
+    uint32_t polls = 0;
+    uint32_t worstUs = 0;
+    uint32_t dataReads = bus.getDataReads();
+    bus.resetCounters();
+    while (!bus.dataReady()) {
+        uint32_t before = halMicros();
+        TEST_ASSERT_FALSE(bmp.update());
+        uint32_t spent = halMicros() - before;
+        if (spent > worstUs) worstUs = spent;
+        polls++;
+        halAdvanceMicros(1000);
+    }
+    TEST_ASSERT_EQUAL(polls, bus.getTransactions());
+    TEST_ASSERT_EQUAL(dataReads, bus.getDataReads());
+    TEST_ASSERT_EQUAL(sequence, bmp.getSamples().getSequence());
+
+    // 버스 시간만큼만 걸림 (7바이트 읽기 = 10 B × 9클럭 / 400 kHz)
+    TEST_ASSERT_EQUAL(225, worstUs);
+
+    // DRDY가 서면 다음 호출에서 바로 새 샘플
+    TEST_ASSERT_TRUE(bmp.update());
+    TEST_ASSERT_EQUAL(sequence + 1, bmp.getSamples().getSequence());
+
+    char line[96];
+    snprintf(line, sizeof(line), "%u polls while DRDY low, %u us each (bus only)", (unsigned)polls, (unsigned)worstUs);
+    TEST_MESSAGE(line);
+}
+
+void test_rate_too_fast_for_oversampling_rejected(void) {
+    halSetMicros(0);
+    FakeBmp390Bus bus;
+    BMP390 bmp(&bus);
+    startBmp(bmp);
+
+    // 200 Hz(5 ms)에 압력 8x + 온도 1x = 약 19 ms 변환 -> ERR conf_err
+    TEST_ASSERT_FALSE(bmp.configureRate(BMP390_ODR_200_HZ, BMP390_OSR_8X, BMP390_OSR_1X));
+    halAdvanceMicros(bmp390OdrPeriodUs(BMP390_ODR_50_HZ));
+    TEST_ASSERT_FALSE(bus.dataReady());
+
+    // 맞는 설정으로 돌아오면 다시 변환
+    TEST_ASSERT_TRUE(bmp.configureRate(BMP390_ODR_50_HZ, BMP390_OSR_4X, BMP390_OSR_2X));
+    halAdvanceMicros(bmp390OdrPeriodUs(BMP390_ODR_50_HZ));
+    TEST_ASSERT_TRUE(bmp.update());
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_calibration);
+    RUN_TEST(test_compensation_matches_datasheet_vectors);
+    RUN_TEST(test_begin_reads_nvm_and_configures);
+    RUN_TEST(test_missing_chip_fails);
+    RUN_TEST(test_one_burst_per_update_and_drdy);
+    RUN_TEST(test_update_never_blocks_while_drdy_low);
+    RUN_TEST(test_rate_too_fast_for_oversampling_rejected);
+    return UNITY_END();
+}
@@ -0,0 +1,270 @@
+// test/test_bno085/test_main.cpp
+// SH2 콜백 경로: 가짜 허브(FakeSh2Device)의 패킷 -> 배치 -> 시각 변환 -> 이벤트 링 -> 샘플 링
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "HAL.h"
+#include "Packet.h"
+#include "sensors/BNO085.h"
+
+#define TEST_INTERVAL_US 2500
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void startImu(FakeSh2Device& device, BNO085& imu) {
+    halSetMicros(1000);
+    Serial.setEnabled(false);
+    device.setHubOffset(0x40000000);
+    TEST_ASSERT_TRUE(imu.begin(true));
+    imu.setReportInterval(TEST_INTERVAL_US);
+
+    // 리포트는 update()마다 하나씩 활성화
+    for (uint8_t i = 0; i < 3; i++) {
+        imu.update();
+        halAdvanceMicros(100);
+    }
+}
+
+// 다음 인터럽트 시각까지 진행 후 에지 (하네스가 H_INTN을 흉내)
+static uint32_t stepToInterrupt(FakeSh2Device& device) {
+    uint32_t when;
+    TEST_ASSERT_TRUE(device.nextInterruptAt(when));
+    if ((int32_t)(when - halMicros()) > 0) halSetMicros(when);
+    device.tick();
+    return when;
+}
+
+void test_reports_enabled_one_per_update(void) {
+    FakeSh2Device device;
+    BNO085 imu(&device);
+    startImu(device, imu);
+
+    TEST_ASSERT_EQUAL(TEST_INTERVAL_US, device.getReportInterval(BNO085_REPORT_ACCELEROMETER));
+    TEST_ASSERT_EQUAL(TEST_INTERVAL_US, device.getReportInterval(BNO085_REPORT_GYROSCOPE));
+    TEST_ASSERT_EQUAL(TEST_INTERVAL_US, device.getReportInterval(BNO085_REPORT_ROTATION));
+}
+
+void test_packet_maps_to_interrupt_time(void) {
+    FakeSh2Device device;
+    BNO085 imu(&device);
+    startImu(device, imu);
+
+    Vec3 accel = { 0.5f, -0.25f, 9.80665f };
+    Vec3 rate = { 0.0f, 0.0f, 1.0f };
+    Quat q = { 0.9238795f, 0.0f, 0.0f, 0.3826834f };  // 요 45°
+    device.setMotion(accel, rate, q);
+
+    // 인터럽트 후 한참 늦게 읽어도 샘플 시각은 인터럽트 시각 (같은 주기의 리포트는 한 패킷)
+    uint32_t edge = stepToInterrupt(device);
+    halAdvanceMicros(700);
+    imu.update();
+
+    Sample<ImuSample> latest;
+    TEST_ASSERT_TRUE(imu.getSamples().latest(latest));
+    TEST_ASSERT_EQUAL(edge, latest.timestamp);
+    TEST_ASSERT_EQUAL(edge, imu.getLastEventMicros());
+    TEST_ASSERT_EQUAL(1, imu.getSequence());
+
+    // 한 패킷의 세 리포트가 한 샘플로
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, latest.value.accel.x);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, latest.value.rate.z);
+    TEST_ASSERT_EQUAL_FLOAT(0.3826834f, latest.value.quat.z);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 45.0f, imu.getGyroYaw());
+}
+
+void test_burst_no_drops_monotonic(void) {
+    FakeSh2Device device;
+    BNO085 imu(&device);
+    startImu(device, imu);
+
+    // 정상 상태 몇 패킷 (허브 시각 -> halMicros 오프셋 확정)
+    for (uint8_t i = 0; i < 4; i++) {
+        stepToInterrupt(device);
+        imu.update();
+    }
+    uint32_t before = imu.getSequence();
+    uint32_t reportsBefore = device.getReports(BNO085_REPORT_ROTATION);
+
+    // 루프가 40 ms 멈춤: 첫 패킷에서 에지 한 번, 나머지는 H_INTN이 LOW로 남은 채 허브에 쌓임
+    const uint32_t STALL_US = 40000;
+    uint32_t edge = stepToInterrupt(device);
+    halAdvanceMicros(STALL_US);
+
+    // update 한 번에 최대 BNO085_MAX_TRANSFERS 패킷 - 읽는 동안에도 허브는 계속 내므로 몇 번에 걸쳐 따라잡음
+    uint8_t passes = 0;
+    while (device.interruptAsserted() && passes < 20) {
+        imu.update();
+        passes++;
+    }
+    TEST_ASSERT_FALSE(device.interruptAsserted());
+    TEST_ASSERT_GREATER_THAN(STALL_US / TEST_INTERVAL_US / BNO085_MAX_TRANSFERS, passes);
+
+    // 손실 없음: 허브가 낸 회전 벡터마다 샘플 하나
+    uint32_t backlog = device.getReports(BNO085_REPORT_ROTATION) - reportsBefore;
+    TEST_ASSERT_GREATER_THAN(STALL_US / TEST_INTERVAL_US, backlog);
+    TEST_ASSERT_EQUAL(0, imu.getDroppedEvents());
+    TEST_ASSERT_EQUAL(before + backlog, imu.getSequence());
+
+    // 밀린 샘플: 첫 패킷 = 인터럽트 시각, 이후는 허브 간격 그대로 (단조 증가)
+    Sample<ImuSample> samples[BNO085_SAMPLE_RING_SIZE];
+    size_t count = imu.getSamples().range(edge, imu.getLastEventMicros(), samples, BNO085_SAMPLE_RING_SIZE);
+    TEST_ASSERT_EQUAL(backlog, count);
+    TEST_ASSERT_EQUAL(edge, samples[0].timestamp);
+    for (size_t i = 1; i < count; i++) {
+        TEST_ASSERT_EQUAL(TEST_INTERVAL_US, samples[i].timestamp - samples[i - 1].timestamp);
+    }
+
+    char line[96];
+    snprintf(line, sizeof(line), "burst of %u packets read in %u updates, last sample %u us after edge",
+             (unsigned)backlog, (unsigned)passes, (unsigned)(samples[count - 1].timestamp - edge));
+    TEST_MESSAGE(line);
+}
+
+void test_late_interrupt_clamped(void) {
+    FakeSh2Device device;
+    BNO085 imu(&device);
+    startImu(device, imu);
+
+    stepToInterrupt(device);
+    imu.update();
+    Sample<ImuSample> first;
+    TEST_ASSERT_TRUE(imu.getSamples().latest(first));
+
+    // 기록된 에지 시각이 이전 샘플보다 앞서면 (인터럽트 지연 편차) 이전 샘플 시각으로 고정
+    ImuEvent rewound[3];
+    uint32_t hubNow = device.hubMicros();
+    for (uint8_t i = 0; i < 3; i++) {
+        rewound[i].timestamp = hubNow;
+        rewound[i].x = 0.0f; rewound[i].y = 0.0f; rewound[i].z = 0.0f; rewound[i].w = 1.0f;
+    }
+    rewound[0].sensorId = BNO085_REPORT_ACCELEROMETER;
+    rewound[1].sensorId = BNO085_REPORT_GYROSCOPE;
+    rewound[2].sensorId = BNO085_REPORT_ROTATION;
+    TEST_ASSERT_TRUE(device.queuePacket(rewound, 3));
+
+    // 큐에 넣은 패킷은 즉시 준비 -> 이전 샘플보다 300 us 앞선 에지
+    halSetMicros(first.timestamp - 300);
+    device.tick();
+    imu.update();
+
+    Sample<ImuSample> second;
+    TEST_ASSERT_TRUE(imu.getSamples().latest(second));
+    TEST_ASSERT_EQUAL(2, imu.getSequence());
+    TEST_ASSERT_EQUAL(first.timestamp, second.timestamp);
+}
+
+void test_unknown_reports_ignored(void) {
+    FakeSh2Device device;
+    BNO085 imu(&device);
+    startImu(device, imu);
+
+    ImuEvent events[2];
+    events[0].sensorId = 0x08;   // 게임 회전 벡터 (사용 안 함)
+    events[0].timestamp = device.hubMicros();
+    events[1] = events[0];
+    events[1].sensorId = BNO085_REPORT_ROTATION;
+    events[1].x = 0.0f; events[1].y = 0.0f; events[1].z = 0.0f; events[1].w = 1.0f;
+    TEST_ASSERT_TRUE(device.queuePacket(events, 2));
+
+    device.tick();
+    imu.update();
+    TEST_ASSERT_EQUAL(1, imu.getSequence());
+    TEST_ASSERT_EQUAL(0, imu.getDroppedEvents());
+}
+
+void test_packet_gyro_fields_are_attitude(void) {
+    FakeSh2Device device;
+    BNO085 imu(&device);
+    startImu(device, imu);
+
+    // 요 45°로 돌아 있고 요 각속도는 90 °/s - 텔레메트리 GYRO는 각도
+    Vec3 accel = { 0.0f, 0.0f, 9.80665f };
+    Vec3 rate = { 0.0f, 0.0f, 1.5707963f };
+    Quat q = { 0.9238795f, 0.0f, 0.0f, 0.3826834f };
+    device.setMotion(accel, rate, q);
+    stepToInterrupt(device);
+    imu.update();
+
+    Packet packet;
+    packet.attachSensors(nullptr, &imu, nullptr);
+    TelemetryPacket out;
+    packet.collectData(out);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, out.gyro_r);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, out.gyro_p);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 45.0f, out.gyro_y);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 90.0f, imu.getRateZ());
+}
+
+// 한 주기 동안의 버스 사용 (I2C 바이트당 9클럭, SPI 8클럭)
+static double busMicros(uint32_t bytes, bool spi, uint32_t clockHz) {
+    return bytes * (spi ? 8.0 : 9.0) * 1e6 / clockHz;
+}
+
+static void measureTransport(bool spi, uint32_t clockHz, uint32_t intervalUs, double& bytesPerSample,
+                             double& transactionsPerSample, double& busShare) {
+    FakeSh2Device device(spi, clockHz);
+    BNO085 imu(&device);
+    startImu(device, imu);
+    imu.setReportInterval(intervalUs);
+    for (uint8_t i = 0; i < 3; i++) imu.update();
+    device.resetCounters();
+
+    const uint32_t SAMPLES = 1000;
+    uint32_t before = imu.getSequence();
+    auto start = std::chrono::steady_clock::now();
+    while (imu.getSequence() - before < SAMPLES) {
+        stepToInterrupt(device);
+        imu.update();
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    TEST_ASSERT_EQUAL(SAMPLES, device.getReports(BNO085_REPORT_ROTATION));
+    TEST_ASSERT_EQUAL(0, imu.getDroppedEvents());
+    bytesPerSample = (double)device.getBytesTransferred() / SAMPLES;
+    transactionsPerSample = (double)device.getTransactions() / SAMPLES;
+    busShare = busMicros(device.getBytesTransferred(), spi, clockHz) / SAMPLES / intervalUs;
+
+    char line[160];
+    snprintf(line, sizeof(line), "%s %4u kHz @ %3u Hz: %.1f B and %.1f transactions per sample, bus %.1f us/sample (%.0f%%), host %.0f ns/sample",
+             spi ? "SPI" : "I2C", (unsigned)(clockHz / 1000), (unsigned)(1000000 / intervalUs), bytesPerSample,
+             transactionsPerSample, busShare * intervalUs, busShare * 100.0, ns / SAMPLES);
+    TEST_MESSAGE(line);
+}
+
+void test_transport_cost_per_sample(void) {
+    // 가속도 + 자이로 + 회전 벡터 = 패킷 43 B
+    const uint8_t ids[] = { BNO085_REPORT_ACCELEROMETER, BNO085_REPORT_GYROSCOPE, BNO085_REPORT_ROTATION };
+    TEST_ASSERT_EQUAL(43, FakeSh2Device::packetLength(ids, 3));
+
+    double bytes, transactions, share;
+
+    // I2C: 헤더 읽기 + 32 B 청크 두 번 (청크마다 헤더 4 B 반복, 주소 1 B)
+    measureTransport(false, BNO085_I2C_CLOCK, 2500, bytes, transactions, share);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 54.0, bytes);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 3.0, transactions);
+    TEST_ASSERT_GREATER_THAN(0.45, share);           // 400 Hz면 블로킹 읽기가 주기의 절반 가까이
+
+    measureTransport(false, BNO085_I2C_CLOCK, 5000, bytes, transactions, share);
+    TEST_ASSERT_LESS_THAN(0.25, share);              // 200 Hz (I2C 빌드의 BNO085_FAST_INTERVAL_US)
+
+    // SPI: 헤더 + 패킷 전체 한 번
+    measureTransport(true, BNO085_SPI_CLOCK, 2500, bytes, transactions, share);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 47.0, bytes);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 2.0, transactions);
+    TEST_ASSERT_LESS_THAN(0.20, share);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_reports_enabled_one_per_update);
+    RUN_TEST(test_packet_maps_to_interrupt_time);
+    RUN_TEST(test_burst_no_drops_monotonic);
+    RUN_TEST(test_late_interrupt_clamped);
+    RUN_TEST(test_unknown_reports_ignored);
+    RUN_TEST(test_packet_gyro_fields_are_attitude);
+    RUN_TEST(test_transport_cost_per_sample);
+    return UNITY_END();
+}
@@ -0,0 +1,162 @@
+// test/test_boot/test_main.cpp
+// BootSequencer: 가짜 단계(대기 후 준비, 응답 없음, 실패, 즉시 준비)를 번갈아 진행 + 비행 부팅 테이블에서 IMU 없음
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "Boot.h"
+#include "Flight.h"
+
+static uint32_t fakeNow = 0;
+static uint32_t fakeClock() { return fakeNow; }
+
+// 단계별 호출 횟수
+static uint32_t calls[4];
+
+// 30 ms 동안 대기 (리셋 대기 같은 비블로킹 단계)
+static InitStatus slowStep() {
+    calls[0]++;
+    return fakeNow >= 30000 ? INIT_READY : INIT_PENDING;
+}
+
+// 응답 없음 - 스스로 끝내지 못함 (제한 시간으로 실패 처리)
+static InitStatus hangStep() {
+    calls[1]++;
+    return INIT_PENDING;
+}
+
+// 5 ms 뒤 실패 (장치 없음)
+static InitStatus failStep() {
+    calls[2]++;
+    return fakeNow >= 5000 ? INIT_FAILED : INIT_PENDING;
+}
+
+static InitStatus quickStep() {
+    calls[3]++;
+    return INIT_READY;
+}
+
+static const BootStep STEPS[] = {
+    { "SLOW", slowStep, 200000 },
+    { "HANG", hangStep, 100000 },
+    { "FAIL", failStep, 200000 },
+    { "QUICK", quickStep, 0 },
+};
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_interleaved_steps_bounded_by_timeout(void) {
+    fakeNow = 1000;
+    memset(calls, 0, sizeof(calls));
+    BootSequencer boot(fakeClock);
+    TEST_ASSERT_TRUE(boot.begin(STEPS, 4));
+
+    // 루프 한 번 = 1 ms
+    uint32_t passes = 0;
+    while (!boot.run()) {
+        fakeNow += 1000;
+        passes++;
+        TEST_ASSERT_LESS_THAN(1000, passes);
+    }
+
+    // 가장 긴 제한 시간(응답 없는 단계) 안에 모두 끝남
+    uint32_t total = fakeNow - boot.getStartTime();
+    TEST_ASSERT_EQUAL(100000, total);
+    TEST_ASSERT_TRUE(boot.isDone());
+    TEST_ASSERT_EQUAL(2, boot.getReadyCount());
+
+    TEST_ASSERT_EQUAL(INIT_READY, boot.getStatus(0));
+    TEST_ASSERT_EQUAL(INIT_FAILED, boot.getStatus(1));
+    TEST_ASSERT_EQUAL(INIT_FAILED, boot.getStatus(2));
+    TEST_ASSERT_EQUAL(INIT_READY, boot.getStatus(3));
+
+    // 실패/응답 없는 단계가 다른 단계를 늦추지 않음
+    TEST_ASSERT_EQUAL(0, boot.getFinishTime(3));
+    TEST_ASSERT_EQUAL(4000, boot.getFinishTime(2));
+    TEST_ASSERT_EQUAL(29000, boot.getFinishTime(0));
+    TEST_ASSERT_EQUAL(100000, boot.getFinishTime(1));
+
+    // 끝난 단계는 다시 호출하지 않음 (루프마다 진행 중인 단계만 한 번씩)
+    TEST_ASSERT_EQUAL(1, calls[3]);
+    TEST_ASSERT_EQUAL(5, calls[2]);
+    TEST_ASSERT_EQUAL(30, calls[0]);
+    TEST_ASSERT_EQUAL(101, calls[1]);
+}
+
+void test_report_line(void) {
+    fakeNow = 1000;
+    BootSequencer boot(fakeClock);
+    boot.begin(STEPS, 4);
+    while (!boot.run()) fakeNow += 1000;
+
+    char line[TELEMETRY_MAX_LEN];
+    boot.formatReport(line, sizeof(line), 123456);
+    TEST_ASSERT_EQUAL_STRING("BOOT,123456,SLOW,READY,30000,HANG,FAILED,101000,FAIL,FAILED,5000,QUICK,READY,1000", line);
+}
+
+void test_rejects_too_many_steps(void) {
+    BootSequencer boot(fakeClock);
+    BootStep many[BOOT_MAX_STEPS + 1];
+    for (uint8_t i = 0; i <= BOOT_MAX_STEPS; i++) many[i] = STEPS[3];
+    TEST_ASSERT_FALSE(boot.begin(many, BOOT_MAX_STEPS + 1));
+    TEST_ASSERT_TRUE(boot.begin(many, BOOT_MAX_STEPS));
+}
+
+static uint8_t stepNamed(BootSequencer& sequencer, const char* name) {
+    for (uint8_t i = 0; i < sequencer.getStepCount(); i++) {
+        if (strcmp(sequencer.getStep(i).name, name) == 0) return i;
+    }
+    return BOOT_MAX_STEPS;
+}
+
+// 비행 부팅 테이블: IMU가 응답하지 않아도 BMP는 바로 준비되고 스케줄러가 돌기 시작
+void test_flight_boot_without_imu(void) {
+    halSetMicros(0);
+    Serial.setEnabled(false);
+    flightReset();
+    imuDevice.setPresent(false);
+    flightSetup();
+    uint8_t imuStep = stepNamed(boot, "IMU");
+    TEST_ASSERT_LESS_THAN(boot.getStepCount(), imuStep);
+
+    uint32_t bmpSamplesBeforeImuDone = 0;
+    while (!boot.isDone() && halMicros() < 5000000) {
+        flightLoop();
+        if (boot.getStatus(imuStep) == INIT_PENDING) bmpSamplesBeforeImuDone = bmp.getSamples().getSequence();
+        halAdvanceMicros(1000);
+        imuDevice.tick();
+    }
+    TEST_ASSERT_TRUE(boot.isDone());
+
+    // 안정화 0.5 s + 연결 3회(재시도 대기 0.5 s) 후 실패, IMU 제한 시간(2.5 s) 안
+    TEST_ASSERT_EQUAL(INIT_FAILED, boot.getStatus(imuStep));
+    TEST_ASSERT_LESS_OR_EQUAL(boot.getStep(imuStep).timeoutUs, boot.getFinishTime(imuStep));
+    TEST_ASSERT_GREATER_OR_EQUAL(1500000, boot.getFinishTime(imuStep));
+
+    // 나머지 장치는 모두 준비, 부팅 중 가장 늦은 것도 수십 ms
+    for (uint8_t i = 0; i < boot.getStepCount(); i++) {
+        if (i == imuStep) continue;
+        TEST_ASSERT_EQUAL(INIT_READY, boot.getStatus(i));
+        TEST_ASSERT_LESS_THAN(200000, boot.getFinishTime(i));
+    }
+    TEST_ASSERT_EQUAL(boot.getStepCount() - 1, boot.getReadyCount());
+
+    // IMU를 기다리는 1.5 s 동안 BMP 샘플이 이미 쌓임 (PAD 20 ms 주기)
+    TEST_ASSERT_GREATER_THAN(30, bmpSamplesBeforeImuDone);
+
+    char line[96];
+    snprintf(line, sizeof(line), "IMU failed at %u us, %u BMP samples before that",
+             (unsigned)boot.getFinishTime(imuStep), (unsigned)bmpSamplesBeforeImuDone);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_interleaved_steps_bounded_by_timeout);
+    RUN_TEST(test_report_line);
+    RUN_TEST(test_rejects_too_many_steps);
+    RUN_TEST(test_flight_boot_without_imu);
+    return UNITY_END();
+}
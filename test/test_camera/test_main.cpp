@@ -0,0 +1,243 @@
+// test/test_camera/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "HAL.h"
+#include "Camera.h"
+#include "Scheduler.h"
+
+// SD 모델: bytesPerUs 속도 + 100번째 쓰기마다 stallUs 정지 (가비지 컬렉션)
+class TimedBackend : public LogBackend {
+private:
+    uint32_t stallUs;
+    float bytesPerUs;
+
+public:
+    std::vector<uint8_t> data;
+    uint32_t writes;
+    uint32_t syncs;
+    bool busy;
+    bool closed;
+
+    TimedBackend(uint32_t stallMicros, float speed) : stallUs(stallMicros), bytesPerUs(speed), writes(0), syncs(0), busy(false), closed(false) {}
+
+    bool open(const char* path, uint32_t preallocate) override { (void)path; (void)preallocate; return true; }
+    bool exists(const char* path) override { (void)path; return false; }
+    size_t write(const uint8_t* bytes, size_t count) override {
+        data.insert(data.end(), bytes, bytes + count);
+        writes++;
+        halAdvanceMicros((uint32_t)(count / bytesPerUs) + (writes % 100 == 0 ? stallUs : 0));
+        return count;
+    }
+    bool sync() override { syncs++; return true; }
+    void close() override { closed = true; }
+    bool isBusy() override { return busy; }
+};
+
+// 기록 파일 확인 결과
+struct FileCheck {
+    uint32_t frames;
+    uint32_t gaps;           // 빠진 순번 수
+    uint32_t bad;            // 헤더/내용/정렬 오류
+};
+
+static FileCheck checkFile(const std::vector<uint8_t>& data) {
+    FileCheck check = { 0, 0, 0 };
+    uint32_t lastSequence = 0;
+    size_t offset = 0;
+
+    while (offset + sizeof(CameraFrameHeader) <= data.size()) {
+        CameraFrameHeader header;
+        memcpy(&header, &data[offset], sizeof(header));
+        if (header.magic != CAMERA_FRAME_MAGIC || header.storedSize % LOG_SECTOR_SIZE != 0 ||
+            offset + header.storedSize > data.size()) {
+            check.bad++;
+            break;
+        }
+        for (uint32_t i = 0; i < header.length; i++) {
+            if (data[offset + CAMERA_HEADER_SIZE + i] != FakeCameraDevice::patternByte(header.sequence, i)) {
+                check.bad++;
+                break;
+            }
+        }
+        check.gaps += header.sequence - lastSequence - 1;
+        lastSequence = header.sequence;
+        check.frames++;
+        offset += header.storedSize;
+    }
+    if (offset != data.size()) check.bad++;
+    return check;
+}
+
+alignas(32) static uint8_t pool[CAMERA_MAX_FRAMES * CAMERA_FRAME_SIZE];
+
+// 스케줄러 태스크 (main.cpp와 같은 구성)
+static Camera* taskCamera;
+static CameraRecorder* taskRecorder;
+static uint32_t imuRuns;
+static void imuTask() { imuRuns++; halAdvanceMicros(60); }
+static void cameraTask() { taskCamera->service(); }
+static void frameTask() { taskRecorder->service(); }
+
+void setUp(void) {
+    halSetMicros(0);
+    imuRuns = 0;
+}
+void tearDown(void) {}
+
+void test_frames_reach_file_intact_without_stalling_imu(void) {
+    FakeCameraDevice device(30000, 6000, 14000, 1.0f);   // 30 ms 캡처, SPI 8 MHz
+    TimedBackend card(1500, 20.0f);                      // 20 MB/s, 1.5 ms 정지
+    Camera camera;
+    CameraRecorder recorder;
+    taskCamera = &camera;
+    taskRecorder = &recorder;
+
+    TEST_ASSERT_TRUE(camera.begin(&device, pool, CAMERA_FRAME_SIZE, CAMERA_MAX_FRAMES));
+    TEST_ASSERT_TRUE(recorder.begin(&card, "frames", ".frm", &camera));
+    TEST_ASSERT_EQUAL_STRING("frames000.frm", recorder.getPath());
+
+    const TaskConfig tasks[] = {
+        { "IMU",    imuTask,    2500, 0, 2500 },
+        { "CAMERA", cameraTask, 1000, 3, 0 },
+        { "FRAMES", frameTask,  2000, 5, 0 },
+    };
+    Scheduler scheduler(halMicros);
+    scheduler.begin(tasks, 3, 0);
+
+    camera.start(0);
+    while (halMicros() < 10000000) {
+        scheduler.runOnce();
+        halAdvanceMicros(5);
+    }
+    camera.stop();
+    recorder.end();
+
+    // 모든 캡처 프레임이 순서대로, 내용 그대로 기록됨
+    FileCheck check = checkFile(card.data);
+    TEST_ASSERT_EQUAL(0, check.bad);
+    TEST_ASSERT_EQUAL(camera.getFramesCaptured(), check.frames);
+    TEST_ASSERT_EQUAL(0, check.gaps);
+    TEST_ASSERT_EQUAL(0, camera.getFramesDropped());
+    TEST_ASSERT_EQUAL(camera.getFramesCaptured(), recorder.getFramesWritten());
+    TEST_ASSERT_TRUE(card.closed);
+    TEST_ASSERT_FALSE(recorder.isActive());
+
+    // 기록 청크가 IMU 주기를 놓치게 하지 않음 (쓰기 하나 < 주기)
+    const TaskStats& imu = scheduler.getStats(0);
+    TEST_ASSERT_EQUAL(0, imu.skipped);
+    TEST_ASSERT_GREATER_THAN(3900, imuRuns);
+
+    char line[128];
+    snprintf(line, sizeof(line), "%u frames, latency mean %.1f ms max %.1f ms, IMU max jitter %u us",
+             (unsigned)camera.getFramesCaptured(), camera.getMeanLatencyUs() / 1000.0,
+             camera.getMaxLatencyUs() / 1000.0, (unsigned)imu.maxJitterUs);
+    TEST_MESSAGE(line);
+}
+
+void test_drops_frame_when_no_free_buffer(void) {
+    FakeCameraDevice device(1000, 2000, 2000, 8.0f);
+    TimedBackend card(0, 20.0f);
+    Camera camera;
+    CameraRecorder recorder;
+    TEST_ASSERT_TRUE(camera.begin(&device, pool, CAMERA_FRAME_SIZE, 2));
+    TEST_ASSERT_TRUE(recorder.begin(&card, "frames", ".frm", &camera));
+
+    // 기록기가 돌지 않으면 버퍼 2개가 찬 뒤 프레임은 버려짐
+    camera.start(0);
+    for (int i = 0; i < 2000; i++) {
+        camera.service();
+        halAdvanceMicros(100);
+    }
+    camera.stop();
+    TEST_ASSERT_EQUAL(2, camera.getFramesCaptured());
+    TEST_ASSERT_GREATER_THAN(0, camera.getFramesDropped());
+    TEST_ASSERT_EQUAL(2, camera.getQueuedFrames());
+
+    // 버퍼가 돌아오면 다시 캡처, 버린 프레임은 파일에서 빈 순번
+    camera.start(0);
+    for (int i = 0; i < 200; i++) {
+        camera.service();
+        recorder.service();
+        halAdvanceMicros(100);
+    }
+    camera.stop();
+    recorder.end();
+
+    FileCheck check = checkFile(card.data);
+    TEST_ASSERT_EQUAL(0, check.bad);
+    TEST_ASSERT_EQUAL(camera.getFramesCaptured(), check.frames);
+    TEST_ASSERT_EQUAL(camera.getFramesDropped(), check.gaps);
+}
+
+void test_rejects_oversize_frame(void) {
+    FakeCameraDevice device(1000, CAMERA_FRAME_SIZE, CAMERA_FRAME_SIZE, 8.0f);
+    Camera camera;
+    TEST_ASSERT_TRUE(camera.begin(&device, pool, CAMERA_FRAME_SIZE, 2));
+
+    camera.start(0);
+    for (int i = 0; i < 100; i++) {
+        camera.service();
+        halAdvanceMicros(100);
+    }
+    TEST_ASSERT_EQUAL(0, camera.getFramesCaptured());
+    TEST_ASSERT_GREATER_THAN(0, camera.getFramesOversize());
+    TEST_ASSERT_EQUAL(0, camera.getQueuedFrames());
+}
+
+void test_rejects_bad_pool(void) {
+    FakeCameraDevice device(1000, 100, 200, 1.0f);
+    Camera camera;
+    TEST_ASSERT_FALSE(camera.begin(&device, pool, CAMERA_FRAME_SIZE + 1, 2));      // 섹터 배수 아님
+    TEST_ASSERT_FALSE(camera.begin(&device, pool, CAMERA_FRAME_SIZE, 0));
+    TEST_ASSERT_FALSE(camera.begin(&device, pool, CAMERA_FRAME_SIZE, CAMERA_MAX_FRAMES + 1));
+    TEST_ASSERT_FALSE(camera.isReady());
+}
+
+void test_recorder_waits_for_busy_card_and_syncs_by_time(void) {
+    FakeCameraDevice device(1000, 2000, 2000, 8.0f);
+    TimedBackend card(0, 20.0f);
+    Camera camera;
+    CameraRecorder recorder;
+    TEST_ASSERT_TRUE(camera.begin(&device, pool, CAMERA_FRAME_SIZE, 4));
+    TEST_ASSERT_TRUE(recorder.begin(&card, "frames", ".frm", &camera));
+
+    // 한 장만 촬영
+    camera.start(CAMERA_SYNC_PERIOD_US * 10);
+    for (int i = 0; i < 50; i++) {
+        camera.service();
+        halAdvanceMicros(100);
+    }
+    TEST_ASSERT_EQUAL(1, camera.getQueuedFrames());
+
+    // 카드가 바쁘면 쓰지 않고 넘김
+    card.busy = true;
+    recorder.service();
+    TEST_ASSERT_EQUAL(0, card.writes);
+    TEST_ASSERT_EQUAL(1, recorder.getBusySkips());
+
+    card.busy = false;
+    for (int i = 0; i < 4; i++) recorder.service();
+    TEST_ASSERT_EQUAL(1, recorder.getFramesWritten());
+    TEST_ASSERT_EQUAL(0, card.syncs);                    // 프레임 수 기준 sync 전
+
+    // 더 기록할 게 없어도 주기가 지나면 sync
+    halAdvanceMicros(CAMERA_SYNC_PERIOD_US);
+    recorder.service();
+    TEST_ASSERT_EQUAL(1, card.syncs);
+    recorder.service();
+    TEST_ASSERT_EQUAL(1, card.syncs);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_frames_reach_file_intact_without_stalling_imu);
+    RUN_TEST(test_drops_frame_when_no_free_buffer);
+    RUN_TEST(test_rejects_oversize_frame);
+    RUN_TEST(test_rejects_bad_pool);
+    RUN_TEST(test_recorder_waits_for_busy_card_and_syncs_by_time);
+    return UNITY_END();
+}
@@ -0,0 +1,155 @@
+// test/test_cmd/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "CMD.h"
+
+// 호출 기록용 핸들러
+static char lastCall[32];
+static char lastArgs[64];
+
+static void record(const char* name, const CommandArgs& args) {
+    copyString(lastCall, name, sizeof(lastCall));
+    CSVWriter text(lastArgs, sizeof(lastArgs));
+    for (uint8_t i = 0; i < args.argc; i++) {
+        if (i > 0) text.separator();
+        text.appendString(args.argv[i]);
+    }
+}
+
+static bool commandCX(const CommandArgs& args) {
+    if (strcmp(args.argv[0], "ON") != 0 && strcmp(args.argv[0], "OFF") != 0) return false;
+    record("CX", args);
+    return true;
+}
+static bool commandMEC(const CommandArgs& args) { record("MEC", args); return true; }
+static bool commandSIM(const CommandArgs& args) { record("SIM", args); return true; }
+static bool commandST(const CommandArgs& args) { record("ST", args); return true; }
+
+static constexpr CommandSpec COMMANDS[] = {
+    { "CX",   commandCX,   1, 1 },
+    { "MEC",  commandMEC,  2, 2 },
+    { "SIM",  commandSIM,  1, 1 },
+    { "ST",   commandST,   1, 1 },
+};
+static const uint8_t COMMAND_COUNT = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+static_assert(commandTableSorted(COMMANDS, COMMAND_COUNT), "COMMANDS must be sorted by name");
+
+// 정렬 검사가 실제로 잡아내는지
+static constexpr CommandSpec UNSORTED[] = {
+    { "SIM", commandSIM, 1, 1 },
+    { "CX",  commandCX,  1, 1 },
+};
+static_assert(!commandTableSorted(UNSORTED, 2), "unsorted table must be detected");
+static_assert(commandCompare("SIM", "SIMP") < 0 && commandCompare("ST", "SIMP") > 0, "prefix order");
+
+// 문자열 전체를 넣고 실행된 명령 수 반환
+static int feedAll(CommandParser& parser, const char* text) {
+    int executed = 0;
+    for (const char* p = text; *p; p++) executed += parser.feed(*p);
+    return executed;
+}
+
+void setUp(void) {
+    lastCall[0] = '\0';
+    lastArgs[0] = '\0';
+}
+void tearDown(void) {}
+
+void test_dispatch_and_echo(void) {
+    CommandParser parser;
+    parser.begin(COMMANDS, COMMAND_COUNT);
+    TEST_ASSERT_EQUAL_STRING("NONE", parser.getEcho());
+
+    TEST_ASSERT_EQUAL(1, feedAll(parser, "CMD," TEAM_ID ",CX,ON\n"));
+    TEST_ASSERT_EQUAL_STRING("CX", lastCall);
+    TEST_ASSERT_EQUAL_STRING("CXON", parser.getEcho());
+
+    TEST_ASSERT_EQUAL(1, feedAll(parser, "CMD," TEAM_ID ",MEC,SERVO,ON\r\n"));
+    TEST_ASSERT_EQUAL_STRING("SERVO,ON", lastArgs);
+    TEST_ASSERT_EQUAL_STRING("MECSERVOON", parser.getEcho());
+
+    TEST_ASSERT_EQUAL(1, feedAll(parser, "CMD," TEAM_ID ",ST,13:35:59\n"));
+    TEST_ASSERT_EQUAL_STRING("ST", lastCall);
+    TEST_ASSERT_EQUAL(3, parser.getAccepted());
+}
+
+void test_rejects_wrong_team_and_args(void) {
+    CommandParser parser;
+    parser.begin(COMMANDS, COMMAND_COUNT);
+    feedAll(parser, "CMD," TEAM_ID ",CX,ON\n");
+
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "CMD,9999,CX,OFF\n"));         // 다른 팀
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "CMX," TEAM_ID ",CX,OFF\n"));   // 접두어
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "CMD," TEAM_ID ",CX\n"));       // 인자 부족
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "CMD," TEAM_ID ",CX,ON,1\n"));  // 인자 초과
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "CMD," TEAM_ID ",CX,MAYBE\n")); // 핸들러 거부
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "CMD," TEAM_ID ",SIMP,101325\n"));   // 테이블에 없음
+
+    TEST_ASSERT_EQUAL(5, parser.getRejected());
+    TEST_ASSERT_EQUAL(1, parser.getUnknown());
+    TEST_ASSERT_EQUAL_STRING("CXON", parser.getEcho());                   // 실패한 명령은 에코 안 바뀜
+}
+
+void test_broken_lines_are_dropped(void) {
+    CommandParser parser;
+    parser.begin(COMMANDS, COMMAND_COUNT);
+
+    // 잡음 바이트가 섞인 줄, 너무 긴 줄 -> 다음 줄은 정상
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "CMD," TEAM_ID ",C\x01X,ON\n"));
+    char longLine[CMD_MAX_LEN + 16];
+    memset(longLine, 'A', sizeof(longLine) - 2);
+    longLine[sizeof(longLine) - 2] = '\n';
+    longLine[sizeof(longLine) - 1] = '\0';
+    TEST_ASSERT_EQUAL(0, feedAll(parser, longLine));
+    TEST_ASSERT_EQUAL(2, parser.getDropped());
+
+    TEST_ASSERT_EQUAL(1, feedAll(parser, "CMD," TEAM_ID ",SIM,ENABLE\n"));
+    TEST_ASSERT_EQUAL_STRING("SIMENABLE", parser.getEcho());
+
+    // 빈 줄은 무시
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "\r\n\n"));
+    TEST_ASSERT_EQUAL(2, parser.getDropped());
+}
+
+void test_binary_search_finds_every_entry(void) {
+    CommandParser parser;
+    parser.begin(COMMANDS, COMMAND_COUNT);
+    char line[64];
+    for (uint8_t i = 0; i < COMMAND_COUNT; i++) {
+        snprintf(line, sizeof(line), "CMD,%s,%s%s\n", TEAM_ID, COMMANDS[i].name,
+                 COMMANDS[i].minArgs == 2 ? ",A,B" : ",ON");
+        TEST_ASSERT_EQUAL(1, feedAll(parser, line));
+        TEST_ASSERT_EQUAL_STRING(COMMANDS[i].name, lastCall);
+    }
+}
+
+void test_feed_cost(void) {
+    CommandParser parser;
+    parser.begin(COMMANDS, COMMAND_COUNT);
+    const char* line = "CMD," TEAM_ID ",MEC,SERVO,ON\n";
+    const int rounds = 200000;
+
+    auto start = std::chrono::steady_clock::now();
+    int executed = 0;
+    for (int i = 0; i < rounds; i++) executed += feedAll(parser, line);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+    TEST_ASSERT_EQUAL(rounds, executed);
+
+    char text[80];
+    snprintf(text, sizeof(text), "command feed+dispatch %.0f ns/line (host)", ns);
+    TEST_MESSAGE(text);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_dispatch_and_echo);
+    RUN_TEST(test_rejects_wrong_team_and_args);
+    RUN_TEST(test_broken_lines_are_dropped);
+    RUN_TEST(test_binary_search_finds_every_entry);
+    RUN_TEST(test_feed_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,189 @@
+// test/test_filter/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "Filter.h"
+
+// 재현 가능한 가우시안 잡음 (xorshift + Box-Muller)
+static uint32_t rngState = 12345;
+static float gaussian(float sigma) {
+    auto next = []() {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 17;
+        rngState ^= rngState << 5;
+        return (rngState + 1.0f) / 4294967297.0f;
+    };
+    float u1 = next(), u2 = next();
+    return sigma * sqrtf(-2.0f * logf(u1)) * cosf(6.2831853f * u2);
+}
+
+void setUp(void) {
+    rngState = 12345;
+}
+void tearDown(void) {}
+
+// 일정 가속도 비행에서 예측/보정을 번갈아 돌림
+static void fly(Filter& filter, float dt, uint8_t predictsPerUpdate, int updates, float accel) {
+    float h = filter.getAltitude(), v = filter.getVelocity();
+    for (int n = 0; n < updates; n++) {
+        for (uint8_t i = 0; i < predictsPerUpdate; i++) {
+            h += v * dt + 0.5f * accel * dt * dt;
+            v += accel * dt;
+            filter.predict(accel, dt);
+        }
+        filter.update(h);
+    }
+}
+
+void test_solve_does_not_touch_state(void) {
+    Filter filter;
+    filter.begin(100.0f);
+    fly(filter, 0.005f, 2, 50, 10.0f);
+    float altitude = filter.getAltitude();
+    float velocity = filter.getVelocity();
+
+    filter.solveFixedGain(0.02f, 4);
+    TEST_ASSERT_EQUAL_FLOAT(altitude, filter.getAltitude());
+    TEST_ASSERT_EQUAL_FLOAT(velocity, filter.getVelocity());
+    TEST_ASSERT_TRUE(filter.isInitialized());
+}
+
+void test_gain_depends_on_rates(void) {
+    Filter filter;
+    FilterGain fast = filter.solveFixedGain(0.005f, 2);      // IMU 200 Hz, BMP 100 Hz
+    FilterGain slow = filter.solveFixedGain(0.1f, 1);        // IMU 10 Hz, BMP 12.5 Hz
+
+    TEST_ASSERT_GREATER_THAN(0.0f, fast.k[0]);
+    TEST_ASSERT_GREATER_THAN(0.0f, fast.k[1]);
+    // 보정 간격이 길면 고도 이득이 커짐 (예측 불확실성이 더 쌓임)
+    TEST_ASSERT_GREATER_THAN(fast.k[0], slow.k[0]);
+    TEST_ASSERT_TRUE(fabsf(fast.k[1] - slow.k[1]) > 1e-4f);
+}
+
+void test_switching_gain_keeps_state(void) {
+    Filter filter;
+    filter.computeFixedGain(0.02f, 2);
+    filter.update(50.0f);                                    // 첫 보정으로 초기화
+    TEST_ASSERT_TRUE(filter.isInitialized());
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, filter.getAltitude());
+
+    fly(filter, 0.02f, 2, 100, 5.0f);
+    float altitude = filter.getAltitude();
+    float velocity = filter.getVelocity();
+
+    FilterGain fast = filter.solveFixedGain(0.005f, 2);
+    filter.setFixedGain(fast);
+    TEST_ASSERT_EQUAL_FLOAT(altitude, filter.getAltitude());
+    TEST_ASSERT_EQUAL_FLOAT(velocity, filter.getVelocity());
+    TEST_ASSERT_EQUAL_FLOAT(fast.k[0], filter.getGain()[0]);
+
+    // 새 주기로 계속 추종
+    fly(filter, 0.005f, 2, 400, 5.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 5.0f * (0.04f * 100 + 0.01f * 400), filter.getVelocity());
+}
+
+void test_fixed_gain_matches_adaptive(void) {
+    Filter adaptive;
+    adaptive.begin(0.0f);
+    fly(adaptive, 0.005f, 2, 3000, 0.0f);
+
+    Filter fixed;
+    FilterGain gain = fixed.solveFixedGain(0.005f, 2);
+
+    // 수렴한 적응 필터의 다음 이득과 같아야 함
+    Filter probe = adaptive;
+    probe.predict(0.0f, 0.005f);
+    probe.predict(0.0f, 0.005f);
+    float before = probe.getAltitude();
+    probe.update(before + 1.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, gain.k[0], probe.getAltitude() - before);
+}
+
+void test_predict_ignored_before_first_update(void) {
+    Filter filter;
+    filter.predict(10.0f, 0.01f);
+    TEST_ASSERT_FALSE(filter.isInitialized());
+    filter.update(123.0f);
+    TEST_ASSERT_EQUAL_FLOAT(123.0f, filter.getAltitude());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, filter.getVelocity());
+}
+
+void test_tracks_boost_with_noisy_sensors(void) {
+    // 가속도 0.3 m/s² 바이어스 + 잡음, 기압 고도 0.5 m 잡음 (IMU 200 Hz, BMP 50 Hz)
+    Filter filter;
+    filter.begin(0.0f);
+    const float dt = 0.005f, accelBias = 0.3f;
+    float h = 0.0f, v = 0.0f;
+    double filterError = 0.0, baroError = 0.0, velocityError = 0.0;
+    int samples = 0;
+
+    for (int k = 0; k < 4000; k++) {                    // 20 s
+        float t = k * dt;
+        float a = (t > 5.0f && t < 7.5f) ? 40.0f : (t >= 7.5f && v > 0.0f ? -GRAVITY : 0.0f);
+        h += v * dt + 0.5f * a * dt * dt;
+        v += a * dt;
+        filter.predict(a + accelBias + gaussian(0.2f), dt);
+
+        if (k % 4 == 3) {
+            float measured = h + gaussian(0.5f);
+            filter.update(measured);
+            if (t > 3.0f) {
+                filterError += (filter.getAltitude() - h) * (filter.getAltitude() - h);
+                baroError += (measured - h) * (measured - h);
+                velocityError += (filter.getVelocity() - v) * (filter.getVelocity() - v);
+                samples++;
+            }
+        }
+    }
+
+    float filterRms = sqrtf(filterError / samples);
+    float baroRms = sqrtf(baroError / samples);
+    float velocityRms = sqrtf(velocityError / samples);
+    TEST_ASSERT_LESS_THAN(baroRms * 0.6f, filterRms);   // 원시 기압보다 확실히 작음
+    TEST_ASSERT_LESS_THAN(0.5f, velocityRms);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, accelBias, filter.getBias());
+
+    char line[96];
+    snprintf(line, sizeof(line), "altitude RMS %.2f m (baro %.2f m), velocity RMS %.2f m/s", filterRms, baroRms, velocityRms);
+    TEST_MESSAGE(line);
+}
+
+void test_fixed_gain_cost(void) {
+    Filter adaptive;
+    adaptive.begin(0.0f);
+    Filter fixed;
+    fixed.computeFixedGain(0.005f, 4);
+    fixed.begin(0.0f);
+    const int rounds = 1000000;
+
+    auto run = [&](Filter& filter) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            filter.predict(0.01f * (i & 7), 0.005f);
+            if ((i & 3) == 3) filter.update(0.0f);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+    };
+    double adaptiveNs = run(adaptive);
+    double fixedNs = run(fixed);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, adaptive.getAltitude(), fixed.getAltitude());
+
+    char line[96];
+    snprintf(line, sizeof(line), "predict(+1/4 update) adaptive %.1f ns, fixed gain %.1f ns (host)", adaptiveNs, fixedNs);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_solve_does_not_touch_state);
+    RUN_TEST(test_gain_depends_on_rates);
+    RUN_TEST(test_switching_gain_keeps_state);
+    RUN_TEST(test_fixed_gain_matches_adaptive);
+    RUN_TEST(test_predict_ignored_before_first_update);
+    RUN_TEST(test_tracks_boost_with_noisy_sensors);
+    RUN_TEST(test_fixed_gain_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,217 @@
+// test/test_mode/test_main.cpp
+// Mode: 장치를 update마다 하나씩 (BMP -> IMU -> GPS -> 필터 이득 마지막), 주기가 같은 단계는 건너뜀,
+// 비행 소프트웨어 전체를 단계별 프로필로 돌려 CPU 사용률과 I2C 점유율 측정
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <new>
+#include "Flight.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ---- Mode 단독 (가짜 BMP 버스, 연결 전 IMU/GPS) ----
+
+static FakeBmp390Bus modeBus;
+static FakeSh2Device modeHub;
+static LoopbackPort modePort;
+
+struct ModeRig {
+    BMP390 bmp;
+    BNO085 imu;
+    GPS gps;
+    Filter filter;
+    Mode mode;
+
+    ModeRig() : bmp(&modeBus), imu(&modeHub), gps(&modePort) {}
+};
+
+static void startRig(ModeRig& rig, FlightState initial) {
+    halSetMicros(0);
+    Serial.setEnabled(false);
+    new (&modeBus) FakeBmp390Bus();
+    InitStatus status;
+    while ((status = rig.bmp.beginStep()) == INIT_PENDING) halAdvanceMicros(500);
+    TEST_ASSERT_EQUAL(INIT_READY, status);
+
+    rig.mode.begin(&rig.bmp, &rig.imu, &rig.gps, &rig.filter, initial);
+    for (uint8_t i = 0; i < 8 && !rig.mode.isApplied(); i++) rig.mode.update(initial);
+    TEST_ASSERT_TRUE(rig.mode.isApplied());
+}
+
+static bool gainEquals(Filter& filter, const FilterGain& expected) {
+    const float* gain = filter.getGain();
+    return gain[0] == expected.k[0] && gain[1] == expected.k[1] && gain[2] == expected.k[2];
+}
+
+static FilterGain gainFor(FlightState state) {
+    Filter solver;
+    const RateProfile& profile = Mode::profileFor(state);
+    return solver.solveFixedGain(profile.imuIntervalUs * 1e-6f, profile.predictsPerUpdate());
+}
+
+void test_applies_one_device_per_update_gain_last(void) {
+    static ModeRig rig;
+    new (&rig) ModeRig();
+    startRig(rig, STATE_LAUNCH_PAD);
+
+    const RateProfile& pad = Mode::profileFor(STATE_LAUNCH_PAD);
+    const RateProfile& ascent = Mode::profileFor(STATE_ASCENT);
+    TEST_ASSERT_EQUAL_HEX8(pad.baroOdr, modeBus.getRegister(BMP390_REG_ODR));
+    TEST_ASSERT_EQUAL(pad.imuIntervalUs, rig.imu.getReportInterval());
+    TEST_ASSERT_EQUAL(pad.gpsHz, rig.gps.getUpdateRate());
+    TEST_ASSERT_TRUE(gainEquals(rig.filter, gainFor(STATE_LAUNCH_PAD)));
+
+    // 1: 전환 시작 + BMP ODR/OSR
+    TEST_ASSERT_TRUE(rig.mode.update(STATE_ASCENT));
+    TEST_ASSERT_FALSE(rig.mode.isApplied());
+    TEST_ASSERT_EQUAL_HEX8(ascent.baroOdr, modeBus.getRegister(BMP390_REG_ODR));
+    TEST_ASSERT_EQUAL_HEX8((ascent.baroTemperatureOsr << 3) | ascent.baroPressureOsr, modeBus.getRegister(BMP390_REG_OSR));
+    TEST_ASSERT_EQUAL(pad.imuIntervalUs, rig.imu.getReportInterval());
+    TEST_ASSERT_EQUAL(pad.gpsHz, rig.gps.getUpdateRate());
+    TEST_ASSERT_TRUE(gainEquals(rig.filter, gainFor(STATE_LAUNCH_PAD)));
+
+    // 2: IMU 리포트 주기
+    TEST_ASSERT_FALSE(rig.mode.update(STATE_ASCENT));
+    TEST_ASSERT_EQUAL(ascent.imuIntervalUs, rig.imu.getReportInterval());
+    TEST_ASSERT_EQUAL(pad.gpsHz, rig.gps.getUpdateRate());
+    TEST_ASSERT_TRUE(gainEquals(rig.filter, gainFor(STATE_LAUNCH_PAD)));
+
+    // 3: GPS
+    TEST_ASSERT_FALSE(rig.mode.update(STATE_ASCENT));
+    TEST_ASSERT_EQUAL(ascent.gpsHz, rig.gps.getUpdateRate());
+    TEST_ASSERT_TRUE(gainEquals(rig.filter, gainFor(STATE_LAUNCH_PAD)));
+    TEST_ASSERT_FALSE(rig.mode.isApplied());
+
+    // 4: 모든 주기가 바뀐 뒤에야 필터 이득
+    TEST_ASSERT_FALSE(rig.mode.update(STATE_ASCENT));
+    TEST_ASSERT_TRUE(gainEquals(rig.filter, gainFor(STATE_ASCENT)));
+    TEST_ASSERT_TRUE(rig.mode.isApplied());
+    TEST_ASSERT_EQUAL(1, rig.mode.getChangeCount());
+
+    // 적용이 끝나면 더 이상 버스 접근 없음
+    modeBus.resetCounters();
+    TEST_ASSERT_FALSE(rig.mode.update(STATE_ASCENT));
+    TEST_ASSERT_EQUAL(0, modeBus.getTransactions());
+}
+
+void test_same_rate_profiles_skipped(void) {
+    static ModeRig rig;
+    new (&rig) ModeRig();
+    startRig(rig, STATE_ASCENT);
+    TEST_ASSERT_EQUAL(0, rig.mode.getChangeCount());
+
+    // 상승 -> 정점: 주기가 같으므로 전환 없음 (버스 접근 없음, 프로필 이름만 갱신)
+    modeBus.resetCounters();
+    TEST_ASSERT_FALSE(rig.mode.update(STATE_APOGEE));
+    TEST_ASSERT_TRUE(rig.mode.isApplied());
+    TEST_ASSERT_EQUAL(0, rig.mode.getChangeCount());
+    TEST_ASSERT_EQUAL(0, modeBus.getTransactions());
+    TEST_ASSERT_EQUAL_STRING("APOGEE", rig.mode.getProfile().name);
+
+    // 정점 -> 하강: 전환
+    TEST_ASSERT_TRUE(rig.mode.update(STATE_DESCENT));
+    TEST_ASSERT_EQUAL(1, rig.mode.getChangeCount());
+
+    // 하강 -> 분리: 상승과 같은 주기지만 하강과 다르므로 전환
+    for (uint8_t i = 0; i < 4; i++) rig.mode.update(STATE_DESCENT);
+    TEST_ASSERT_TRUE(rig.mode.isApplied());
+    TEST_ASSERT_TRUE(rig.mode.update(STATE_PROBE_RELEASE));
+    TEST_ASSERT_EQUAL(2, rig.mode.getChangeCount());
+
+    // 같은 주기 단계는 필터 이득도 같은 값 (begin에서 복사)
+    for (uint8_t i = 0; i < 4; i++) rig.mode.update(STATE_PROBE_RELEASE);
+    TEST_ASSERT_TRUE(gainEquals(rig.filter, gainFor(STATE_ASCENT)));
+}
+
+// ---- 단계별 CPU / I2C (비행 소프트웨어 전체) ----
+
+#define STEP_US          100
+#define MEASURE_US       2000000
+
+static void step() {
+    flightLoop();
+    halAdvanceMicros(STEP_US);
+    imuDevice.tick();
+}
+
+struct ProfileLoad {
+    float cpu;          // 태스크 실행 시간 비율
+    float baroBusUse;   // BMP390 I2C 점유율
+    float imuBusUse;    // BNO085 I2C 점유율
+};
+
+// 단계를 고정한 채 프로필 적용을 기다린 뒤 MEASURE_US 동안 측정
+static ProfileLoad measure(FlightState state) {
+    for (uint32_t us = 0; us < 200000 || !rates.isApplied(); us += STEP_US) {
+        flightState.setState(state);
+        step();
+        TEST_ASSERT_LESS_THAN(1000000, us);
+    }
+    TEST_ASSERT_EQUAL_STRING(Mode::profileFor(state).name, rates.getProfile().name);
+    TEST_ASSERT_EQUAL(rates.getProfile().baroPollUs(), scheduler.getPeriod(TASK_BMP));
+    TEST_ASSERT_EQUAL(rates.getProfile().imuIntervalUs, imu.getReportInterval());
+
+    scheduler.resetStats();
+    baroBus.resetCounters();
+    imuDevice.resetCounters();
+    uint32_t start = halMicros();
+    while (halMicros() - start < MEASURE_US) {
+        flightState.setState(state);
+        step();
+    }
+    uint32_t elapsed = halMicros() - start;
+
+    ProfileLoad load;
+    load.cpu = scheduler.getCpuLoad();
+    load.baroBusUse = baroBus.getUtilization(400000, elapsed);
+    load.imuBusUse = imuDevice.getBytesTransferred() * 9.0f * 1000000.0f / BNO085_I2C_CLOCK / elapsed;
+    return load;
+}
+
+void test_cpu_and_i2c_per_profile(void) {
+    halSetMicros(0);
+    Serial.setEnabled(false);
+    flightReset();
+    flightSetup();
+    while (!boot.isDone() && halMicros() < 5000000) step();
+    TEST_ASSERT_TRUE(boot.isDone());
+
+    static const FlightState STATES[] = {
+        STATE_LAUNCH_PAD, STATE_ASCENT, STATE_DESCENT, STATE_PROBE_RELEASE, STATE_LANDED,
+    };
+    ProfileLoad loads[FLIGHT_STATE_COUNT];
+    for (size_t i = 0; i < sizeof(STATES) / sizeof(STATES[0]); i++) {
+        FlightState state = STATES[i];
+        loads[state] = measure(state);
+
+        char line[112];
+        snprintf(line, sizeof(line), "%-14s CPU %5.2f %%, I2C BMP %5.2f %%, I2C IMU %5.2f %%",
+                 Mode::profileFor(state).name, loads[state].cpu * 100.0f,
+                 loads[state].baroBusUse * 100.0f, loads[state].imuBusUse * 100.0f);
+        TEST_MESSAGE(line);
+    }
+
+    // 최대 주기 구간이 가장 무겁고, 발사대/착륙 후는 가벼움
+    TEST_ASSERT_TRUE(loads[STATE_ASCENT].cpu > loads[STATE_DESCENT].cpu);
+    TEST_ASSERT_TRUE(loads[STATE_DESCENT].cpu > loads[STATE_LAUNCH_PAD].cpu);
+    TEST_ASSERT_TRUE(loads[STATE_LAUNCH_PAD].cpu > loads[STATE_LANDED].cpu);
+    TEST_ASSERT_TRUE(loads[STATE_ASCENT].imuBusUse > loads[STATE_LAUNCH_PAD].imuBusUse * 3.0f);
+    TEST_ASSERT_TRUE(loads[STATE_ASCENT].baroBusUse > loads[STATE_LAUNCH_PAD].baroBusUse);
+    TEST_ASSERT_TRUE(loads[STATE_LAUNCH_PAD].baroBusUse > loads[STATE_LANDED].baroBusUse);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, loads[STATE_ASCENT].cpu, loads[STATE_PROBE_RELEASE].cpu);
+
+    // 최대 주기에서도 여유 (IMU 버스 절반 미만)
+    TEST_ASSERT_TRUE(loads[STATE_ASCENT].imuBusUse < 0.5f);
+    TEST_ASSERT_TRUE(loads[STATE_ASCENT].cpu < 0.5f);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_applies_one_device_per_update_gain_last);
+    RUN_TEST(test_same_rate_profiles_skipped);
+    RUN_TEST(test_cpu_and_i2c_per_profile);
+    return UNITY_END();
+}
@@ -0,0 +1,166 @@
+// test/test_nmea_parser/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "sensors/NMEAParser.h"
+
+// 본문에 체크섬과 줄바꿈을 붙여 완성된 문장으로
+static void makeSentence(const char* body, char* out, size_t outSize) {
+    uint8_t sum = 0;
+    for (const char* p = body; *p; p++) sum ^= (uint8_t)*p;
+    snprintf(out, outSize, "$%s*%02X\r\n", body, sum);
+}
+
+// 문자열 전체를 넣고 완성된 문장 수 반환 (완성될 때마다 해석)
+static int feedAll(NMEAParser& parser, const char* text, NMEASentence* last = nullptr) {
+    int complete = 0;
+    for (const char* p = text; *p; p++) {
+        if (parser.feed(*p)) {
+            complete++;
+            NMEASentence id = parser.parse();
+            if (last) *last = id;
+        }
+    }
+    return complete;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_gga_fields(void) {
+    char text[128];
+    makeSentence("GNGGA,123519.25,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,", text, sizeof(text));
+
+    NMEAParser parser;
+    NMEASentence id = NMEA_NONE;
+    TEST_ASSERT_EQUAL(1, feedAll(parser, text, &id));
+    TEST_ASSERT_EQUAL(NMEA_GGA, id);
+
+    const NMEAData& data = parser.getData();
+    TEST_ASSERT_EQUAL(12, data.hour);
+    TEST_ASSERT_EQUAL(35, data.minute);
+    TEST_ASSERT_EQUAL(19, data.seconds);
+    TEST_ASSERT_EQUAL(250, data.milliseconds);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-7, 48.1173, data.latitude);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-7, 11.516666667, data.longitude);
+    TEST_ASSERT_TRUE(data.fix);
+    TEST_ASSERT_EQUAL(8, data.satellites);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 545.4f, data.altitude);
+}
+
+void test_rmc_southern_western(void) {
+    char text[128];
+    makeSentence("GPRMC,225446.00,A,3351.3800,S,15112.4200,W,12.5,084.4,191194,,,A", text, sizeof(text));
+
+    NMEAParser parser;
+    NMEASentence id = NMEA_NONE;
+    TEST_ASSERT_EQUAL(1, feedAll(parser, text, &id));
+    TEST_ASSERT_EQUAL(NMEA_RMC, id);
+
+    const NMEAData& data = parser.getData();
+    TEST_ASSERT_TRUE(data.fix);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-7, -33.856333333, data.latitude);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-7, -151.207, data.longitude);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 12.5f, data.speedKnots);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 84.4f, data.course);
+}
+
+void test_no_fix_keeps_last_position(void) {
+    char good[128], empty[128];
+    makeSentence("GNGGA,000001.00,3724.0074,N,12654.9341,E,1,09,1.0,40.0,M,,M,,", good, sizeof(good));
+    makeSentence("GNGGA,000002.00,,,,,0,00,,,M,,M,,", empty, sizeof(empty));
+
+    NMEAParser parser;
+    feedAll(parser, good);
+    feedAll(parser, empty);
+    const NMEAData& data = parser.getData();
+    TEST_ASSERT_FALSE(data.fix);
+    TEST_ASSERT_EQUAL(2, data.seconds);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 37.40012333, data.latitude);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 40.0f, data.altitude);
+}
+
+void test_checksum_error_and_resync(void) {
+    char text[128];
+    makeSentence("GNGGA,000003.00,3724.0074,N,12654.9341,E,1,09,1.0,40.0,M,,M,,", text, sizeof(text));
+
+    // 체크섬 한 자리 손상
+    char bad[128];
+    strcpy(bad, text);
+    char* star = strchr(bad, '*');
+    star[1] = star[1] == '0' ? '1' : '0';
+
+    // 잘린 문장 뒤에 바로 새 문장
+    char stream[512];
+    snprintf(stream, sizeof(stream), "garbage%s$GNGGA,0000%s", bad, text);
+
+    NMEAParser parser;
+    TEST_ASSERT_EQUAL(1, feedAll(parser, stream));
+    TEST_ASSERT_EQUAL(1, parser.getChecksumErrors());
+    TEST_ASSERT_EQUAL(1, parser.getDroppedCount());
+    TEST_ASSERT_EQUAL(1, parser.getSentenceCount());
+    TEST_ASSERT_EQUAL(3, parser.getData().seconds);
+}
+
+void test_sentence_is_raw_text_until_parse(void) {
+    char text[128];
+    makeSentence("GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00", text, sizeof(text));
+
+    NMEAParser parser;
+    bool complete = false;
+    for (const char* p = text; *p; p++) complete |= parser.feed(*p);
+    TEST_ASSERT_TRUE(complete);
+    TEST_ASSERT_EQUAL_STRING("GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00", parser.sentence());
+
+    // 해석하지 않는 문장
+    TEST_ASSERT_EQUAL(NMEA_NONE, parser.parse());
+    TEST_ASSERT_EQUAL(0, parser.getParsedCount());
+}
+
+void test_overlong_and_invalid_bytes_dropped(void) {
+    char body[NMEA_MAX_LEN + 20];
+    memset(body, 'A', sizeof(body) - 1);
+    body[sizeof(body) - 1] = '\0';
+    char text[256];
+    makeSentence(body, text, sizeof(text));
+
+    NMEAParser parser;
+    TEST_ASSERT_EQUAL(0, feedAll(parser, text));
+    TEST_ASSERT_EQUAL(1, parser.getDroppedCount());
+
+    // 본문 중간의 제어 문자
+    TEST_ASSERT_EQUAL(0, feedAll(parser, "$GNGGA,1\x01" "2*00\r\n"));
+    TEST_ASSERT_EQUAL(2, parser.getDroppedCount());
+}
+
+void test_parse_cost(void) {
+    char text[128];
+    makeSentence("GNGGA,123519.25,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,", text, sizeof(text));
+    NMEAParser parser;
+    const int rounds = 100000;
+
+    auto start = std::chrono::steady_clock::now();
+    int complete = 0;
+    for (int i = 0; i < rounds; i++) complete += feedAll(parser, text);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+    TEST_ASSERT_EQUAL(rounds, complete);
+
+    char line[80];
+    snprintf(line, sizeof(line), "GGA feed+parse %.0f ns/sentence (%u bytes, host)", ns, (unsigned)strlen(text));
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_gga_fields);
+    RUN_TEST(test_rmc_southern_western);
+    RUN_TEST(test_no_fix_keeps_last_position);
+    RUN_TEST(test_checksum_error_and_resync);
+    RUN_TEST(test_sentence_is_raw_text_until_parse);
+    RUN_TEST(test_overlong_and_invalid_bytes_dropped);
+    RUN_TEST(test_parse_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,147 @@
+// test/test_pid/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "PID.h"
+#include "Servo.h"
+
+// main.cpp의 회전 감쇠 게인 / 주기
+static const PIDGains SPIN_GAINS = { 0.015f, 0.01f, 0.0005f, 20.0f, -1.0f, 1.0f };
+static const float DT = 0.005f;
+
+// 회전 플랜트: dω/dt = b·δ - c·ω + d, 서보 1차 지연 30 ms + 슬루 제한
+struct SpinPlant {
+    double rate;             // °/s
+    double deflection;       // 정규화 (-1~1)
+
+    void step(double command, double disturbance, double dt) {
+        const double b = 400.0, c = 0.3, tau = 0.03, slew = 6.0;
+        for (int i = 0; i < 5; i++) {
+            double h = dt / 5;
+            double d = (command - deflection) / tau * h;
+            double limit = slew * h;
+            if (d > limit) d = limit;
+            if (d < -limit) d = -limit;
+            deflection += d;
+            rate += (b * deflection - c * rate + disturbance) * h;
+        }
+    }
+};
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_spin_is_damped_and_disturbance_rejected(void) {
+    PID pid;
+    pid.configure(SPIN_GAINS, DT);
+    ServoDriver servo;
+    TEST_ASSERT_TRUE(servo.begin(22, 200));
+
+    SpinPlant plant = { 360.0, 0.0 };
+    double settle = -1.0;
+    double worstAfterSettle = 0.0;
+
+    for (int k = 0; k < 2000; k++) {             // 10 s
+        double t = k * DT;
+        servo.write(pid.update(0.0f, (float)plant.rate));
+        double command = (servo.getPulse() - SERVO_CENTER_US) / 500.0;
+        plant.step(command, t >= 5.0 ? 20.0 : 0.0, DT);   // 5 s에 외란 토크
+
+        if (settle < 0 && fabs(plant.rate) < 5.0) settle = t;
+        if (settle > 0 && t > settle + 0.5 && t < 5.0 && fabs(plant.rate) > worstAfterSettle) {
+            worstAfterSettle = fabs(plant.rate);
+        }
+    }
+
+    // 1.5 s 안에 ±5 °/s, 이후 오버슈트 10 °/s 미만, 외란 후 적분으로 0 복귀
+    TEST_ASSERT_GREATER_THAN(0.0, settle);
+    TEST_ASSERT_LESS_THAN(1.5, settle);
+    TEST_ASSERT_LESS_THAN(10.0, worstAfterSettle);
+    TEST_ASSERT_FLOAT_WITHIN(1.0, 0.0, plant.rate);
+}
+
+void test_integral_does_not_wind_up_in_saturation(void) {
+    PID pid;
+    pid.configure(SPIN_GAINS, DT);
+
+    // 오래 포화된 상태 (출력 최대) - 적분이 포화 방향으로 쌓이지 않아야 함
+    for (int i = 0; i < 2000; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, -1.0f, pid.update(0.0f, 1000.0f));
+    }
+    float integral = pid.getIntegral();
+    TEST_ASSERT_LESS_OR_EQUAL(1.0f, fabsf(integral));
+
+    // 오차가 사라지면 바로 포화에서 빠져나옴
+    pid.update(0.0f, 0.0f);
+    float out = pid.update(0.0f, 0.0f);
+    TEST_ASSERT_GREATER_THAN(-1.0f, out);
+}
+
+void test_no_derivative_kick_on_setpoint_step(void) {
+    PIDGains gains = { 0.0f, 0.0f, 1.0f, 0.0f, -100.0f, 100.0f };
+    PID pid;
+    pid.configure(gains, DT);
+
+    pid.update(0.0f, 10.0f);
+    // 설정값만 바뀌면 미분항은 0 (측정값 기준 미분)
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pid.update(50.0f, 10.0f));
+}
+
+void test_reset_clears_state(void) {
+    PID pid;
+    pid.configure(SPIN_GAINS, DT);
+    for (int i = 0; i < 100; i++) pid.update(0.0f, 30.0f);
+    pid.reset();
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, pid.getIntegral());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, SPIN_GAINS.kp * -5.0f, pid.update(0.0f, 5.0f));
+}
+
+void test_servo_frequency_and_pulse_limits(void) {
+    ServoDriver servo;
+    TEST_ASSERT_TRUE(servo.begin(22));
+    TEST_ASSERT_EQUAL(20000, servo.getPeriodUs());        // 기본 50 Hz
+
+    TEST_ASSERT_TRUE(servo.begin(22, 200));
+    TEST_ASSERT_EQUAL(5000, servo.getPeriodUs());
+    TEST_ASSERT_EQUAL(SERVO_CENTER_US, servo.getPulse());
+
+    servo.write(2.0f);
+    TEST_ASSERT_EQUAL(SERVO_MAX_US, servo.getPulse());
+    servo.write(-0.5f);
+    TEST_ASSERT_EQUAL(1250, servo.getPulse());
+    servo.writeMicroseconds(100);
+    TEST_ASSERT_EQUAL(SERVO_MIN_US, servo.getPulse());
+
+    // 펄스가 주기보다 길면 거부 (2500 us > 400 Hz 주기)
+    TEST_ASSERT_FALSE(servo.begin(22, 400, 500, 2500));
+    TEST_ASSERT_FALSE(servo.begin(22, 0));
+}
+
+void test_update_cost(void) {
+    PID pid;
+    pid.configure(SPIN_GAINS, DT);
+    const int rounds = 1000000;
+    volatile float sink = 0.0f;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) sink = sink + pid.update(0.0f, (float)((i * 37) % 1440 - 720));
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+    char line[80];
+    snprintf(line, sizeof(line), "PID update %.1f ns/iteration (host)", ns);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_spin_is_damped_and_disturbance_rejected);
+    RUN_TEST(test_integral_does_not_wind_up_in_saturation);
+    RUN_TEST(test_no_derivative_kick_on_setpoint_step);
+    RUN_TEST(test_reset_clears_state);
+    RUN_TEST(test_servo_frequency_and_pulse_limits);
+    RUN_TEST(test_update_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,122 @@
+// test/test_profiler/test_main.cpp
+// Profiler: 알려진 구간 길이로 min/mean/p99/max와 DIAG 줄 확인 (호스트 틱 = ns)
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <chrono>
+#include "Profiler.h"
+#include "Telemetry.h"
+
+void setUp(void) {
+    Profiler::reset();
+}
+void tearDown(void) {}
+
+// 히스토그램 해상도: 옥타브당 4칸 -> 칸 상한은 실제 값보다 최대 약 25% 큼
+static void assertPercentileNear(uint32_t expected, uint32_t actual) {
+    TEST_ASSERT_GREATER_OR_EQUAL(expected, actual);
+    TEST_ASSERT_LESS_OR_EQUAL(expected + expected / 4, actual);
+}
+
+void test_uniform_durations(void) {
+    // 1 ~ 1000 us, 1 us 간격
+    for (uint32_t us = 1; us <= 1000; us++) Profiler::record(PROBE_IMU_UPDATE, us * 1000);
+
+    const ProbeStats& s = Profiler::getStats(PROBE_IMU_UPDATE);
+    TEST_ASSERT_EQUAL(1000, s.count);
+    TEST_ASSERT_EQUAL(1000, s.minTicks);
+    TEST_ASSERT_EQUAL(1000000, s.maxTicks);
+    TEST_ASSERT_EQUAL(500500, (uint32_t)(s.totalTicks / s.count));
+
+    // 990번째(0부터) = 991 us, 칸 상한이 max보다 크면 max로
+    TEST_ASSERT_EQUAL(1000000, Profiler::percentile(PROBE_IMU_UPDATE, 0.99f));
+    assertPercentileNear(501000, Profiler::percentile(PROBE_IMU_UPDATE, 0.5f));
+    assertPercentileNear(901000, Profiler::percentile(PROBE_IMU_UPDATE, 0.9f));
+
+    // 다른 프로브는 그대로
+    TEST_ASSERT_EQUAL(0, Profiler::getStats(PROBE_BMP_UPDATE).count);
+    TEST_ASSERT_EQUAL(0, Profiler::percentile(PROBE_BMP_UPDATE, 0.99f));
+}
+
+void test_p99_separates_rare_outliers(void) {
+    // 1%가 느리면 p99가 느린 쪽, 1% 미만이면 빠른 쪽
+    for (int i = 0; i < 990; i++) Profiler::record(PROBE_BMP_UPDATE, 100000);
+    for (int i = 0; i < 10; i++) Profiler::record(PROBE_BMP_UPDATE, 5000000);
+    TEST_ASSERT_EQUAL(5000000, Profiler::percentile(PROBE_BMP_UPDATE, 0.99f));
+
+    for (int i = 0; i < 991; i++) Profiler::record(PROBE_GPS_UPDATE, 100000);
+    for (int i = 0; i < 9; i++) Profiler::record(PROBE_GPS_UPDATE, 5000000);
+    assertPercentileNear(100000, Profiler::percentile(PROBE_GPS_UPDATE, 0.99f));
+    TEST_ASSERT_EQUAL(5000000, Profiler::getStats(PROBE_GPS_UPDATE).maxTicks);
+}
+
+void test_percentile_bucket_bounds(void) {
+    // 값 하나만 있으면 어느 크기든 p99 = 그 값 (상한이 max로 잘림), 작은 값은 칸이 정확
+    static const uint32_t VALUES[] = { 0, 1, 3, 4, 7, 1000, 65535, 65536, 999999, 4000000000u };
+    for (size_t i = 0; i < sizeof(VALUES) / sizeof(VALUES[0]); i++) {
+        Profiler::reset();
+        Profiler::record(PROBE_PACKET_TRANSMIT, VALUES[i]);
+        TEST_ASSERT_EQUAL(VALUES[i], Profiler::percentile(PROBE_PACKET_TRANSMIT, 0.99f));
+    }
+
+    // 같은 옥타브 안 두 값: 작은 쪽의 칸 상한은 큰 값을 넘지 않으면 그대로
+    Profiler::reset();
+    for (int i = 0; i < 99; i++) Profiler::record(PROBE_PACKET_TRANSMIT, 1100);
+    Profiler::record(PROBE_PACKET_TRANSMIT, 2000);
+    assertPercentileNear(1100, Profiler::percentile(PROBE_PACKET_TRANSMIT, 0.5f));
+}
+
+void test_diag_line(void) {
+    Profiler::record(PROBE_IMU_UPDATE, 10000);
+    Profiler::record(PROBE_IMU_UPDATE, 20000);
+    Profiler::record(PROBE_IMU_UPDATE, 30000);
+    Profiler::record(PROBE_CONTROL, 2500);
+
+    char line[TELEMETRY_MAX_LEN];
+    size_t length = Profiler::formatDiagnostics(line, sizeof(line));
+    TEST_ASSERT_EQUAL(strlen(line), length);
+    TEST_ASSERT_EQUAL_STRING("DIAG,IMU,3,10.0,20.0,30.0,30.0,"
+                             "BMP,0,0.0,0.0,0.0,0.0,"
+                             "GPS,0,0.0,0.0,0.0,0.0,"
+                             "TX,0,0.0,0.0,0.0,0.0,"
+                             "CTRL,1,2.5,2.5,2.5,2.5", line);
+}
+
+void test_scope_measures_real_time(void) {
+    {
+        ProfileScope scope(PROBE_CONTROL);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    const ProbeStats& s = Profiler::getStats(PROBE_CONTROL);
+    TEST_ASSERT_EQUAL(1, s.count);
+    TEST_ASSERT_TRUE(Profiler::ticksToMicros(s.minTicks) >= 2000.0f);
+    TEST_ASSERT_TRUE(Profiler::ticksToMicros(s.maxTicks) < 200000.0f);
+
+    // 측정 자체의 비용 (빈 범위)
+    const int rounds = 100000;
+    Profiler::reset();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        ProfileScope empty(PROBE_PACKET_TRANSMIT);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+    TEST_ASSERT_EQUAL(rounds, Profiler::getStats(PROBE_PACKET_TRANSMIT).count);
+
+    char text[96];
+    snprintf(text, sizeof(text), "empty scope %.1f ns (host), recorded p99 %.3f us",
+             ns, Profiler::ticksToMicros(Profiler::percentile(PROBE_PACKET_TRANSMIT, 0.99f)));
+    TEST_MESSAGE(text);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_uniform_durations);
+    RUN_TEST(test_p99_separates_rare_outliers);
+    RUN_TEST(test_percentile_bucket_bounds);
+    RUN_TEST(test_diag_line);
+    RUN_TEST(test_scope_measures_real_time);
+    return UNITY_END();
+}
@@ -0,0 +1,235 @@
+// test/test_quat_math/test_main.cpp
+// QuatMath 근사 오차와 비용: fastAtan2f/fastAsinf, 회전행렬 오일러각/월드 가속도를 이전 구현(배정밀도 libm)과 비교
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdint.h>
+#include <chrono>
+#include "QuatMath.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ---- 이전 구현 (BNO085::quaternionToEuler / transformAccelToRPY, 543aaa0) ----
+
+static void baselineQuaternionToEuler(double w, double i, double j, double k, double& roll, double& pitch, double& yaw) {
+    double sinr_cosp = 2.0 * (w * i + j * k);
+    double cosr_cosp = 1.0 - 2.0 * (i * i + j * j);
+    roll = atan2(sinr_cosp, cosr_cosp) * 180.0 / M_PI;
+
+    double sinp = 2.0 * (w * j - k * i);
+    if (fabs(sinp) >= 1)
+        pitch = copysign(M_PI / 2, sinp) * 180.0 / M_PI;
+    else
+        pitch = asin(sinp) * 180.0 / M_PI;
+
+    double siny_cosp = 2.0 * (w * k + i * j);
+    double cosy_cosp = 1.0 - 2.0 * (j * j + k * k);
+    yaw = atan2(siny_cosp, cosy_cosp) * 180.0 / M_PI;
+}
+
+static void baselineTransformAccel(double w, double i, double j, double k, double ax, double ay, double az,
+                                   double& outR, double& outP, double& outY) {
+    double ci = -i, cj = -j, ck = -k, cw = w;
+
+    // q * v
+    double tr = -i * ax - j * ay - k * az;
+    double ti = w * ax + j * az - k * ay;
+    double tj = w * ay + k * ax - i * az;
+    double tk = w * az + i * ay - j * ax;
+
+    // (q * v) * q^(-1)
+    outR = ti * cw + tr * ci + tj * ck - tk * cj;
+    outP = tj * cw + tr * cj + tk * ci - ti * ck;
+    outY = tk * cw + tr * ck + ti * cj - tj * ci;
+}
+
+// ---- 결정적 의사난수 (xorshift) ----
+
+static uint32_t rngState = 2463534242u;
+
+static float randomUnit() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (rngState >> 8) * (1.0f / 16777216.0f) * 2.0f - 1.0f;   // [-1, 1)
+}
+
+static Quat randomQuat() {
+    Quat q;
+    float n;
+    do {
+        q.w = randomUnit(); q.x = randomUnit(); q.y = randomUnit(); q.z = randomUnit();
+        n = q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+    } while (n < 0.01f || n > 1.0f);
+    float inv = 1.0f / sqrtf(n);
+    q.w *= inv; q.x *= inv; q.y *= inv; q.z *= inv;
+    return q;
+}
+
+// 각도 차이 (도, ±180 감싸기)
+static double angleError(double a, double b) {
+    double d = fmod(a - b + 540.0, 360.0) - 180.0;
+    return fabs(d);
+}
+
+// ---- 근사 함수 오차 ----
+
+void test_fast_atan2_max_error(void) {
+    // 단위원 전체 + 크기 변화 (분모 0, 축 위 포함)
+    double worst = 0.0;
+    const int STEPS = 200000;
+    for (int n = 0; n <= STEPS; n++) {
+        double angle = -M_PI + 2.0 * M_PI * n / STEPS;
+        float scale = (n % 7 == 0) ? 1e-3f : ((n % 5 == 0) ? 1e3f : 1.0f);
+        float y = (float)sin(angle) * scale;
+        float x = (float)cos(angle) * scale;
+        double err = fabs(fastAtan2f(y, x) - atan2((double)y, (double)x));
+        if (err > worst) worst = err;
+    }
+    TEST_ASSERT_TRUE(worst <= 2e-6);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fastAtan2f(0.0f, 0.0f));
+    TEST_ASSERT_FLOAT_WITHIN(2e-6f, QM_HALF_PI, fastAtan2f(1.0f, 0.0f));
+    TEST_ASSERT_FLOAT_WITHIN(2e-6f, QM_PI, fastAtan2f(0.0f, -1.0f));
+
+    char line[64];
+    snprintf(line, sizeof(line), "fastAtan2f max error %.2e rad", worst);
+    TEST_MESSAGE(line);
+}
+
+void test_fast_asin_max_error(void) {
+    double worst = 0.0;
+    float worstAt = 0.0f;
+    const int STEPS = 200000;
+    for (int n = 0; n <= STEPS; n++) {
+        float x = -1.0f + 2.0f * n / STEPS;
+        double err = fabs(fastAsinf(x) - asin((double)x));
+        if (err > worst) { worst = err; worstAt = x; }
+    }
+    // ±1 근처 (1 - x²가 작아지는 구간)
+    for (int n = 1; n <= 4096; n++) {
+        float x = nextafterf(1.0f, 0.0f);
+        for (int k = 1; k < n; k++) x = nextafterf(x, 0.0f);
+        double err = fabs(fastAsinf(x) - asin((double)x));
+        if (err > worst) { worst = err; worstAt = x; }
+        err = fabs(fastAsinf(-x) - asin((double)-x));
+        if (err > worst) { worst = err; worstAt = -x; }
+    }
+    TEST_ASSERT_TRUE(worst <= 2e-6);
+
+    // 범위 밖은 ±90°로
+    TEST_ASSERT_FLOAT_WITHIN(2e-6f, QM_HALF_PI, fastAsinf(1.0001f));
+    TEST_ASSERT_FLOAT_WITHIN(2e-6f, -QM_HALF_PI, fastAsinf(-1.5f));
+
+    char line[80];
+    snprintf(line, sizeof(line), "fastAsinf max error %.2e rad (at %.8f)", worst, worstAt);
+    TEST_MESSAGE(line);
+}
+
+// ---- 이전 구현과 비교 ----
+
+void test_euler_matches_baseline(void) {
+    double worst = 0.0;
+    uint32_t compared = 0;
+    for (int n = 0; n < 100000; n++) {
+        Quat q = randomQuat();
+        double roll, pitch, yaw;
+        baselineQuaternionToEuler(q.w, q.x, q.y, q.z, roll, pitch, yaw);
+
+        // 짐벌락 근처(피치 ±89.5° 밖)는 롤/요가 나뉘는 방식이 정의되지 않으므로 피치만
+        float r, p, y;
+        matrixToEuler(quatToMatrix(q), r, p, y);
+        double err = fabs(p - pitch);
+        if (fabs(pitch) < 89.5) {
+            err = fmax(err, fmax(angleError(r, roll), angleError(y, yaw)));
+            compared++;
+        }
+        if (err > worst) worst = err;
+    }
+    TEST_ASSERT_GREATER_THAN(99000, compared);
+    TEST_ASSERT_TRUE(worst < 1e-3);   // 도 (float 행렬 원소 반올림이 지배)
+
+    char line[80];
+    snprintf(line, sizeof(line), "euler max error %.2e deg over %u quaternions", worst, (unsigned)compared);
+    TEST_MESSAGE(line);
+}
+
+void test_world_accel_matches_baseline(void) {
+    double worst = 0.0;
+    for (int n = 0; n < 100000; n++) {
+        Quat q = randomQuat();
+        Vec3 a = { randomUnit() * 160.0f, randomUnit() * 160.0f, randomUnit() * 160.0f };   // ±16 g
+
+        double r, p, y;
+        baselineTransformAccel(q.w, q.x, q.y, q.z, a.x, a.y, a.z, r, p, y);
+        Vec3 world = quatToMatrix(q).apply(a);
+        double err = fmax(fabs(world.x - r), fmax(fabs(world.y - p), fabs(world.z - y)));
+        if (err > worst) worst = err;
+
+        // 수직 성분만 계산하는 경로도 같음
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, world.z, rotateZ(q, a));
+    }
+    TEST_ASSERT_TRUE(worst < 2e-4);   // m/s² (±160 m/s²에서 float 반올림)
+
+    char line[64];
+    snprintf(line, sizeof(line), "world accel max error %.2e m/s2", worst);
+    TEST_MESSAGE(line);
+}
+
+// ---- 비용 ----
+
+void test_cost_per_sample(void) {
+    const int COUNT = 4096;
+    static Quat quats[COUNT];
+    static Vec3 accels[COUNT];
+    for (int n = 0; n < COUNT; n++) {
+        quats[n] = randomQuat();
+        accels[n].x = randomUnit() * 20.0f; accels[n].y = randomUnit() * 20.0f; accels[n].z = 9.8f + randomUnit();
+    }
+
+    const int ROUNDS = 50;
+    volatile double sinkD = 0.0;
+    volatile float sinkF = 0.0f;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int n = 0; n < COUNT; n++) {
+            const Quat& q = quats[n];
+            double roll, pitch, yaw, r, p, y;
+            baselineQuaternionToEuler(q.w, q.x, q.y, q.z, roll, pitch, yaw);
+            baselineTransformAccel(q.w, q.x, q.y, q.z, accels[n].x, accels[n].y, accels[n].z, r, p, y);
+            sinkD = sinkD + roll + pitch + yaw + r + p + y;
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int n = 0; n < COUNT; n++) {
+            Mat3 m = quatToMatrix(quats[n]);
+            float roll, pitch, yaw;
+            matrixToEuler(m, roll, pitch, yaw);
+            Vec3 w = m.apply(accels[n]);
+            sinkF = sinkF + roll + pitch + yaw + w.x + w.y + w.z;
+        }
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    double baselineNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / (ROUNDS * COUNT);
+    double fastNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / (ROUNDS * COUNT);
+    char line[120];
+    snprintf(line, sizeof(line), "euler + world accel: baseline (double libm) %.1f ns/call, matrix + fast trig %.1f ns/call",
+             baselineNs, fastNs);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_fast_atan2_max_error);
+    RUN_TEST(test_fast_asin_max_error);
+    RUN_TEST(test_euler_matches_baseline);
+    RUN_TEST(test_world_accel_matches_baseline);
+    RUN_TEST(test_cost_per_sample);
+    return UNITY_END();
+}
@@ -0,0 +1,142 @@
+// test/test_recovery/test_main.cpp
+#include <unity.h>
+#include <string.h>
+#include "Recovery.h"
+
+static RecoverySnapshot makeSnapshot(uint32_t seconds) {
+    RecoverySnapshot snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.packetCount = seconds;
+    snapshot.missionElapsedMs = seconds * 1000;
+    snapshot.groundPressure = 1008.5f;
+    snapshot.state = STATE_LAUNCH_PAD;
+    snapshot.mode = 'F';
+    copyString(snapshot.lastCommand, "CXON", sizeof(snapshot.lastCommand));
+    return snapshot;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_counters_alone_journal_on_period(void) {
+    MemoryStore store;
+    Recovery recovery;
+    recovery.begin(&store);
+
+    // 10분 동안 1 Hz 저장, 중요 필드는 그대로
+    for (uint32_t s = 0; s < 600; s++) recovery.save(makeSnapshot(s));
+    TEST_ASSERT_EQUAL(10, recovery.getSaveCount());
+    TEST_ASSERT_EQUAL(590, recovery.getUnchangedCount());
+}
+
+void test_significant_change_journals_immediately(void) {
+    MemoryStore store;
+    Recovery recovery;
+    recovery.begin(&store);
+    recovery.save(makeSnapshot(0));
+
+    RecoverySnapshot snapshot = makeSnapshot(1);
+    snapshot.state = STATE_ASCENT;
+    recovery.save(snapshot);
+    TEST_ASSERT_EQUAL(2, recovery.getSaveCount());
+
+    snapshot = makeSnapshot(2);
+    snapshot.state = STATE_ASCENT;
+    snapshot.mode = 'S';
+    recovery.save(snapshot);
+    snapshot.missionElapsedMs = 3000;
+    snapshot.groundPressure = 1009.0f;
+    recovery.save(snapshot);
+    snapshot.missionElapsedMs = 4000;
+    copyString(snapshot.lastCommand, "SIMP", sizeof(snapshot.lastCommand));
+    recovery.save(snapshot);
+    TEST_ASSERT_EQUAL(5, recovery.getSaveCount());
+
+    // 카운터만 바뀌면 건너뜀
+    snapshot.packetCount = 99;
+    snapshot.missionElapsedMs = 5000;
+    recovery.save(snapshot);
+    TEST_ASSERT_EQUAL(5, recovery.getSaveCount());
+}
+
+void test_restores_latest_after_reboot(void) {
+    MemoryStore store;
+    Recovery recovery;
+    recovery.begin(&store);
+
+    // 슬롯을 여러 바퀴 돌도록 단계를 바꿔 가며 기록
+    RecoverySnapshot snapshot;
+    for (uint32_t s = 0; s < 40; s++) {
+        snapshot = makeSnapshot(s);
+        snapshot.state = (uint8_t)(s % FLIGHT_STATE_COUNT);
+        recovery.save(snapshot);
+    }
+
+    Recovery rebooted;
+    TEST_ASSERT_TRUE(rebooted.begin(&store));
+    RecoverySnapshot restored;
+    TEST_ASSERT_TRUE(rebooted.load(restored));
+    TEST_ASSERT_EQUAL(39, restored.packetCount);
+    TEST_ASSERT_EQUAL(39 % FLIGHT_STATE_COUNT, restored.state);
+    TEST_ASSERT_EQUAL_STRING("CXON", restored.lastCommand);
+}
+
+void test_torn_slot_is_ignored(void) {
+    MemoryStore store;
+    Recovery recovery;
+    recovery.begin(&store);
+    RecoverySnapshot snapshot = makeSnapshot(0);
+    recovery.save(snapshot);
+    snapshot.state = STATE_DESCENT;
+    recovery.save(snapshot);
+
+    // 두 번째 슬롯 기록 중 전원 차단 (끝부분이 지워진 채로 남음)
+    memset(store.raw() + RECOVERY_SLOT_SIZE + 20, 0xFF, 8);
+
+    Recovery rebooted;
+    TEST_ASSERT_TRUE(rebooted.begin(&store));
+    RecoverySnapshot restored;
+    rebooted.load(restored);
+    TEST_ASSERT_EQUAL(STATE_LAUNCH_PAD, restored.state);
+}
+
+void test_clear_invalidates_journal(void) {
+    MemoryStore store;
+    Recovery recovery;
+    recovery.begin(&store);
+    recovery.save(makeSnapshot(0));
+    recovery.clear();
+    TEST_ASSERT_FALSE(recovery.hasSnapshot());
+
+    Recovery rebooted;
+    TEST_ASSERT_FALSE(rebooted.begin(&store));
+
+    // 새 미션 첫 저장은 바로 기록
+    recovery.save(makeSnapshot(0));
+    TEST_ASSERT_TRUE(recovery.hasSnapshot());
+}
+
+void test_flash_writes_per_hour(void) {
+    MemoryStore store;
+    Recovery recovery;
+    recovery.begin(&store);
+
+    for (uint32_t s = 0; s < 3600; s++) recovery.save(makeSnapshot(s));
+
+    // 1시간 대기 중 기록 60회 (매초 기록이면 3600회), 바뀐 바이트만 계산
+    TEST_ASSERT_EQUAL(60, recovery.getSaveCount());
+    TEST_ASSERT_LESS_THAN(60 * sizeof(RecoverySlot), store.getByteWrites());
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_counters_alone_journal_on_period);
+    RUN_TEST(test_significant_change_journals_immediately);
+    RUN_TEST(test_restores_latest_after_reboot);
+    RUN_TEST(test_torn_slot_is_ignored);
+    RUN_TEST(test_clear_invalidates_journal);
+    RUN_TEST(test_flash_writes_per_hour);
+    return UNITY_END();
+}
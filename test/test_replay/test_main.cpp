@@ -0,0 +1,273 @@
+// test/test_replay/test_main.cpp
+// 센서 재생 하네스: 합성 비행 궤적(기압 + 가속도 + NMEA)을 가짜 장치(BMP390 레지스터, SH2 허브, GPS UART)에 넣고
+// 비행 소프트웨어 전체(Flight.cpp의 부팅/태스크/패킷/모드/기록)를 시뮬레이션 시계로 구동 (실시간보다 빠르게)
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "Flight.h"
+
+// ---- 합성 비행 (1 ms 적분) ----
+
+#define MISSION_MS          90000
+#define PAD_MS              5000
+#define BOOST_MS            2500
+#define BOOST_ACCEL         40.0f     // m/s²
+#define CHUTE_VELOCITY      -15.0f    // m/s
+#define PROBE_VELOCITY      -5.0f     // m/s (분리 후)
+#define RELEASE_ALTITUDE    100.0f    // m
+#define GROUND_PA           101325.0f
+#define GPS_TRACE_MS        1000
+#define REPLAY_END_US       ((MISSION_MS + 100) * 1000UL)   // 마지막 NMEA 줄까지 처리
+
+static float profileAltitude[MISSION_MS + 1];
+static float profileAccel[MISSION_MS + 1];
+static uint32_t apogeeMs;
+static uint32_t landedMs;
+
+struct NmeaLine {
+    uint32_t ms;
+    char text[96];
+};
+static NmeaLine nmeaTrace[MISSION_MS / GPS_TRACE_MS + 1];
+static size_t nmeaCount;
+
+static float pressureAt(float altitude) {
+    return GROUND_PA * powf(1.0f - altitude / 44330.0f, 5.255f);
+}
+
+static void buildProfile() {
+    float h = 0.0f, v = 0.0f;
+    apogeeMs = 0;
+    landedMs = 0;
+
+    for (uint32_t ms = 0; ms <= MISSION_MS; ms++) {
+        float a = 0.0f;
+        if (ms >= PAD_MS && ms < PAD_MS + BOOST_MS) {
+            a = BOOST_ACCEL;
+        } else if (ms >= PAD_MS && landedMs == 0) {
+            if (apogeeMs == 0) {
+                a = -GRAVITY;
+                if (v <= 0.0f) apogeeMs = ms;
+            } else {
+                // 낙하산: 목표 속도로 수렴
+                float target = h > RELEASE_ALTITUDE ? CHUTE_VELOCITY : PROBE_VELOCITY;
+                a = (target - v) * 2.0f;
+                if (a > 20.0f) a = 20.0f;
+                if (a < -GRAVITY) a = -GRAVITY;
+                // 착지 충격 (약 0.1 s 감속)
+                if (h <= 0.25f) a = 50.0f;
+            }
+        }
+
+        v += a * 0.001f;
+        h += v * 0.001f;
+        if (apogeeMs != 0 && landedMs == 0 && v >= 0.0f) landedMs = ms;
+        if (landedMs != 0) { v = 0.0f; a = 0.0f; }
+
+        profileAltitude[ms] = h;
+        profileAccel[ms] = a;
+    }
+}
+
+// 결정적 잡음 (±amplitude)
+static float noise(uint32_t n, float amplitude) {
+    uint32_t x = n * 2654435761u;
+    x ^= x >> 13;
+    return ((x & 0xFFFF) / 32768.0f - 1.0f) * amplitude;
+}
+
+static void buildTraces() {
+    nmeaCount = 0;
+    for (uint32_t ms = 0; ms <= MISSION_MS; ms += GPS_TRACE_MS) {
+        char body[80];
+        uint32_t s = ms / 1000;
+        snprintf(body, sizeof(body), "GPGGA,12%02u%02u.00,3724.0000,N,12655.0000,E,1,08,0.9,%.1f,M,0.0,M,,",
+                 (unsigned)(s / 60), (unsigned)(s % 60), profileAltitude[ms] + 35.0f);
+        uint8_t sum = 0;
+        for (const char* c = body; *c; c++) sum ^= (uint8_t)*c;
+
+        NmeaLine& line = nmeaTrace[nmeaCount++];
+        line.ms = ms;
+        snprintf(line.text, sizeof(line.text), "$%s*%02X\r\n", body, sum);
+    }
+}
+
+// ---- 하네스 ----
+
+static size_t nextNmea;
+static uint32_t stateEnteredMs[FLIGHT_STATE_COUNT];
+static uint32_t imuPackets;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// 현재 시각의 환경을 가짜 장치에 반영 (기압/가속도/NMEA 도착, 무선 송신 속도)
+static void updateWorld(uint32_t stepUs) {
+    uint32_t ms = halMillis();
+    if (ms > MISSION_MS) ms = MISSION_MS;
+
+    baroBus.setEnvironment(pressureAt(profileAltitude[ms] + noise(ms, 0.3f)), 25.0);
+
+    // 센서 좌표계 = 월드 좌표계 (자세 고정), 가속도계는 중력 반력 포함
+    Vec3 accel = { 0.0f, 0.0f, GRAVITY + profileAccel[ms] + noise(ms + 7, 0.2f) };
+    Vec3 rate = { 0.0f, 0.0f, 0.0f };
+    Quat level = { 1.0f, 0.0f, 0.0f, 0.0f };
+    imuDevice.setMotion(accel, rate, level);
+
+    while (nextNmea < nmeaCount && nmeaTrace[nextNmea].ms <= ms) {
+        const char* text = nmeaTrace[nextNmea].text;
+        gpsPort.inject((const uint8_t*)text, strlen(text));
+        nextNmea++;
+    }
+
+    // XBee 115200 baud = 11.52 B/ms
+    radioPort.refill(stepUs * 1152 / 100000 + 1);
+}
+
+static void startMission() {
+    halSetMicros(0);
+    Serial.setEnabled(false);
+    flightReset();
+
+    nextNmea = 0;
+    imuPackets = 0;
+    memset(stateEnteredMs, 0, sizeof(stateEnteredMs));
+
+    updateWorld(0);
+    flightSetup();
+}
+
+// 다음 예정 시각(태스크, IMU 인터럽트)까지 시계를 건너뛰며 루프 한 번씩 실행
+static void runUntil(uint32_t endUs) {
+    uint32_t step = 0;
+    while (halMicros() < endUs) {
+        updateWorld(step);
+        imuDevice.tick();
+
+        FlightState before = flightState.getState();
+        flightLoop();
+        if (flightState.getState() != before) stateEnteredMs[flightState.getState()] = halMillis();
+
+        uint32_t next = endUs;
+        uint32_t when;
+        if (imuDevice.nextInterruptAt(when) && (int32_t)(when - next) < 0) next = when;
+        for (uint8_t i = 0; i < scheduler.getTaskCount(); i++) {
+            if (scheduler.getPeriod(i) == 0) continue;
+            uint32_t due = scheduler.getNextRun(i);
+            if ((int32_t)(due - next) < 0) next = due;
+        }
+        // 연속 태스크(GPS)와 부팅 단계는 최소 1 ms 간격으로 (UART 도착 간격보다 촘촘함)
+        int32_t ahead = (int32_t)(next - halMicros());
+        step = ahead <= 0 ? 1 : (ahead > 1000 ? 1000 : (uint32_t)ahead);
+        halAdvanceMicros(step);
+    }
+}
+
+static uint8_t taskNamed(const char* name) {
+    return taskIndex(TASKS, TASK_COUNT, name);
+}
+
+void test_full_mission_replay(void) {
+    startMission();
+
+    auto start = std::chrono::steady_clock::now();
+    runUntil(REPLAY_END_US);
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // 부팅: 다섯 장치 모두 준비
+    TEST_ASSERT_TRUE(boot.isDone());
+    TEST_ASSERT_EQUAL(boot.getStepCount(), boot.getReadyCount());
+
+    // 모든 상태를 순서대로 거쳐 착지
+    TEST_ASSERT_EQUAL(STATE_LANDED, flightState.getState());
+    for (uint8_t s = STATE_ASCENT; s < FLIGHT_STATE_COUNT; s++) {
+        TEST_ASSERT_GREATER_THAN(stateEnteredMs[s - 1], stateEnteredMs[s]);
+    }
+
+    // 감지 지연 (궤적 기준)
+    TEST_ASSERT_LESS_THAN(PAD_MS + 1500, stateEnteredMs[STATE_ASCENT]);
+    TEST_ASSERT_LESS_THAN(apogeeMs + 1500, stateEnteredMs[STATE_APOGEE]);
+    TEST_ASSERT_LESS_THAN(landedMs + 5000, stateEnteredMs[STATE_LANDED]);
+
+    // 최고 고도는 궤적과 몇 m 이내
+    float peak = profileAltitude[apogeeMs];
+    TEST_ASSERT_FLOAT_WITHIN(5.0f, peak, flightState.getMaxAltitude());
+
+    // IMU: 허브가 낸 회전 벡터는 모두 샘플로 발행, 손실 없음
+    TEST_ASSERT_EQUAL(0, imu.getDroppedEvents());
+    TEST_ASSERT_EQUAL(imuDevice.getReports(BNO085_REPORT_ROTATION), imu.getSequence());
+    TEST_ASSERT_EQUAL(Mode::profileFor(STATE_LANDED).imuIntervalUs, imuDevice.getReportInterval(BNO085_REPORT_ROTATION));
+
+    // Mode: 단계 전환마다 BMP ODR/IMU 주기 적용 (ASCENT -> APOGEE는 같은 프로파일이라 건너뜀)
+    TEST_ASSERT_EQUAL(4, rates.getChangeCount());
+    TEST_ASSERT_TRUE(rates.isApplied());
+    TEST_ASSERT_EQUAL(Mode::profileFor(STATE_LANDED).baroOdr, baroBus.getRegister(BMP390_REG_ODR));
+    TEST_ASSERT_EQUAL(Mode::profileFor(STATE_LANDED).baroPollUs(), scheduler.getPeriod(TASK_BMP));
+
+    // GPS 문장 손실 없음 (루프백으로 돌아온 PMTK 명령은 위치 문장이 아님)
+    TEST_ASSERT_EQUAL(nmeaCount, gps.getParser().getParsedCount());
+    TEST_ASSERT_EQUAL(0, gps.getParser().getChecksumErrors());
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 35.0f, gps.getAltitude());
+
+    // 텔레메트리 1 Hz, 기록 손실 없음
+    TEST_ASSERT_UINT32_WITHIN(1, MISSION_MS / 1000, telemetry.getPacketCount());
+    TEST_ASSERT_EQUAL(0, logger.getRecordsDropped());
+    TEST_ASSERT_FALSE(logger.isActive());                  // 착지 후 닫힘
+    TEST_ASSERT_EQUAL(logger.getBytesWritten(), sdCard.getLength());
+    TEST_ASSERT_GREATER_THAN(0, frameRecorder.getFramesWritten());
+
+    // 스케줄러: IMU 태스크는 시뮬레이션 시간 기준으로 빠짐없이 실행
+    uint8_t imuTaskIndex = taskNamed("IMU");
+    TEST_ASSERT_EQUAL(0, scheduler.getStats(imuTaskIndex).skipped);
+
+    TEST_ASSERT_LESS_THAN(10000.0, wallMs);
+
+    char line[160];
+    snprintf(line, sizeof(line), "mission %u s replayed in %.1f ms (%.0fx), loop %.0f passes/s (sim)",
+             MISSION_MS / 1000, wallMs, MISSION_MS / wallMs, scheduler.getLoopRate());
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "apogee %.1f m at %u ms (detected %u ms), landed %u ms (detected %u ms)",
+             peak, (unsigned)apogeeMs, (unsigned)stateEnteredMs[STATE_APOGEE],
+             (unsigned)landedMs, (unsigned)stateEnteredMs[STATE_LANDED]);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "imu %u samples, baro %u bus transactions, log %llu B, frames %u, cpu %.1f%% (sim)",
+             (unsigned)imu.getSequence(), (unsigned)baroBus.getTransactions(),
+             (unsigned long long)sdCard.getLength(), (unsigned)frameRecorder.getFramesWritten(),
+             scheduler.getCpuLoad() * 100.0f);
+    TEST_MESSAGE(line);
+    for (uint8_t i = 0; i < TASK_COUNT; i++) {
+        const TaskStats& stats = scheduler.getStats(i);
+        snprintf(line, sizeof(line), "%-9s runs %7u  max %5u us  skipped %u", TASKS[i].name, (unsigned)stats.runs,
+                 (unsigned)stats.maxExecUs, (unsigned)stats.skipped);
+        TEST_MESSAGE(line);
+    }
+}
+
+void test_replay_is_deterministic(void) {
+    // 같은 궤적은 같은 결과 (회귀 비교 기준)
+    startMission();
+    runUntil(REPLAY_END_US);
+    uint32_t first[FLIGHT_STATE_COUNT];
+    memcpy(first, stateEnteredMs, sizeof(first));
+    float firstPeak = flightState.getMaxAltitude();
+    uint64_t firstLog = sdCard.getLength();
+
+    startMission();
+    runUntil(REPLAY_END_US);
+    TEST_ASSERT_EQUAL_MEMORY(first, stateEnteredMs, sizeof(first));
+    TEST_ASSERT_EQUAL_FLOAT(firstPeak, flightState.getMaxAltitude());
+    TEST_ASSERT_TRUE(firstLog == sdCard.getLength());
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    buildProfile();
+    buildTraces();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_full_mission_replay);
+    RUN_TEST(test_replay_is_deterministic);
+    return UNITY_END();
+}
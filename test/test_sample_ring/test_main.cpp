@@ -0,0 +1,230 @@
+// test/test_sample_ring/test_main.cpp
+#include <unity.h>
+#include <stdint.h>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include "SampleRing.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_latest_and_at(void) {
+    SampleRing<int, 8> ring;
+    Sample<int> out;
+    TEST_ASSERT_FALSE(ring.latest(out));
+    TEST_ASSERT_FALSE(ring.at(1000, out));
+
+    for (int i = 1; i <= 5; i++) ring.push(i, i * 1000);
+    TEST_ASSERT_TRUE(ring.latest(out));
+    TEST_ASSERT_EQUAL(5, out.value);
+    TEST_ASSERT_EQUAL(5000, out.timestamp);
+
+    // 시점 이전(포함) 가장 최근
+    TEST_ASSERT_TRUE(ring.at(3000, out));
+    TEST_ASSERT_EQUAL(3, out.value);
+    TEST_ASSERT_TRUE(ring.at(3999, out));
+    TEST_ASSERT_EQUAL(3, out.value);
+    TEST_ASSERT_FALSE(ring.at(999, out));
+    TEST_ASSERT_EQUAL(5, ring.getSequence());
+}
+
+void test_overwrites_oldest(void) {
+    SampleRing<int, 4> ring;
+    for (int i = 1; i <= 10; i++) ring.push(i, i * 10);
+    TEST_ASSERT_EQUAL(4, ring.size());
+    TEST_ASSERT_EQUAL(10, ring.getSequence());
+
+    // 덮어쓰는 중일 수 있는 슬롯 하나는 제외하므로 보이는 가장 오래된 샘플은 8
+    Sample<int> out;
+    TEST_ASSERT_TRUE(ring.at(80, out));
+    TEST_ASSERT_EQUAL(8, out.value);
+    TEST_ASSERT_FALSE(ring.at(70, out));
+}
+
+void test_range_in_order_and_bounded(void) {
+    SampleRing<int, 16> ring;
+    for (int i = 0; i < 10; i++) ring.push(i, 100 + i * 10);
+
+    Sample<int> out[16];
+    size_t count = ring.range(120, 160, out, 16);
+    TEST_ASSERT_EQUAL(5, count);
+    for (size_t i = 0; i < count; i++) TEST_ASSERT_EQUAL(2 + (int)i, out[i].value);
+
+    // 최대 개수 제한 (오래된 순서부터)
+    TEST_ASSERT_EQUAL(2, ring.range(0, 1000, out, 2));
+    TEST_ASSERT_EQUAL(0, out[0].value);
+    TEST_ASSERT_EQUAL(0, ring.range(500, 600, out, 16));
+}
+
+void test_timestamps_across_micros_wrap(void) {
+    SampleRing<int, 8> ring;
+    uint32_t t = 0xFFFFFFFF - 25;
+    for (int i = 0; i < 6; i++, t += 10) ring.push(i, t);   // 3번째부터 0을 넘어감
+
+    Sample<int> out;
+    TEST_ASSERT_TRUE(ring.at(5, out));                      // 0xFFFFFFFF - 25 + 30 = 4
+    TEST_ASSERT_EQUAL(3, out.value);
+
+    Sample<int> batch[8];
+    TEST_ASSERT_EQUAL(3, ring.range(0xFFFFFFFF - 10, 20, batch, 8));
+    TEST_ASSERT_EQUAL(2, batch[0].value);
+}
+
+struct Triple {
+    uint32_t a, b, c;            // 항상 같은 값 (찢어진 읽기 검출)
+};
+
+void test_reader_never_sees_torn_sample(void) {
+    static SampleRing<Triple, 4> ring;
+    std::atomic<bool> done(false);
+    const uint32_t count = 200000;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 1; i <= count; i++) {
+            Triple value = { i, i, i };
+            ring.push(value, i);
+            if ((i & 63) == 0) std::this_thread::yield();
+        }
+        done = true;
+    });
+
+    uint32_t torn = 0, reads = 0, last = 0;
+    bool monotonic = true;
+    while (!done) {
+        Sample<Triple> out;
+        if (!ring.latest(out)) continue;
+        reads++;
+        if (out.value.a != out.value.b || out.value.b != out.value.c || out.timestamp != out.value.a) torn++;
+        if (out.value.a < last) monotonic = false;
+        last = out.value.a;
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL(0, torn);
+    TEST_ASSERT_TRUE(monotonic);
+    TEST_ASSERT_GREATER_THAN(0, reads);
+}
+
+// IMU 샘플 크기 정도 (가속도/자이로/쿼터니언 + 정확도)
+struct Payload {
+    float values[10];
+    uint32_t tag;
+};
+
+static double nsSince(std::chrono::steady_clock::time_point start, uint32_t operations) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / operations;
+}
+
+// 쓰기 처리량과 latest/at/range 읽기 비용: 단독, 그리고 다른 스레드가 계속 쓰는 동안
+// (읽기 시간에는 256회마다 양보하는 비용 포함, 단일 코어면 생산자와 시분할)
+void test_cost_with_concurrent_writer(void) {
+    static SampleRing<Payload, 64> ring;
+    Payload value = {};
+
+    // 단독 push
+    const uint32_t pushes = 2000000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 1; i <= pushes; i++) {
+        value.tag = i;
+        ring.push(value, i);
+    }
+    double pushNs = nsSince(t0, pushes);
+
+    const uint32_t reads = 200000;
+    Sample<Payload> out;
+    Sample<Payload> batch[16];
+    volatile uint32_t sink = 0;
+
+    t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reads; i++) { ring.latest(out); sink = sink + out.value.tag; }
+    double latestIdleNs = nsSince(t0, reads);
+    t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reads; i++) { ring.at(pushes - (i & 31), out); sink = sink + out.value.tag; }
+    double atIdleNs = nsSince(t0, reads);
+    t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reads; i++) sink = sink + (uint32_t)ring.range(pushes - 15, pushes, batch, 16);
+    double rangeIdleNs = nsSince(t0, reads);
+
+    // 동시 쓰기: 생산자는 쉬지 않고 push (64개마다 양보, 단일 코어에서도 번갈아 실행되도록)
+    std::atomic<bool> stop(false);
+    std::atomic<uint32_t> written(0);
+    auto concurrentStart = std::chrono::steady_clock::now();
+    std::thread producer([&]() {
+        Payload v = {};
+        uint32_t i = pushes;
+        while (!stop) {
+            v.tag = ++i;
+            ring.push(v, i);
+            if ((i & 63) == 0) {
+                written = i - pushes;
+                std::this_thread::yield();
+            }
+        }
+        written = i - pushes;
+    });
+
+    uint32_t latestMisses = 0, atMisses = 0, torn = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reads; i++) {
+        if (!ring.latest(out)) latestMisses++;
+        else if (out.value.tag != out.timestamp) torn++;
+        if ((i & 255) == 0) std::this_thread::yield();
+    }
+    double latestBusyNs = nsSince(t0, reads);
+
+    t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reads; i++) {
+        // 몇 샘플 전 시점 (쓰는 동안 덮어쓰일 수 있는 구간)
+        uint32_t target = ring.getSequence() - 8;
+        if (!ring.at(target, out)) atMisses++;
+        else if (out.value.tag != out.timestamp) torn++;
+        if ((i & 255) == 0) std::this_thread::yield();
+    }
+    double atBusyNs = nsSince(t0, reads);
+
+    uint32_t rangeSamples = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reads; i++) {
+        uint32_t newest = ring.getSequence();
+        size_t count = ring.range(newest - 15, newest, batch, 16);
+        for (size_t n = 0; n < count; n++) {
+            if (batch[n].value.tag != batch[n].timestamp) torn++;
+            if (n > 0 && batch[n].timestamp <= batch[n - 1].timestamp) torn++;
+        }
+        rangeSamples += count;
+        if ((i & 255) == 0) std::this_thread::yield();
+    }
+    double rangeBusyNs = nsSince(t0, reads);
+    stop = true;
+    producer.join();
+    double concurrentNs = nsSince(concurrentStart, written.load() > 0 ? written.load() : 1);
+
+    TEST_ASSERT_EQUAL(0, torn);
+    TEST_ASSERT_EQUAL(0, latestMisses);
+    TEST_ASSERT_GREATER_THAN(0, written.load());
+    TEST_ASSERT_GREATER_THAN(0, rangeSamples);
+    (void)sink;
+
+    char line[128];
+    snprintf(line, sizeof(line), "push %.1f ns (%.1f M/s alone), %u pushes = %.2f M/s while readers run",
+             pushNs, 1000.0 / pushNs, (unsigned)written.load(), 1000.0 / concurrentNs);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "latest %.1f / %.1f ns, at %.1f / %.1f ns (%u misses), range(16) %.1f / %.1f ns (idle / writer)",
+             latestIdleNs, latestBusyNs, atIdleNs, atBusyNs, (unsigned)atMisses, rangeIdleNs, rangeBusyNs);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_latest_and_at);
+    RUN_TEST(test_overwrites_oldest);
+    RUN_TEST(test_range_in_order_and_bounded);
+    RUN_TEST(test_timestamps_across_micros_wrap);
+    RUN_TEST(test_reader_never_sees_torn_sample);
+    RUN_TEST(test_cost_with_concurrent_writer);
+    return UNITY_END();
+}
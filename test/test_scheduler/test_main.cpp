@@ -0,0 +1,150 @@
+// test/test_scheduler/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include "Scheduler.h"
+
+// 가짜 시계 (태스크가 실행 시간만큼 직접 진행)
+static uint32_t fakeNow;
+static uint32_t fakeClock() { return fakeNow; }
+
+static uint32_t fastRuns, slowRuns, loopRuns;
+static uint32_t fastCost, slowCost;
+static char trace[16];
+static uint8_t traceLength;
+
+static void fastTask() { fastRuns++; fakeNow += fastCost; if (traceLength < sizeof(trace) - 1) trace[traceLength++] = 'F'; }
+static void slowTask() { slowRuns++; fakeNow += slowCost; if (traceLength < sizeof(trace) - 1) trace[traceLength++] = 'S'; }
+static void loopTask() { loopRuns++; }
+
+static constexpr TaskConfig TASKS[] = {
+    { "SLOW", slowTask, 1000000, 2, 0 },       // 1 Hz
+    { "FAST", fastTask, 5000,    0, 2500 },    // 200 Hz
+    { "LOOP", loopTask, 0,       3, 0 },       // 연속
+};
+static constexpr uint8_t TASK_COUNT = sizeof(TASKS) / sizeof(TASKS[0]);
+static constexpr uint8_t TASK_FAST = taskIndex(TASKS, TASK_COUNT, "FAST");
+static_assert(TASK_FAST == 1, "taskIndex finds FAST");
+static_assert(taskIndex(TASKS, TASK_COUNT, "SLOW") == 0, "taskIndex finds the first entry");
+static_assert(taskIndex(TASKS, TASK_COUNT, "FAS") == TASK_COUNT, "prefix is not a match");
+static_assert(taskIndex(TASKS, TASK_COUNT, "GPS") == TASK_COUNT, "missing name returns count");
+
+void setUp(void) {
+    fakeNow = 0;
+    fastRuns = slowRuns = loopRuns = 0;
+    fastCost = slowCost = 0;
+    traceLength = 0;
+    trace[0] = '\0';
+}
+void tearDown(void) {}
+
+void test_priority_order_one_periodic_per_pass(void) {
+    Scheduler scheduler(fakeClock);
+    scheduler.begin(TASKS, TASK_COUNT, 0);
+
+    // 둘 다 기한 -> 우선순위 높은 FAST 먼저, 패스마다 주기 태스크 하나
+    TEST_ASSERT_TRUE(scheduler.runOnce());
+    TEST_ASSERT_TRUE(scheduler.runOnce());
+    TEST_ASSERT_FALSE(scheduler.runOnce());
+    trace[traceLength] = '\0';
+    TEST_ASSERT_EQUAL_STRING("FS", trace);
+    TEST_ASSERT_EQUAL(3, loopRuns);                      // 연속 태스크는 매 패스
+}
+
+void test_no_drift_over_two_hours(void) {
+    Scheduler scheduler(fakeClock);
+    const uint32_t start = 0xF0000000;                   // 2시간 안에 micros가 한 번 넘어감
+    fakeNow = start;
+    fastCost = 180;
+    slowCost = 2400;
+    scheduler.begin(TASKS, TASK_COUNT, start);
+
+    // 패스 간격 331 us (주기와 나누어떨어지지 않음), 2시간 + 10 ms
+    const uint64_t duration = 2ULL * 3600 * 1000000 + 10000;
+    uint64_t elapsed = 0;
+    while (elapsed < duration) {
+        uint32_t before = fakeNow;
+        scheduler.runOnce();
+        fakeNow += 331;
+        elapsed += (uint32_t)(fakeNow - before);
+    }
+
+    // 실행 횟수는 예정 시각 개수와 정확히 같음 (누적 오차 없음)
+    const TaskStats& fast = scheduler.getStats(TASK_FAST);
+    const TaskStats& slow = scheduler.getStats(0);
+    TEST_ASSERT_UINT32_WITHIN(1, (uint32_t)(elapsed / 5000) + 1, fast.runs);
+    TEST_ASSERT_EQUAL(7201, slow.runs);
+    TEST_ASSERT_EQUAL(0, fast.skipped);
+    TEST_ASSERT_EQUAL(0, slow.skipped);
+
+    // 위상 유지: 다음 예정 시각 = 시작 시각 + 실행 횟수 x 주기 (micros 넘김 포함)
+    TEST_ASSERT_EQUAL_HEX32(start + fast.runs * 5000u, scheduler.getNextRun(TASK_FAST));
+    TEST_ASSERT_EQUAL_HEX32(start + slow.runs * 1000000u, scheduler.getNextRun(0));
+    TEST_ASSERT_LESS_THAN(331 + 2400 + 180, fast.maxJitterUs + 1);
+
+    char line[96];
+    snprintf(line, sizeof(line), "2 h: FAST %u runs, max jitter %u us, SLOW %u runs",
+             (unsigned)fast.runs, (unsigned)fast.maxJitterUs, (unsigned)slow.runs);
+    TEST_MESSAGE(line);
+}
+
+void test_overrun_skips_missed_periods_keeping_phase(void) {
+    Scheduler scheduler(fakeClock);
+    scheduler.begin(TASKS, TASK_COUNT, 0);
+
+    // FAST가 한 번 12.5 ms 걸림 -> 마감 초과, 놓친 주기 건너뜀
+    fastCost = 12500;
+    scheduler.runOnce();
+    fastCost = 100;
+    const TaskStats& fast = scheduler.getStats(TASK_FAST);
+    TEST_ASSERT_EQUAL(1, fast.overruns);
+    TEST_ASSERT_EQUAL(1, fast.skipped);
+    TEST_ASSERT_EQUAL(10000, scheduler.getNextRun(TASK_FAST));
+
+    fakeNow = 10000;
+    scheduler.runOnce();
+    TEST_ASSERT_EQUAL(15000, scheduler.getNextRun(TASK_FAST));
+    TEST_ASSERT_EQUAL(1, fast.overruns);
+}
+
+void test_set_period(void) {
+    Scheduler scheduler(fakeClock);
+    scheduler.begin(TASKS, TASK_COUNT, 0);
+    TEST_ASSERT_FALSE(scheduler.setPeriod(2, 1000));    // 연속 태스크
+    TEST_ASSERT_FALSE(scheduler.setPeriod(TASK_FAST, 0));
+    TEST_ASSERT_FALSE(scheduler.setPeriod(TASK_COUNT, 1000));
+
+    scheduler.runOnce();                                  // FAST, 다음 5000
+    TEST_ASSERT_TRUE(scheduler.setPeriod(TASK_FAST, 20000));
+    TEST_ASSERT_EQUAL(20000, scheduler.getPeriod(TASK_FAST));
+
+    // 이미 잡힌 예정 시각 다음부터 새 주기
+    fakeNow = 5000;
+    scheduler.runOnce();                                  // SLOW (t=0 기한)
+    scheduler.runOnce();                                  // FAST
+    TEST_ASSERT_EQUAL(25000, scheduler.getNextRun(TASK_FAST));
+}
+
+void test_load_and_loop_rate(void) {
+    Scheduler scheduler(fakeClock);
+    scheduler.begin(TASKS, TASK_COUNT, 0);
+    fastCost = 500;                                       // 200 Hz x 0.5 ms = 10 %
+
+    while (fakeNow < 1000000) {
+        scheduler.runOnce();
+        fakeNow += 100;
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.10f, scheduler.getCpuLoad());
+    TEST_ASSERT_FLOAT_WITHIN(500.0f, (float)scheduler.getPassCount(), scheduler.getLoopRate());
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_priority_order_one_periodic_per_pass);
+    RUN_TEST(test_no_drift_over_two_hours);
+    RUN_TEST(test_overrun_skips_missed_periods_keeping_phase);
+    RUN_TEST(test_set_period);
+    RUN_TEST(test_load_and_loop_rate);
+    return UNITY_END();
+}
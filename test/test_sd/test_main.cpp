@@ -0,0 +1,310 @@
+// test/test_sd/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <new>
+#include "HAL.h"
+#include "SD.h"
+
+// 메모리 백엔드 (기존 파일 목록, busy/sync 흉내)
+class MemoryBackend : public LogBackend {
+public:
+    const char* existing[4];
+    uint8_t existingCount;
+    char opened[LOG_PATH_MAX];
+    uint8_t data[64 * 1024];
+    size_t length;
+    uint32_t syncs;
+    uint32_t writes;
+    bool busy;
+    bool closed;
+
+    MemoryBackend() : existingCount(0), length(0), syncs(0), writes(0), busy(false), closed(false) { opened[0] = '\0'; }
+
+    bool open(const char* path, uint32_t preallocate) override {
+        (void)preallocate;
+        if (exists(path)) return false;
+        strncpy(opened, path, sizeof(opened) - 1);
+        opened[sizeof(opened) - 1] = '\0';
+        return true;
+    }
+    bool exists(const char* path) override {
+        for (uint8_t i = 0; i < existingCount; i++) {
+            if (strcmp(existing[i], path) == 0) return true;
+        }
+        return false;
+    }
+    size_t write(const uint8_t* bytes, size_t count) override {
+        memcpy(data + length, bytes, count);
+        length += count;
+        writes++;
+        return count;
+    }
+    bool sync() override { syncs++; return true; }
+    void close() override { closed = true; }
+    bool isBusy() override { return busy; }
+};
+
+static const LogImuRecord IMU_RECORD = { 0.1f, 0.2f, 9.8f, 0.0f, 0.0f, 0.0f, 1.0f };
+
+void setUp(void) {
+    halSetMicros(0);
+}
+void tearDown(void) {}
+
+void test_picks_next_free_number(void) {
+    MemoryBackend card;
+    card.existing[0] = "flight000.bin";
+    card.existing[1] = "flight001.bin";
+    card.existingCount = 2;
+
+    SDLogger logger;
+    TEST_ASSERT_TRUE(logger.begin(&card, "flight", ".bin"));
+    TEST_ASSERT_EQUAL_STRING("flight002.bin", logger.getPath());
+    TEST_ASSERT_EQUAL_STRING("flight002.bin", card.opened);
+}
+
+void test_file_backend_never_truncates(void) {
+    const char* first = "sdtest000.bin";
+    remove(first);
+    remove("sdtest001.bin");
+
+    // 이전 비행 기록
+    FILE* old = fopen(first, "wb");
+    TEST_ASSERT_NOT_NULL(old);
+    fputs("previous flight", old);
+    fclose(old);
+
+    // 같은 이름으로는 열리지 않음
+    FileLogBackend direct;
+    TEST_ASSERT_FALSE(direct.open(first, 0));
+
+    FileLogBackend backend;
+    SDLogger logger;
+    TEST_ASSERT_TRUE(logger.begin(&backend, "sdtest", ".bin"));
+    TEST_ASSERT_EQUAL_STRING("sdtest001.bin", logger.getPath());
+    logger.logImu(1000, IMU_RECORD);
+    logger.end();
+
+    char text[32] = { 0 };
+    old = fopen(first, "rb");
+    fread(text, 1, sizeof(text) - 1, old);
+    fclose(old);
+    TEST_ASSERT_EQUAL_STRING("previous flight", text);
+
+    remove(first);
+    remove("sdtest001.bin");
+}
+
+void test_busy_card_defers_writes(void) {
+    MemoryBackend card;
+    SDLogger logger;
+    logger.begin(&card, "flight", ".bin");
+
+    // 버퍼 하나를 채움 (헤더 6 + 28 바이트)
+    while (logger.getRecordsWritten() * 34 < LOG_BUFFER_SIZE) logger.logImu(0, IMU_RECORD);
+
+    card.busy = true;
+    for (int i = 0; i < 10; i++) logger.service();
+    TEST_ASSERT_EQUAL(0, card.writes);
+    TEST_ASSERT_EQUAL(10, logger.getBusySkips());
+
+    card.busy = false;
+    for (int i = 0; i < 10; i++) logger.service();
+    TEST_ASSERT_EQUAL(LOG_BUFFER_SIZE / LOG_WRITE_CHUNK, card.writes);
+    TEST_ASSERT_EQUAL(1, logger.getBuffersFlushed());
+}
+
+void test_syncs_on_time_as_well_as_bytes(void) {
+    MemoryBackend card;
+    SDLogger logger;
+    logger.begin(&card, "flight", ".bin");
+
+    while (logger.getRecordsWritten() * 34 < LOG_BUFFER_SIZE) logger.logImu(0, IMU_RECORD);
+    for (int i = 0; i < 4; i++) logger.service();
+    TEST_ASSERT_EQUAL(1, logger.getBuffersFlushed());
+    TEST_ASSERT_EQUAL(0, card.syncs);                     // 버퍼 8개 전
+
+    // 1초가 지나면 기록할 버퍼가 없는 주기에 sync, 새로 쓴 게 없으면 다시 하지 않음
+    halAdvanceMicros(LOG_SYNC_PERIOD_US - 1);
+    logger.service();
+    TEST_ASSERT_EQUAL(0, card.syncs);
+    halAdvanceMicros(1);
+    logger.service();
+    TEST_ASSERT_EQUAL(1, card.syncs);
+    halAdvanceMicros(5 * LOG_SYNC_PERIOD_US);
+    logger.service();
+    TEST_ASSERT_EQUAL(1, card.syncs);
+}
+
+void test_end_flushes_and_decodes(void) {
+    MemoryBackend card;
+    SDLogger logger;
+    logger.begin(&card, "flight", ".bin");
+
+    LogBaroRecord baro = { 1013.25f, 21.5f, 12.3f };
+    logger.logImu(100, IMU_RECORD);
+    logger.logBaro(200, baro);
+    logger.logGps(300, "$GNGGA,123456.00,,,,,0,00,,,M,,M,,*00\r\n");
+    logger.end();
+    TEST_ASSERT_TRUE(card.closed);
+    TEST_ASSERT_FALSE(logger.isActive());
+    TEST_ASSERT_FALSE(logger.logImu(400, IMU_RECORD));
+
+    char line[160];
+    size_t offset = 0;
+    size_t used = decodeLogRecord(card.data + offset, card.length - offset, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("IMU,100,0.100,0.200,9.800,0.00000,0.00000,0.00000,1.00000", line);
+    offset += used;
+    used = decodeLogRecord(card.data + offset, card.length - offset, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("BARO,200,1013.25,21.50,12.30", line);
+    offset += used;
+    used = decodeLogRecord(card.data + offset, card.length - offset, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("GPS,300,$GNGGA,123456.00,,,,,0,00,,,M,,M,,*00", line);
+    offset += used;
+    TEST_ASSERT_EQUAL(card.length, offset);
+}
+
+// ---- 무작위로 멈추는 카드 ----
+
+// 카드 흉내: 쓰기는 대역폭만큼 시계를 진행, 가끔 내부 기록(웨어 레벨링/소거)으로 수~수십 ms 바쁨
+// 바쁜 동안 쓰면 끝날 때까지 블로킹 (reportBusy가 false면 바쁨을 알리지 않는 카드/드라이버)
+class StallingCard : public LogBackend {
+public:
+    uint32_t bytesPerSecond;
+    uint32_t stallEvery;         // 평균 쓰기 N번에 한 번 멈춤
+    uint32_t stallMinUs;
+    uint32_t stallMaxUs;
+    bool reportBusy;
+
+    uint32_t busyUntil;
+    uint32_t rng;
+    uint64_t length;
+    uint32_t stalls;
+    uint32_t longestStallUs;
+
+    StallingCard(bool busyFlag)
+        : bytesPerSecond(20000000), stallEvery(8), stallMinUs(2000), stallMaxUs(100000), reportBusy(busyFlag),
+          busyUntil(0), rng(2463534242u), length(0), stalls(0), longestStallUs(0) {}
+
+    uint32_t next() {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        return rng;
+    }
+    bool busyNow() { return (int32_t)(busyUntil - halMicros()) > 0; }
+    void waitIdle() { if (busyNow()) halAdvanceMicros(busyUntil - halMicros()); }
+
+    bool open(const char* path, uint32_t preallocate) override { (void)path; (void)preallocate; return true; }
+    bool exists(const char* path) override { (void)path; return false; }
+    size_t write(const uint8_t* bytes, size_t count) override {
+        (void)bytes;
+        waitIdle();
+        halAdvanceMicros((uint32_t)((uint64_t)count * 1000000 / bytesPerSecond));
+        length += count;
+        if (next() % stallEvery == 0) {
+            uint32_t stall = stallMinUs + next() % (stallMaxUs - stallMinUs);
+            busyUntil = halMicros() + stall;
+            stalls++;
+            if (stall > longestStallUs) longestStallUs = stall;
+        }
+        return count;
+    }
+    bool sync() override { waitIdle(); halAdvanceMicros(500); return true; }
+    void close() override {}
+    bool isBusy() override { return reportBusy && busyNow(); }
+};
+
+struct SdBenchResult {
+    double megabytesPerSecond;
+    uint32_t worstServiceUs;     // service() 한 번이 태스크를 잡은 최대 시간
+    uint32_t dropped;
+};
+
+// LOG 태스크 주기(2 ms)로 service, 그 사이 비행 속도(IMU 400 Hz + BMP 100 Hz + GPS 10 Hz)로 기록
+// saturate면 매 주기 버퍼가 찰 때까지 기록 (카드가 받아낼 수 있는 최대 처리량)
+static SdBenchResult runStallingCard(StallingCard& card, bool saturate, uint32_t durationUs) {
+    static SDLogger logger;
+    new (&logger) SDLogger();
+    TEST_ASSERT_TRUE(logger.begin(&card, "stall", ".bin"));
+
+    LogBaroRecord baro = { 1013.25f, 21.5f, 0.0f };
+    const char* nmea = "$GNGGA,123456.00,3723.46587,N,12202.26957,W,1,12,0.8,45.2,M,-25.6,M,,*4F\r\n";
+    SdBenchResult result = { 0.0, 0, 0 };
+    uint32_t start = halMicros();
+    uint32_t nextService = start;
+    uint32_t imuDue = start, baroDue = start, gpsDue = start;
+
+    while (halMicros() - start < durationUs) {
+        uint32_t now = halMicros();
+        if (saturate) {
+            while (logger.logImu(now, IMU_RECORD)) {}
+        } else {
+            for (; (int32_t)(now - imuDue) >= 0; imuDue += 2500) logger.logImu(imuDue, IMU_RECORD);
+            for (; (int32_t)(now - baroDue) >= 0; baroDue += 10000) logger.logBaro(baroDue, baro);
+            for (; (int32_t)(now - gpsDue) >= 0; gpsDue += 100000) logger.logGps(gpsDue, nmea);
+        }
+
+        if ((int32_t)(now - nextService) >= 0) {
+            uint32_t before = halMicros();
+            logger.service();
+            uint32_t spent = halMicros() - before;
+            if (spent > result.worstServiceUs) result.worstServiceUs = spent;
+            nextService += 2000;
+            // 블로킹으로 밀린 주기는 건너뜀 (스케줄러와 같이)
+            if ((int32_t)(halMicros() - nextService) > 0) nextService = halMicros();
+        }
+        halAdvanceMicros(100);
+    }
+
+    uint32_t elapsed = halMicros() - start;
+    result.megabytesPerSecond = (double)logger.getBytesWritten() / elapsed;
+    result.dropped = logger.getRecordsDropped();
+    return result;
+}
+
+void test_stalling_card_throughput_and_latency(void) {
+    // 비행 속도: 바쁨을 확인하면 멈춤 동안에도 태스크는 청크 한 번(약 100 us)이나 sync 한 번 이상 잡히지 않음
+    StallingCard polite(true);
+    SdBenchResult flight = runStallingCard(polite, false, 10000000);
+    TEST_ASSERT_GREATER_THAN(0, polite.stalls);
+    TEST_ASSERT_EQUAL(0, flight.dropped);
+    TEST_ASSERT_LESS_OR_EQUAL(1000, flight.worstServiceUs);
+
+    // 같은 카드인데 바쁨을 모르고 쓰면 멈춤 전체가 LOG 태스크 블로킹으로
+    StallingCard blind(false);
+    SdBenchResult blocking = runStallingCard(blind, false, 10000000);
+    TEST_ASSERT_GREATER_THAN(flight.worstServiceUs * 10, blocking.worstServiceUs);
+
+    // 최대 처리량 (버퍼를 계속 채움)
+    StallingCard saturated(true);
+    SdBenchResult sustained = runStallingCard(saturated, true, 10000000);
+    TEST_ASSERT_TRUE(sustained.megabytesPerSecond > flight.megabytesPerSecond);
+    TEST_ASSERT_LESS_OR_EQUAL(1000, sustained.worstServiceUs);
+
+    char line[160];
+    snprintf(line, sizeof(line), "flight rate: %.3f MB/s, 0 dropped, worst service %u us over %u stalls (longest %u us)",
+             flight.megabytesPerSecond, (unsigned)flight.worstServiceUs, (unsigned)polite.stalls,
+             (unsigned)polite.longestStallUs);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "busy ignored: worst service %u us", (unsigned)blocking.worstServiceUs);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "saturated: sustained %.3f MB/s (card %.1f MB/s), worst service %u us, %u records dropped",
+             sustained.megabytesPerSecond, saturated.bytesPerSecond / 1e6, (unsigned)sustained.worstServiceUs,
+             (unsigned)sustained.dropped);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_picks_next_free_number);
+    RUN_TEST(test_file_backend_never_truncates);
+    RUN_TEST(test_busy_card_defers_writes);
+    RUN_TEST(test_syncs_on_time_as_well_as_bytes);
+    RUN_TEST(test_end_flushes_and_decodes);
+    RUN_TEST(test_stalling_card_throughput_and_latency);
+    return UNITY_END();
+}
@@ -0,0 +1,178 @@
+// test/test_simulation/test_main.cpp
+// 시뮬레이션 모드: SIM/SIMP 명령을 콘솔로 넣어 CommandParser -> InjectedPressureSource -> BMP390 샘플 링까지
+// 각 값이 BMP 태스크 한 주기 안에 링에 나타나는지 (비행 소프트웨어 전체를 시뮬레이션 시계로 구동)
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "Flight.h"
+
+#define STEP_US 100
+
+static void step() {
+    flightLoop();
+    halAdvanceMicros(STEP_US);
+    imuDevice.tick();
+}
+
+// 부팅 끝까지 진행 후 SIM ENABLE/ACTIVATE
+static void startSimulation() {
+    halSetMicros(0);
+    Serial.setEnabled(false);
+    flightReset();
+    flightSetup();
+    while (!boot.isDone() && halMicros() < 5000000) step();
+    TEST_ASSERT_TRUE(boot.isDone());
+
+    Serial.inject("CMD," TEAM_ID ",SIM,ENABLE\n");
+    Serial.inject("CMD," TEAM_ID ",SIM,ACTIVATE\n");
+    for (uint32_t us = 0; us < 10000; us += STEP_US) step();
+    TEST_ASSERT_EQUAL('S', telemetry.getMode());
+}
+
+static void sendSimp(uint32_t pascals) {
+    char line[48];
+    snprintf(line, sizeof(line), "CMD,%s,SIMP,%u\n", TEAM_ID, (unsigned)pascals);
+    Serial.inject(line);
+}
+
+// 주입한 값이 링에 나타난 시각 (순서대로 하나씩 대조)
+struct Delivery {
+    uint32_t sentAt;       // 콘솔에 넣은 시각
+    uint32_t receivedAt;   // 명령 실행 시각 (샘플 타임스탬프)
+    uint32_t arrivedAt;    // 링에서 처음 보인 시각
+};
+
+static uint32_t lastSequence;
+static uint32_t lastTimestamp;
+static uint32_t delivered;
+
+// 새 샘플을 모두 꺼내 expected[delivered..]와 값 비교
+static void collect(const uint32_t* expected, Delivery* deliveries, uint32_t sent) {
+    uint32_t sequence = bmp.getSamples().getSequence();
+    if (sequence == lastSequence) return;
+
+    Sample<BaroSample> batch[PRESSURE_INJECT_RING_SIZE];
+    size_t count = bmp.getSamples().range(lastTimestamp + 1, halMicros(), batch, PRESSURE_INJECT_RING_SIZE);
+    TEST_ASSERT_EQUAL(sequence - lastSequence, count);
+    for (size_t i = 0; i < count; i++) {
+        TEST_ASSERT_LESS_THAN(sent, delivered);
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, expected[delivered] / 100.0f, batch[i].value.pressure);
+        deliveries[delivered].receivedAt = batch[i].timestamp;
+        deliveries[delivered].arrivedAt = halMicros();
+        lastTimestamp = batch[i].timestamp;
+        delivered++;
+    }
+    lastSequence = sequence;
+}
+
+// intervalUs 간격으로 count개를 보내고 각 값의 도착 지연 확인
+static void streamAndCheck(uint32_t intervalUs, uint32_t count, uint32_t* worstReceiveToRing, uint32_t* worstSendToRing) {
+    static uint32_t values[1000];
+    static Delivery deliveries[1000];
+    TEST_ASSERT_LESS_OR_EQUAL(1000, count);
+
+    Sample<BaroSample> latest;
+    lastSequence = bmp.getSamples().getSequence();
+    lastTimestamp = bmp.getSamples().latest(latest) ? latest.timestamp : 0;
+    delivered = 0;
+    simulatedPressure.resetStats();
+
+    uint32_t sent = 0;
+    uint32_t nextSend = halMicros();
+    uint32_t deadline = nextSend + intervalUs * count + 100000;
+    while (delivered < count && (int32_t)(halMicros() - deadline) < 0) {
+        if (sent < count && (int32_t)(halMicros() - nextSend) >= 0) {
+            values[sent] = 101200 + (sent * 37) % 250;   // 지상 근처에서 변하는 값
+            deliveries[sent].sentAt = halMicros();
+            sendSimp(values[sent]);
+            sent++;
+            nextSend += intervalUs;
+        }
+        step();
+        collect(values, deliveries, sent);
+    }
+    TEST_ASSERT_EQUAL(count, delivered);
+    TEST_ASSERT_EQUAL(count, simulatedPressure.getConsumed());
+    TEST_ASSERT_EQUAL(0, simulatedPressure.getDropped());
+
+    // 명령 실행 -> 링: BMP 태스크 한 주기 + 그 태스크의 시작 지연 안 (주입 값은 한 번에 모두 처리)
+    uint32_t bmpPeriod = scheduler.getPeriod(TASK_BMP);
+    uint32_t bmpJitter = scheduler.getStats(TASK_BMP).maxJitterUs;
+    TEST_ASSERT_LESS_THAN(TASKS[TASK_BMP].deadlineUs, bmpJitter);
+    *worstReceiveToRing = 0;
+    *worstSendToRing = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t receiveToRing = deliveries[i].arrivedAt - deliveries[i].receivedAt;
+        uint32_t sendToRing = deliveries[i].arrivedAt - deliveries[i].sentAt;
+        if (receiveToRing > *worstReceiveToRing) *worstReceiveToRing = receiveToRing;
+        if (sendToRing > *worstSendToRing) *worstSendToRing = sendToRing;
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(bmpPeriod + bmpJitter + STEP_US, *worstReceiveToRing);
+    TEST_ASSERT_LESS_OR_EQUAL(bmpPeriod + bmpJitter, simulatedPressure.getMaxLag());
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_simp_rejected_until_activated(void) {
+    halSetMicros(0);
+    Serial.setEnabled(false);
+    flightReset();
+    flightSetup();
+    while (!boot.isDone() && halMicros() < 5000000) step();
+
+    // 비행 모드에서는 SIMP 무시 (센서 값 그대로)
+    sendSimp(90000);
+    for (uint32_t us = 0; us < 50000; us += STEP_US) step();
+    TEST_ASSERT_EQUAL('F', telemetry.getMode());
+    TEST_ASSERT_EQUAL(0, simulatedPressure.getConsumed());
+    Sample<BaroSample> latest;
+    TEST_ASSERT_TRUE(bmp.getSamples().latest(latest));
+    TEST_ASSERT_TRUE(latest.value.pressure > 1000.0f);
+
+    // ENABLE 없이 ACTIVATE는 실패
+    Serial.inject("CMD," TEAM_ID ",SIM,ACTIVATE\n");
+    for (uint32_t us = 0; us < 10000; us += STEP_US) step();
+    TEST_ASSERT_EQUAL('F', telemetry.getMode());
+}
+
+void test_simp_1hz_reaches_ring_within_bmp_period(void) {
+    startSimulation();
+    uint32_t receiveToRing, sendToRing;
+    streamAndCheck(1000000, 5, &receiveToRing, &sendToRing);
+
+    // 마지막 값이 고도/상태 경로에도 반영 (에코 포함)
+    Sample<BaroSample> latest;
+    TEST_ASSERT_TRUE(bmp.getSamples().latest(latest));
+    TEST_ASSERT_EQUAL_FLOAT(latest.value.pressure, bmp.getPressure());
+    TEST_ASSERT_EQUAL_STRING_LEN("SIMP", telemetry.getCommandEcho(), 4);
+
+    char line[112];
+    snprintf(line, sizeof(line), "1 Hz SIMP: receipt -> ring worst %u us, console -> ring worst %u us (BMP period %u us)",
+             (unsigned)receiveToRing, (unsigned)sendToRing, (unsigned)scheduler.getPeriod(TASK_BMP));
+    TEST_MESSAGE(line);
+}
+
+void test_simp_fast_stream_keeps_up(void) {
+    startSimulation();
+
+    // BMP 주기보다 빠르게 (200 Hz): 한 주기에 여러 값이 쌓여도 모두 순서대로, 버림 없이
+    uint32_t receiveToRing, sendToRing;
+    streamAndCheck(5000, 400, &receiveToRing, &sendToRing);
+
+    char line[128];
+    snprintf(line, sizeof(line), "200 Hz SIMP: 400 values, receipt -> ring worst %u us, average lag %u us (BMP jitter %u us)",
+             (unsigned)receiveToRing, (unsigned)simulatedPressure.getAverageLag(),
+             (unsigned)scheduler.getStats(TASK_BMP).maxJitterUs);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_simp_rejected_until_activated);
+    RUN_TEST(test_simp_1hz_reaches_ring_within_bmp_period);
+    RUN_TEST(test_simp_fast_stream_keeps_up);
+    return UNITY_END();
+}
@@ -0,0 +1,84 @@
+// test/test_spsc_ring/test_main.cpp
+#include <unity.h>
+#include <thread>
+#include "SpscRing.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_fifo_order_and_wrap(void) {
+    SpscRing<uint32_t, 4> ring;
+    uint32_t value;
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_FALSE(ring.pop(value));
+
+    // 용량의 몇 배를 돌려 인덱스 마스킹 확인
+    uint32_t next = 0, expected = 0;
+    for (int round = 0; round < 10; round++) {
+        for (int i = 0; i < 3; i++) TEST_ASSERT_TRUE(ring.push(next++));
+        TEST_ASSERT_EQUAL(3, ring.size());
+        for (int i = 0; i < 3; i++) {
+            TEST_ASSERT_TRUE(ring.pop(value));
+            TEST_ASSERT_EQUAL(expected++, value);
+        }
+    }
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+void test_full_ring_drops_newest(void) {
+    SpscRing<uint32_t, 4> ring;
+    for (uint32_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(ring.push(i));
+    TEST_ASSERT_FALSE(ring.push(99));
+    TEST_ASSERT_FALSE(ring.push(100));
+    TEST_ASSERT_EQUAL(2, ring.getDropped());
+    TEST_ASSERT_EQUAL(4, ring.size());
+
+    // 남아 있는 것은 먼저 넣은 항목
+    uint32_t value;
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(ring.pop(value));
+        TEST_ASSERT_EQUAL(i, value);
+    }
+    TEST_ASSERT_TRUE(ring.push(5));
+}
+
+struct Event {
+    uint32_t sequence;
+    uint32_t check;
+};
+
+void test_concurrent_producer_consumer(void) {
+    // 생산자 스레드(ISR 역할)와 소비자가 동시에 돌아도 순서/내용이 보존됨
+    static SpscRing<Event, 64> ring;
+    const uint32_t count = 200000;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < count; i++) {
+            Event event = { i, i * 2654435761u };
+            while (!ring.push(event)) std::this_thread::yield();
+        }
+    });
+
+    uint32_t received = 0;
+    bool ordered = true;
+    Event event;
+    while (received < count) {
+        if (!ring.pop(event)) { std::this_thread::yield(); continue; }
+        if (event.sequence != received || event.check != received * 2654435761u) ordered = false;
+        received++;
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_fifo_order_and_wrap);
+    RUN_TEST(test_full_ring_drops_newest);
+    RUN_TEST(test_concurrent_producer_consumer);
+    return UNITY_END();
+}
@@ -0,0 +1,99 @@
+// test/test_state/test_main.cpp
+#include <unity.h>
+#include "State.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// 발사 조건을 계속 만족하는 샘플을 주기마다 넣고 ASCENT 진입 시각을 반환
+static uint32_t launchDetectedAt(uint32_t periodUs, uint32_t start) {
+    StateMachine machine;
+    for (uint32_t t = start; t - start < 1000000; t += periodUs) {
+        if (machine.update(20.0f, 30.0f, t) == STATE_ASCENT) return t - start;
+    }
+    return 0xFFFFFFFF;
+}
+
+void test_window_is_time_not_samples(void) {
+    // BMP 주기가 바뀌어도 판정 시간은 같음 (첫 참 샘플 + 100 ms 이후 첫 샘플)
+    TEST_ASSERT_EQUAL(100000, launchDetectedAt(10000, 0));       // 100 Hz
+    TEST_ASSERT_EQUAL(100000, launchDetectedAt(20000, 0));       // 50 Hz
+    TEST_ASSERT_EQUAL(120000, launchDetectedAt(40000, 0));       // 25 Hz
+    TEST_ASSERT_EQUAL(160000, launchDetectedAt(80000, 0));       // 12.5 Hz
+}
+
+void test_window_survives_micros_wrap(void) {
+    TEST_ASSERT_EQUAL(100000, launchDetectedAt(20000, 0xFFFFFFFF - 50000));
+}
+
+void test_glitch_restarts_window(void) {
+    StateMachine machine;
+    machine.update(20.0f, 30.0f, 0);
+    machine.update(20.0f, 30.0f, 80000);
+    machine.update(20.0f, 0.0f, 90000);                          // 조건 깨짐
+    TEST_ASSERT_EQUAL(STATE_LAUNCH_PAD, machine.update(20.0f, 30.0f, 100000));
+    TEST_ASSERT_EQUAL(STATE_LAUNCH_PAD, machine.update(20.0f, 30.0f, 190000));
+    TEST_ASSERT_EQUAL(STATE_ASCENT, machine.update(20.0f, 30.0f, 200000));
+}
+
+void test_single_sample_never_triggers(void) {
+    StateMachine machine;
+    machine.setState(STATE_DESCENT);
+    TEST_ASSERT_EQUAL(STATE_DESCENT, machine.update(50.0f, -5.0f, 1000000));
+    TEST_ASSERT_EQUAL(STATE_DESCENT, machine.update(150.0f, -5.0f, 1500000));
+    TEST_ASSERT_EQUAL(STATE_DESCENT, machine.update(50.0f, -5.0f, 2000000));
+    TEST_ASSERT_EQUAL(STATE_PROBE_RELEASE, machine.update(50.0f, -5.0f, 2100000));
+}
+
+void test_full_sequence_at_low_rate(void) {
+    StateMachine machine;
+    uint32_t t = 0;
+    const uint32_t period = 80000;                              // 12.5 Hz
+
+    // 상승 -> 정점 -> 하강 -> 분리 -> 착지
+    float h = 0.0f;
+    for (; machine.getState() == STATE_LAUNCH_PAD && t < 10000000; t += period) {
+        h += 40.0f * period * 1e-6f;
+        machine.update(h, 40.0f, t);
+    }
+    TEST_ASSERT_EQUAL(STATE_ASCENT, machine.getState());
+    uint32_t apogeeStart = t;
+    for (; machine.getState() == STATE_ASCENT && t < 20000000; t += period) machine.update(h, -1.0f, t);
+    TEST_ASSERT_EQUAL(STATE_APOGEE, machine.getState());
+    TEST_ASSERT_EQUAL(apogeeStart + 3 * period, t - period);    // 240 ms 샘플에서 200 ms 충족
+
+    for (; machine.getState() != STATE_LANDED && t < 200000000; t += period) {
+        h = h > 0.5f ? h - 15.0f * period * 1e-6f : 0.0f;
+        machine.update(h, h > 0.0f ? -15.0f : 0.0f, t);
+    }
+    TEST_ASSERT_EQUAL(STATE_LANDED, machine.getState());
+    TEST_ASSERT_EQUAL(0.0f, h);
+}
+
+void test_landed_needs_stable_altitude(void) {
+    StateMachine machine;
+    machine.setState(STATE_PROBE_RELEASE);
+
+    // 속도는 작아도 고도가 창 밖으로 흔들리면 계속 새로 시작
+    uint32_t t = 0;
+    for (int i = 0; i < 100; i++, t += 100000) {
+        TEST_ASSERT_EQUAL(STATE_PROBE_RELEASE, machine.update((i % 2) ? 2.0f : 0.0f, 0.1f, t));
+    }
+    for (int i = 0; i < 20; i++, t += 100000) machine.update(0.0f, 0.1f, t);
+    TEST_ASSERT_EQUAL(STATE_PROBE_RELEASE, machine.getState());
+    machine.update(0.2f, 0.1f, t);
+    TEST_ASSERT_EQUAL(STATE_LANDED, machine.getState());
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_window_is_time_not_samples);
+    RUN_TEST(test_window_survives_micros_wrap);
+    RUN_TEST(test_glitch_restarts_window);
+    RUN_TEST(test_single_sample_never_triggers);
+    RUN_TEST(test_full_sequence_at_low_rate);
+    RUN_TEST(test_landed_needs_stable_altitude);
+    return UNITY_END();
+}
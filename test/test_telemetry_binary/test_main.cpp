@@ -0,0 +1,191 @@
+// test/test_telemetry_binary/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "Telemetry.h"
+#include "TelemetryBinary.h"
+
+static TelemetryPacket makePacket() {
+    TelemetryPacket packet;
+    memset(&packet, 0, sizeof(packet));
+    copyString(packet.teamId, TEAM_ID, sizeof(packet.teamId));
+    copyString(packet.missionTime, "01:02:03", sizeof(packet.missionTime));
+    packet.packetCount = 4321;
+    packet.mode = 'S';
+    packet.state = STATE_DESCENT;
+    packet.altitude = 512.37f;
+    packet.temperature = -12.5f;
+    packet.pressure = 954.21f;
+    packet.voltage = 7.41f;
+    packet.current = -0.35f;
+    packet.gyro_r = 12.34f;          // 자세각 (°)
+    packet.gyro_p = -45.67f;
+    packet.gyro_y = 179.99f;
+    packet.accel_r = 0.12f;
+    packet.accel_p = -3.4f;
+    packet.accel_y = 9.81f;
+    copyString(packet.gpsTime, "12:34:56", sizeof(packet.gpsTime));
+    packet.gpsAltitude = 498.6f;
+    packet.gpsLatitude = 37.4001234f;
+    packet.gpsLongitude = 126.9155678f;
+    packet.gpsSats = 9;
+    copyString(packet.cmdEcho, "CXON", sizeof(packet.cmdEcho));
+    return packet;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_crc16_ccitt_false_check_value(void) {
+    const char* check = "123456789";
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, crc16((const uint8_t*)check, 9));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, crc16(nullptr, 0));
+}
+
+void test_cobs_round_trip_and_no_zeros(void) {
+    // 0x00 연속, 254바이트 넘는 비영 구간, 끝의 0x00
+    uint8_t input[600];
+    for (size_t i = 0; i < sizeof(input); i++) input[i] = (i < 10 || i % 97 == 0) ? 0 : (uint8_t)(i % 255 + 1);
+    input[sizeof(input) - 1] = 0;
+
+    uint8_t encoded[sizeof(input) + sizeof(input) / 254 + 2];
+    size_t encodedLength = cobsEncode(input, sizeof(input), encoded);
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(encoded), encodedLength);
+    for (size_t i = 0; i < encodedLength; i++) TEST_ASSERT_TRUE(encoded[i] != 0);
+
+    uint8_t decoded[sizeof(input)];
+    TEST_ASSERT_EQUAL(sizeof(input), cobsDecode(encoded, encodedLength, decoded));
+    TEST_ASSERT_EQUAL_MEMORY(input, decoded, sizeof(input));
+}
+
+void test_cobs_rejects_bad_code(void) {
+    const uint8_t truncated[] = { 0x05, 0x11, 0x22 };
+    uint8_t out[8];
+    TEST_ASSERT_EQUAL(0, cobsDecode(truncated, sizeof(truncated), out));
+}
+
+void test_binary_round_trip(void) {
+    TelemetryPacket packet = makePacket();
+    uint8_t frame[TELEMETRY_BINARY_MAX_FRAME];
+    size_t length = encodeTelemetryBinary(packet, frame, sizeof(frame));
+    TEST_ASSERT_GREATER_THAN(0, length);
+    TEST_ASSERT_EQUAL(0, frame[length - 1]);
+
+    TelemetryPacket decoded;
+    TEST_ASSERT_TRUE(decodeTelemetryBinary(frame, length - 1, decoded));
+    TEST_ASSERT_EQUAL(packet.packetCount, decoded.packetCount);
+    TEST_ASSERT_EQUAL('S', decoded.mode);
+    TEST_ASSERT_EQUAL(STATE_DESCENT, decoded.state);
+    TEST_ASSERT_EQUAL_STRING("01:02:03", decoded.missionTime);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, packet.altitude, decoded.altitude);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, packet.temperature, decoded.temperature);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, packet.pressure, decoded.pressure);
+
+    // 자이로는 0.1 °/s 단위로 큰 회전율도 그대로
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, packet.gyro_r, decoded.gyro_r);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, packet.gyro_p, decoded.gyro_p);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, packet.gyro_y, decoded.gyro_y);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, packet.accel_y, decoded.accel_y);
+
+    TEST_ASSERT_EQUAL_STRING("12:34:56", decoded.gpsTime);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, packet.gpsLatitude, decoded.gpsLatitude);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, packet.gpsLongitude, decoded.gpsLongitude);
+    TEST_ASSERT_EQUAL(9, decoded.gpsSats);
+    TEST_ASSERT_EQUAL_STRING("CXON", decoded.cmdEcho);
+}
+
+void test_gyro_saturates_instead_of_wrapping(void) {
+    TelemetryPacket packet = makePacket();
+    packet.gyro_r = 500.0f;          // 자세각은 ±180 °지만 범위 밖 값도 감싸지 않고 포화
+    packet.gyro_p = -500.0f;
+
+    uint8_t frame[TELEMETRY_BINARY_MAX_FRAME];
+    size_t length = encodeTelemetryBinary(packet, frame, sizeof(frame));
+    TelemetryPacket decoded;
+    TEST_ASSERT_TRUE(decodeTelemetryBinary(frame, length - 1, decoded));
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 327.67f, decoded.gyro_r);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, -327.68f, decoded.gyro_p);
+}
+
+void test_reader_rejects_corruption_and_resyncs(void) {
+    TelemetryPacket packet = makePacket();
+    uint8_t frame[TELEMETRY_BINARY_MAX_FRAME];
+    size_t length = encodeTelemetryBinary(packet, frame, sizeof(frame));
+
+    BinaryFrameReader reader;
+    TelemetryPacket out;
+    int decoded = 0;
+
+    // 잡음 -> 손상된 프레임 -> 정상 프레임
+    const uint8_t noise[] = { 0x13, 0x37, 0x00 };
+    for (uint8_t b : noise) decoded += reader.push(b, out);
+    for (size_t i = 0; i < length; i++) decoded += reader.push(i == 5 ? frame[i] ^ 0x40 : frame[i], out);
+    for (size_t i = 0; i < length; i++) decoded += reader.push(frame[i], out);
+
+    TEST_ASSERT_EQUAL(1, decoded);
+    TEST_ASSERT_EQUAL(1, reader.getFramesDecoded());
+    TEST_ASSERT_EQUAL(2, reader.getFramesRejected());
+    TEST_ASSERT_EQUAL(packet.packetCount, out.packetCount);
+}
+
+void test_reader_rejects_other_version(void) {
+    TelemetryPacket packet = makePacket();
+    uint8_t frame[TELEMETRY_BINARY_MAX_FRAME];
+    size_t length = encodeTelemetryBinary(packet, frame, sizeof(frame));
+
+    // 헤더 버전을 2(자이로 = 각속도)로 바꾸고 CRC를 다시 계산
+    uint8_t raw[TELEMETRY_BINARY_MAX_FRAME];
+    size_t rawLength = cobsDecode(frame, length - 1, raw);
+    raw[0] = (raw[0] & 0x0F) | (2 << 4);
+    uint16_t crc = crc16(raw, rawLength - 2);
+    raw[rawLength - 2] = crc >> 8;
+    raw[rawLength - 1] = crc & 0xFF;
+    size_t encoded = cobsEncode(raw, rawLength, frame);
+
+    TelemetryPacket decoded;
+    TEST_ASSERT_FALSE(decodeTelemetryBinary(frame, encoded, decoded));
+}
+
+void test_binary_vs_csv_size_and_cost(void) {
+    TelemetryPacket packet = makePacket();
+    char csv[TELEMETRY_MAX_LEN];
+    uint8_t frame[TELEMETRY_BINARY_MAX_FRAME];
+
+    size_t csvLength = formatTelemetryCSV(packet, csv, sizeof(csv));
+    size_t binaryLength = encodeTelemetryBinary(packet, frame, sizeof(frame));
+    TEST_ASSERT_LESS_THAN(csvLength / 2, binaryLength);
+
+    const int rounds = 20000;
+    volatile size_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) { packet.packetCount = i; sink += formatTelemetryCSV(packet, csv, sizeof(csv)); }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) { packet.packetCount = i; sink += encodeTelemetryBinary(packet, frame, sizeof(frame)); }
+    auto t2 = std::chrono::steady_clock::now();
+    TelemetryPacket decoded;
+    for (int i = 0; i < rounds; i++) sink += decodeTelemetryBinary(frame, binaryLength - 1, decoded);
+    auto t3 = std::chrono::steady_clock::now();
+
+    char line[160];
+    snprintf(line, sizeof(line), "CSV %u B/frame %.0f ns, binary %u B/frame encode %.0f ns decode %.0f ns",
+             (unsigned)csvLength, std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds,
+             (unsigned)binaryLength, std::chrono::duration<double, std::nano>(t2 - t1).count() / rounds,
+             std::chrono::duration<double, std::nano>(t3 - t2).count() / rounds);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_crc16_ccitt_false_check_value);
+    RUN_TEST(test_cobs_round_trip_and_no_zeros);
+    RUN_TEST(test_cobs_rejects_bad_code);
+    RUN_TEST(test_binary_round_trip);
+    RUN_TEST(test_gyro_saturates_instead_of_wrapping);
+    RUN_TEST(test_reader_rejects_corruption_and_resyncs);
+    RUN_TEST(test_reader_rejects_other_version);
+    RUN_TEST(test_binary_vs_csv_size_and_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,348 @@
+// test/test_telemetry_csv/test_main.cpp
+// CSV 텔레메트리: 고정 버퍼 작성기(CSVWriter/formatTelemetryCSV)의 정확한 출력과
+// 이전 String 기반 Packet::formatCSV (543aaa0) 대비 프레임당 시간/힙 할당
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <chrono>
+#include "Telemetry.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static TelemetryPacket makePacket() {
+    TelemetryPacket packet;
+    memset(&packet, 0, sizeof(packet));
+    copyString(packet.teamId, TEAM_ID, sizeof(packet.teamId));
+    copyString(packet.missionTime, "01:02:03", sizeof(packet.missionTime));
+    packet.packetCount = 4321;
+    packet.mode = 'F';
+    packet.state = STATE_DESCENT;
+    packet.altitude = 512.37f;
+    packet.temperature = -12.5f;
+    packet.pressure = 954.21f;
+    packet.voltage = 7.41f;
+    packet.current = -0.35f;
+    packet.gyro_r = 12.34f;
+    packet.gyro_p = -45.67f;
+    packet.gyro_y = 179.99f;
+    packet.accel_r = 0.12f;
+    packet.accel_p = -3.4f;
+    packet.accel_y = 9.81f;
+    copyString(packet.gpsTime, "12:34:56", sizeof(packet.gpsTime));
+    packet.gpsAltitude = 498.6f;
+    packet.gpsLatitude = 37.4001234f;
+    packet.gpsLongitude = -126.9155678f;
+    packet.gpsSats = 9;
+    copyString(packet.cmdEcho, "CXON", sizeof(packet.cmdEcho));
+    return packet;
+}
+
+static const char* EXPECTED_LINE =
+    "1062,01:02:03,4321,F,DESCENT,512.37,-12.50,954.21,7.41,-0.35,12.34,-45.67,179.99,"
+    "0.12,-3.40,9.81,12:34:56,498.60,37.400124,-126.915565,9,CXON";
+
+static const char* formatFloat(float value, uint8_t decimals) {
+    static char buffer[32];
+    CSVWriter csv(buffer, sizeof(buffer));
+    csv.appendFloat(value, decimals);
+    return buffer;
+}
+
+// ---- 정확한 출력 ----
+
+void test_full_line_exact(void) {
+    TelemetryPacket packet = makePacket();
+    char line[TELEMETRY_MAX_LEN];
+    size_t length = formatTelemetryCSV(packet, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING(EXPECTED_LINE, line);
+    TEST_ASSERT_EQUAL(strlen(EXPECTED_LINE), length);
+}
+
+void test_negatives_and_rounding(void) {
+    // 소수부 반올림은 절반 올림, 자리올림은 정수부로
+    TEST_ASSERT_EQUAL_STRING("2.00", formatFloat(1.999f, 2));
+    TEST_ASSERT_EQUAL_STRING("1.00", formatFloat(0.995f, 2));
+    TEST_ASSERT_EQUAL_STRING("100.00", formatFloat(99.995f, 2));
+    TEST_ASSERT_EQUAL_STRING("0.13", formatFloat(0.125f, 2));       // 정확히 절반 (printf는 0.12)
+    TEST_ASSERT_EQUAL_STRING("2.67", formatFloat(2.675f, 2));       // float로는 2.67499995
+    TEST_ASSERT_EQUAL_STRING("0.05", formatFloat(0.05f, 2));        // 소수부 앞자리 0
+
+    // 음수: 부호는 한 번, 0으로 반올림되면 부호 없음 (-0.00 없음)
+    TEST_ASSERT_EQUAL_STRING("-12.50", formatFloat(-12.5f, 2));
+    TEST_ASSERT_EQUAL_STRING("-0.35", formatFloat(-0.35f, 2));
+    TEST_ASSERT_EQUAL_STRING("-0.01", formatFloat(-0.0051f, 2));
+    TEST_ASSERT_EQUAL_STRING("0.00", formatFloat(-0.004f, 2));
+    TEST_ASSERT_EQUAL_STRING("0.00", formatFloat(-0.0f, 2));
+    TEST_ASSERT_EQUAL_STRING("0.000000", formatFloat(-1e-7f, 6));
+
+    // 좌표 6자리 (float 유효숫자 안에서)
+    TEST_ASSERT_EQUAL_STRING("37.400124", formatFloat(37.4001234f, 6));
+    TEST_ASSERT_EQUAL_STRING("-126.915565", formatFloat(-126.9155678f, 6));
+
+    // 소수점 없음 / 최대 9자리
+    TEST_ASSERT_EQUAL_STRING("3", formatFloat(2.5f, 0));
+    TEST_ASSERT_EQUAL_STRING("0.500000000", formatFloat(0.5f, 12));
+}
+
+void test_integers_and_special_values(void) {
+    char buffer[64];
+    CSVWriter csv(buffer, sizeof(buffer));
+    csv.appendUInt(0);              csv.separator();
+    csv.appendUInt(4294967295UL);   csv.separator();
+    csv.appendInt(-1);              csv.separator();
+    csv.appendInt(INT32_MIN);       csv.separator();
+    csv.appendInt(INT32_MAX);
+    TEST_ASSERT_EQUAL_STRING("0,4294967295,-1,-2147483648,2147483647", buffer);
+
+    // uint32 범위를 넘는 실수는 ovf (정수부를 32비트로 나누므로)
+    TEST_ASSERT_EQUAL_STRING("4294967040.00", formatFloat(4294967040.0f, 2));
+    TEST_ASSERT_EQUAL_STRING("-4294967040.00", formatFloat(-4294967040.0f, 2));
+    TEST_ASSERT_EQUAL_STRING("ovf", formatFloat(4294967296.0f, 2));
+    TEST_ASSERT_EQUAL_STRING("ovf", formatFloat(-1e20f, 2));
+    TEST_ASSERT_EQUAL_STRING("nan", formatFloat(NAN, 2));
+    TEST_ASSERT_EQUAL_STRING("inf", formatFloat(INFINITY, 2));
+}
+
+void test_truncation_keeps_prefix_and_terminator(void) {
+    TelemetryPacket packet = makePacket();
+    size_t full = strlen(EXPECTED_LINE);
+
+    // 모든 크기에서: 잘린 앞부분 + 널, 넘침 플래그
+    for (size_t size = 0; size <= full + 1; size++) {
+        char line[TELEMETRY_MAX_LEN];
+        memset(line, 'X', sizeof(line));
+        size_t length = formatTelemetryCSV(packet, line, size);
+
+        size_t expected = size == 0 ? 0 : (size - 1 < full ? size - 1 : full);
+        TEST_ASSERT_EQUAL(expected, length);
+        if (size > 0) {
+            TEST_ASSERT_EQUAL_MEMORY(EXPECTED_LINE, line, length);
+            TEST_ASSERT_EQUAL('\0', line[length]);
+        }
+        TEST_ASSERT_EQUAL('X', line[size]);   // 버퍼 밖은 건드리지 않음
+
+        CSVWriter csv(line, size);
+        csv.appendString(EXPECTED_LINE);
+        TEST_ASSERT_EQUAL(size <= full, csv.overflowed());
+    }
+}
+
+void test_widest_packet_fits(void) {
+    // 필드마다 가장 긴 값 (ovf 직전 음수, 최대 카운터, 꽉 찬 명령 에코)
+    TelemetryPacket packet = makePacket();
+    packet.packetCount = 4294967295UL;
+    packet.state = STATE_PROBE_RELEASE;
+    float widest = -4294967040.0f;
+    packet.altitude = packet.temperature = packet.pressure = widest;
+    packet.voltage = packet.current = widest;
+    packet.gyro_r = packet.gyro_p = packet.gyro_y = widest;
+    packet.accel_r = packet.accel_p = packet.accel_y = widest;
+    packet.gpsAltitude = packet.gpsLatitude = packet.gpsLongitude = widest;
+    packet.gpsSats = INT32_MIN;
+    memset(packet.cmdEcho, 'C', TELEMETRY_CMD_ECHO_LEN - 1);
+    packet.cmdEcho[TELEMETRY_CMD_ECHO_LEN - 1] = '\0';
+
+    char line[TELEMETRY_MAX_LEN];
+    size_t length = formatTelemetryCSV(packet, line, sizeof(line));
+    TEST_ASSERT_LESS_THAN(TELEMETRY_MAX_LEN - 1, length);
+    TEST_ASSERT_EQUAL('C', line[length - 1]);
+
+    char message[48];
+    snprintf(message, sizeof(message), "widest line %u B of %u", (unsigned)length, (unsigned)TELEMETRY_MAX_LEN);
+    TEST_MESSAGE(message);
+}
+
+// ---- 이전 구현 (543aaa0 Packet::formatCSV, Arduino String) ----
+// String은 코어 WString처럼 길이가 늘 때마다 realloc, 임시 객체는 malloc/free
+// String(float, n)은 dtostrf (printf %.nf와 같은 자릿수)
+
+static uint32_t heapAllocations = 0;
+
+class String {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length;
+
+    bool reserve(size_t size) {
+        if (buffer && capacity >= size) return true;
+        char* grown = (char*)realloc(buffer, size + 1);
+        heapAllocations++;
+        if (!grown) return false;
+        buffer = grown;
+        capacity = size;
+        return true;
+    }
+
+    void concat(const char* text, size_t count) {
+        if (!reserve(length + count)) return;
+        memcpy(buffer + length, text, count);
+        length += count;
+        buffer[length] = '\0';
+    }
+
+public:
+    String(const char* text = "") : buffer(nullptr), capacity(0), length(0) { concat(text, strlen(text)); }
+    String(const String& other) : buffer(nullptr), capacity(0), length(0) { concat(other.c_str(), other.length); }
+    explicit String(char c) : buffer(nullptr), capacity(0), length(0) { concat(&c, 1); }
+    explicit String(uint32_t value) : buffer(nullptr), capacity(0), length(0) {
+        char digits[12];
+        concat(digits, snprintf(digits, sizeof(digits), "%u", (unsigned)value));
+    }
+    explicit String(int value) : buffer(nullptr), capacity(0), length(0) {
+        char digits[12];
+        concat(digits, snprintf(digits, sizeof(digits), "%d", value));
+    }
+    String(float value, unsigned char decimals) : buffer(nullptr), capacity(0), length(0) {
+        char digits[40];
+        concat(digits, snprintf(digits, sizeof(digits), "%.*f", decimals, value));
+    }
+    ~String() { free(buffer); }
+
+    String& operator=(const String& other) {
+        if (this != &other) { length = 0; concat(other.c_str(), other.length); }
+        return *this;
+    }
+    String& operator=(const char* text) { length = 0; concat(text, strlen(text)); return *this; }
+
+    String& operator+=(const String& other) { concat(other.c_str(), other.length); return *this; }
+    String& operator+=(const char* text) { concat(text, strlen(text)); return *this; }
+    friend String operator+(const String& left, const char* right) {
+        String sum(left);
+        sum += right;
+        return sum;
+    }
+
+    const char* c_str() const { return buffer ? buffer : ""; }
+    size_t size() const { return length; }
+};
+
+struct BaselinePacket {
+    String teamId;
+    String missionTime;
+    uint32_t packetCount;
+    char mode;
+    String state;
+    float altitude, temperature, pressure;
+    float voltage, current;
+    float gyro_r, gyro_p, gyro_y;
+    float accel_r, accel_p, accel_y;
+    String gpsTime;
+    float gpsAltitude, gpsLatitude, gpsLongitude;
+    int gpsSats;
+    String cmdEcho;
+};
+
+static String baselineFormatCSV(const BaselinePacket& packet) {
+    String csv = "";
+
+    csv += packet.teamId + ",";
+    csv += packet.missionTime + ",";
+    csv += String(packet.packetCount) + ",";
+    csv += String(packet.mode) + ",";
+    csv += packet.state + ",";
+
+    csv += String(packet.altitude, 2) + ",";
+    csv += String(packet.temperature, 2) + ",";
+    csv += String(packet.pressure, 2) + ",";
+
+    csv += String(packet.voltage, 2) + ",";
+    csv += String(packet.current, 2) + ",";
+
+    csv += String(packet.gyro_r, 2) + ",";
+    csv += String(packet.gyro_p, 2) + ",";
+    csv += String(packet.gyro_y, 2) + ",";
+
+    csv += String(packet.accel_r, 2) + ",";
+    csv += String(packet.accel_p, 2) + ",";
+    csv += String(packet.accel_y, 2) + ",";
+
+    csv += packet.gpsTime + ",";
+    csv += String(packet.gpsAltitude, 2) + ",";
+    csv += String(packet.gpsLatitude, 6) + ",";
+    csv += String(packet.gpsLongitude, 6) + ",";
+    csv += String(packet.gpsSats) + ",";
+
+    csv += packet.cmdEcho;
+
+    return csv;
+}
+
+static void toBaseline(const TelemetryPacket& in, BaselinePacket& out) {
+    out.teamId = in.teamId;
+    out.missionTime = in.missionTime;
+    out.packetCount = in.packetCount;
+    out.mode = in.mode;
+    out.state = stateName(in.state);
+    out.altitude = in.altitude; out.temperature = in.temperature; out.pressure = in.pressure;
+    out.voltage = in.voltage; out.current = in.current;
+    out.gyro_r = in.gyro_r; out.gyro_p = in.gyro_p; out.gyro_y = in.gyro_y;
+    out.accel_r = in.accel_r; out.accel_p = in.accel_p; out.accel_y = in.accel_y;
+    out.gpsTime = in.gpsTime;
+    out.gpsAltitude = in.gpsAltitude; out.gpsLatitude = in.gpsLatitude; out.gpsLongitude = in.gpsLongitude;
+    out.gpsSats = in.gpsSats;
+    out.cmdEcho = in.cmdEcho;
+}
+
+void test_same_text_as_string_baseline(void) {
+    TelemetryPacket packet = makePacket();
+    BaselinePacket baseline;
+    toBaseline(packet, baseline);
+
+    String expected = baselineFormatCSV(baseline);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), EXPECTED_LINE);
+}
+
+void test_cost_per_frame_vs_string_baseline(void) {
+    TelemetryPacket packet = makePacket();
+    BaselinePacket baseline;
+    toBaseline(packet, baseline);
+
+    const int FRAMES = 20000;
+    volatile size_t sink = 0;
+
+    uint32_t allocationsBefore = heapAllocations;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < FRAMES; i++) {
+        baseline.packetCount = i;
+        String line = baselineFormatCSV(baseline);
+        sink += line.size();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double baselineAllocations = (double)(heapAllocations - allocationsBefore) / FRAMES;
+
+    // 고정 버퍼: 할당 없음 (String 객체를 만들지 않으므로 카운터도 그대로)
+    allocationsBefore = heapAllocations;
+    char line[TELEMETRY_MAX_LEN];
+    auto t2 = std::chrono::steady_clock::now();
+    for (int i = 0; i < FRAMES; i++) {
+        packet.packetCount = i;
+        sink += formatTelemetryCSV(packet, line, sizeof(line));
+    }
+    auto t3 = std::chrono::steady_clock::now();
+    TEST_ASSERT_EQUAL(allocationsBefore, heapAllocations);
+    TEST_ASSERT_GREATER_THAN(40, (int)baselineAllocations);
+
+    char message[160];
+    snprintf(message, sizeof(message), "String baseline %.0f ns/frame, %.0f allocations/frame; CSVWriter %.0f ns/frame, 0 allocations",
+             std::chrono::duration<double, std::nano>(t1 - t0).count() / FRAMES, baselineAllocations,
+             std::chrono::duration<double, std::nano>(t3 - t2).count() / FRAMES);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_full_line_exact);
+    RUN_TEST(test_negatives_and_rounding);
+    RUN_TEST(test_integers_and_special_values);
+    RUN_TEST(test_truncation_keeps_prefix_and_terminator);
+    RUN_TEST(test_widest_packet_fits);
+    RUN_TEST(test_same_text_as_string_baseline);
+    RUN_TEST(test_cost_per_frame_vs_string_baseline);
+    return UNITY_END();
+}
@@ -0,0 +1,231 @@
+// test/test_ubx_parser/test_main.cpp
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "sensors/UBXParser.h"
+#include "sensors/NMEAParser.h"
+
+static void putI32(uint8_t* p, int32_t value) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)((uint32_t)value >> (8 * i));
+}
+
+// NAV-PVT payload (필요한 필드만 채움)
+static void makePVT(uint8_t* body) {
+    memset(body, 0, UBX_NAV_PVT_LEN);
+    body[4] = 2026 & 0xFF;
+    body[5] = 2026 >> 8;
+    body[6] = 6;
+    body[7] = 14;
+    body[8] = 3;
+    body[9] = 25;
+    body[10] = 59;
+    body[20] = 3;                                   // 3D
+    body[21] = UBX_PVT_FLAG_GNSS_FIX_OK;
+    body[23] = 17;
+    putI32(&body[24], 1269155678);                  // 126.9155678 E
+    putI32(&body[28], -374001234);                  // 37.4001234 S
+    putI32(&body[36], 512345);                      // 512.345 m
+    putI32(&body[56], -15250);                      // 15.25 m/s 상승
+}
+
+static int feedAll(UBXParser& parser, const uint8_t* bytes, size_t length) {
+    int complete = 0;
+    for (size_t i = 0; i < length; i++) complete += parser.feed(bytes[i]);
+    return complete;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_build_frame_matches_reference(void) {
+    // CFG-RATE 100 ms (u-center가 만드는 프레임)
+    const uint8_t body[] = { 0x64, 0x00, 0x01, 0x00, 0x01, 0x00 };
+    const uint8_t expected[] = { 0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0x64, 0x00, 0x01, 0x00, 0x01, 0x00, 0x7A, 0x12 };
+    uint8_t frame[16];
+    TEST_ASSERT_EQUAL(sizeof(expected), UBXParser::buildFrame(UBX_CLASS_CFG, UBX_CFG_RATE, body, sizeof(body), frame));
+    TEST_ASSERT_EQUAL_MEMORY(expected, frame, sizeof(expected));
+}
+
+void test_nav_pvt_fields(void) {
+    uint8_t body[UBX_NAV_PVT_LEN];
+    makePVT(body);
+    uint8_t frame[UBX_NAV_PVT_LEN + 8];
+    size_t length = UBXParser::buildFrame(UBX_CLASS_NAV, UBX_NAV_PVT, body, sizeof(body), frame);
+
+    UBXParser parser;
+    TEST_ASSERT_EQUAL(1, feedAll(parser, frame, length));
+    TEST_ASSERT_EQUAL(UBX_PVT, parser.parse());
+
+    const UBXData& data = parser.getData();
+    TEST_ASSERT_EQUAL(2026, data.year);
+    TEST_ASSERT_EQUAL(6, data.month);
+    TEST_ASSERT_EQUAL(14, data.day);
+    TEST_ASSERT_EQUAL(3, data.hour);
+    TEST_ASSERT_EQUAL(25, data.minute);
+    TEST_ASSERT_EQUAL(59, data.seconds);
+    TEST_ASSERT_EQUAL(3, data.fixType);
+    TEST_ASSERT_TRUE(data.fix);
+    TEST_ASSERT_EQUAL(17, data.satellites);
+    TEST_ASSERT_EQUAL_INT32(1269155678, data.longitude);
+    TEST_ASSERT_EQUAL_INT32(-374001234, data.latitude);
+    TEST_ASSERT_EQUAL_INT32(512345, data.heightMSL);
+    TEST_ASSERT_EQUAL_INT32(-15250, data.velocityDown);
+}
+
+void test_other_messages_are_not_parsed(void) {
+    // ACK-ACK (CFG-RATE)
+    const uint8_t ack[] = { UBX_CLASS_CFG, UBX_CFG_RATE };
+    uint8_t frame[16];
+    size_t length = UBXParser::buildFrame(UBX_CLASS_ACK, 0x01, ack, sizeof(ack), frame);
+
+    UBXParser parser;
+    TEST_ASSERT_EQUAL(1, feedAll(parser, frame, length));
+    TEST_ASSERT_EQUAL(UBX_NONE, parser.parse());
+    TEST_ASSERT_EQUAL(UBX_CLASS_ACK, parser.getClass());
+    TEST_ASSERT_EQUAL(0, parser.getParsedCount());
+
+    // payload 없는 폴링 프레임
+    length = UBXParser::buildFrame(UBX_CLASS_CFG, UBX_CFG_PRT, nullptr, 0, frame);
+    TEST_ASSERT_EQUAL(8, length);
+    TEST_ASSERT_EQUAL(1, feedAll(parser, frame, length));
+}
+
+void test_checksum_error_and_resync(void) {
+    uint8_t body[UBX_NAV_PVT_LEN];
+    makePVT(body);
+    uint8_t stream[3 * (UBX_NAV_PVT_LEN + 8) + 4];
+    size_t n = 0;
+
+    // 잡음 + 동기 바이트 겹침, 손상 프레임, 정상 프레임
+    stream[n++] = 0x00;
+    stream[n++] = UBX_SYNC1;
+    size_t bad = n;
+    n += UBXParser::buildFrame(UBX_CLASS_NAV, UBX_NAV_PVT, body, sizeof(body), &stream[n]);
+    stream[bad + 40] ^= 0x10;
+    n += UBXParser::buildFrame(UBX_CLASS_NAV, UBX_NAV_PVT, body, sizeof(body), &stream[n]);
+
+    UBXParser parser;
+    TEST_ASSERT_EQUAL(1, feedAll(parser, stream, n));
+    TEST_ASSERT_EQUAL(1, parser.getChecksumErrors());
+    TEST_ASSERT_EQUAL(1, parser.getFrameCount());
+    TEST_ASSERT_EQUAL(UBX_PVT, parser.parse());
+}
+
+void test_oversize_frame_dropped(void) {
+    const uint8_t header[] = { UBX_SYNC1, UBX_SYNC2, UBX_CLASS_NAV, 0x35, 0x00, 0x02 };   // 512바이트
+    UBXParser parser;
+    TEST_ASSERT_EQUAL(0, feedAll(parser, header, sizeof(header)));
+    TEST_ASSERT_EQUAL(1, parser.getDroppedCount());
+
+    // 바로 다음 프레임은 정상 수신
+    uint8_t body[UBX_NAV_PVT_LEN];
+    makePVT(body);
+    uint8_t frame[UBX_NAV_PVT_LEN + 8];
+    size_t length = UBXParser::buildFrame(UBX_CLASS_NAV, UBX_NAV_PVT, body, sizeof(body), frame);
+    TEST_ASSERT_EQUAL(1, feedAll(parser, frame, length));
+}
+
+void test_parse_cost(void) {
+    uint8_t body[UBX_NAV_PVT_LEN];
+    makePVT(body);
+    uint8_t frame[UBX_NAV_PVT_LEN + 8];
+    size_t length = UBXParser::buildFrame(UBX_CLASS_NAV, UBX_NAV_PVT, body, sizeof(body), frame);
+
+    UBXParser parser;
+    const int rounds = 100000;
+    int parsed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        if (feedAll(parser, frame, length)) parsed += parser.parse() == UBX_PVT;
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+    TEST_ASSERT_EQUAL(rounds, parsed);
+
+    char line[80];
+    snprintf(line, sizeof(line), "NAV-PVT feed+parse %.0f ns/frame (%u bytes, host)", ns, (unsigned)length);
+    TEST_MESSAGE(line);
+}
+
+// 같은 측정 주기에서 링크에 실리는 양: NAV-PVT 한 프레임 vs GGA + RMC 두 문장 (u-blox 기본 자릿수)
+// 115200 8N1 = 바이트당 10비트, 해석 비용도 함께
+void test_wire_bytes_vs_nmea(void) {
+    uint8_t body[UBX_NAV_PVT_LEN];
+    makePVT(body);
+    uint8_t frame[UBX_NAV_PVT_LEN + 8];
+    size_t pvtBytes = UBXParser::buildFrame(UBX_CLASS_NAV, UBX_NAV_PVT, body, sizeof(body), frame);
+
+    static const char* const BODIES[] = {
+        "GNGGA,032559.00,3724.00740,S,12654.93407,E,1,17,0.78,512.3,M,18.1,M,,",
+        "GNRMC,032559.00,A,3724.00740,S,12654.93407,E,0.021,,140626,,,A,V",
+    };
+    char nmea[2][96];
+    size_t nmeaBytes = 0;
+    for (int i = 0; i < 2; i++) {
+        uint8_t sum = 0;
+        for (const char* p = BODIES[i]; *p; p++) sum ^= (uint8_t)*p;
+        snprintf(nmea[i], sizeof(nmea[i]), "$%s*%02X\r\n", BODIES[i], sum);
+        nmeaBytes += strlen(nmea[i]);
+    }
+
+    // 두 형식 모두 실제로 해석되는지 (같은 위치)
+    UBXParser ubx;
+    TEST_ASSERT_EQUAL(1, feedAll(ubx, frame, pvtBytes));
+    TEST_ASSERT_EQUAL(UBX_PVT, ubx.parse());
+    NMEAParser parser;
+    int sentences = 0;
+    for (int i = 0; i < 2; i++) {
+        for (const char* p = nmea[i]; *p; p++) {
+            if (parser.feed(*p)) { parser.parse(); sentences++; }
+        }
+    }
+    TEST_ASSERT_EQUAL(2, sentences);
+    TEST_ASSERT_EQUAL(2, parser.getParsedCount());
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, ubx.getData().latitude * 1e-7f, parser.getData().latitude);
+
+    // NAV-PVT 하나가 두 문장보다 작고, 속도/시각/정확도까지 포함
+    TEST_ASSERT_LESS_THAN(nmeaBytes, pvtBytes);
+
+    const int rounds = 100000;
+    volatile int sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        if (feedAll(ubx, frame, pvtBytes)) sink = sink + ubx.parse();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < 2; i++) {
+            for (const char* p = nmea[i]; *p; p++) {
+                if (parser.feed(*p)) sink = sink + parser.parse();
+            }
+        }
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    double ubxNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds;
+    double nmeaNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / rounds;
+
+    const unsigned FIX_HZ = 10;
+    const double LINK_BYTES_PER_SEC = 115200 / 10.0;
+    char line[128];
+    snprintf(line, sizeof(line), "%u Hz fix: NAV-PVT %u B/s (%.1f %% of 115200), GGA+RMC %u B/s (%.1f %%)",
+             FIX_HZ, (unsigned)(pvtBytes * FIX_HZ), 100.0 * pvtBytes * FIX_HZ / LINK_BYTES_PER_SEC,
+             (unsigned)(nmeaBytes * FIX_HZ), 100.0 * nmeaBytes * FIX_HZ / LINK_BYTES_PER_SEC);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "per fix: NAV-PVT %u bytes, %.0f ns parse; GGA+RMC %u bytes, %.0f ns parse (host)",
+             (unsigned)pvtBytes, ubxNs, (unsigned)nmeaBytes, nmeaNs);
+    TEST_MESSAGE(line);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_build_frame_matches_reference);
+    RUN_TEST(test_nav_pvt_fields);
+    RUN_TEST(test_other_messages_are_not_parsed);
+    RUN_TEST(test_checksum_error_and_resync);
+    RUN_TEST(test_oversize_frame_dropped);
+    RUN_TEST(test_parse_cost);
+    RUN_TEST(test_wire_bytes_vs_nmea);
+    return UNITY_END();
+}
@@ -0,0 +1,175 @@
+// test/test_xbee/test_main.cpp
+#include <unity.h>
+#include <string.h>
+#include "HAL.h"
+#include "XBee.h"
+
+// 한 번에 일부만 받아 주는 UART (availableForWrite보다 적게 써지는 경우)
+class ShortWritePort : public UartPort {
+private:
+    size_t perWrite;
+
+public:
+    uint8_t sent[4096];
+    size_t sentLength;
+
+    ShortWritePort(size_t bytesPerWrite) : perWrite(bytesPerWrite), sentLength(0) {}
+
+    void begin(uint32_t baud) override { (void)baud; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int availableForWrite() override { return 64; }
+    size_t write(const uint8_t* data, size_t length) override {
+        size_t count = length < perWrite ? length : perWrite;
+        memcpy(sent + sentLength, data, count);
+        sentLength += count;
+        return count;
+    }
+};
+
+// 송신된 바이트열을 API 프레임으로 풀어서 RF 데이터를 이어 붙임 (체크섬 오류면 -1)
+static int collectPayload(const uint8_t* stream, size_t length, uint8_t* out, size_t& outLength, int& frames) {
+    uint8_t raw[4096];
+    size_t rawLength = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (stream[i] == XBEE_ESCAPE) raw[rawLength++] = stream[++i] ^ XBEE_XOR;
+        else raw[rawLength++] = stream[i];
+    }
+
+    outLength = 0;
+    frames = 0;
+    size_t i = 0;
+    while (i < rawLength) {
+        if (raw[i] != XBEE_START) return -1;
+        uint16_t frameLength = (raw[i + 1] << 8) | raw[i + 2];
+        const uint8_t* body = &raw[i + 3];
+        uint8_t sum = 0;
+        for (uint16_t k = 0; k <= frameLength; k++) sum += body[k];
+        if (sum != 0xFF || body[0] != XBEE_FRAME_TX_REQUEST) return -1;
+
+        size_t payload = frameLength - XBEE_TX_OVERHEAD;
+        if (payload > XBEE_MAX_PAYLOAD) return -1;
+        memcpy(out + outLength, body + XBEE_TX_OVERHEAD, payload);
+        outLength += payload;
+        frames++;
+        i += 3 + frameLength + 1;
+    }
+    return 0;
+}
+
+static void fillPayload(uint8_t* data, size_t length) {
+    // 이스케이프 대상 바이트 포함
+    static const uint8_t special[] = { XBEE_START, XBEE_ESCAPE, 0x11, 0x13 };
+    for (size_t i = 0; i < length; i++) {
+        data[i] = (i % 5 == 0) ? special[(i / 5) % 4] : (uint8_t)(i * 13);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_short_writes_keep_stream_intact(void) {
+    ShortWritePort port(3);
+    XBee radio(&port);
+    radio.begin(XBEE_BAUD);
+
+    uint8_t payload[200];
+    fillPayload(payload, sizeof(payload));
+    TEST_ASSERT_TRUE(radio.send(payload, sizeof(payload)));
+
+    for (int i = 0; i < 1000 && radio.getQueueDepth() > 0; i++) radio.service();
+    TEST_ASSERT_EQUAL(0, radio.getQueueDepth());
+    TEST_ASSERT_EQUAL(port.sentLength, radio.getBytesSent());
+
+    uint8_t received[512];
+    size_t receivedLength;
+    int frames;
+    TEST_ASSERT_EQUAL(0, collectPayload(port.sent, port.sentLength, received, receivedLength, frames));
+    TEST_ASSERT_EQUAL(3, frames);
+    TEST_ASSERT_EQUAL(sizeof(payload), receivedLength);
+    TEST_ASSERT_EQUAL_MEMORY(payload, received, sizeof(payload));
+}
+
+void test_payload_is_split_at_np(void) {
+    LoopbackPort port;
+    XBee radio(&port);
+
+    uint8_t payload[320];
+    fillPayload(payload, sizeof(payload));
+    TEST_ASSERT_TRUE(radio.send(payload, 320));
+    TEST_ASSERT_EQUAL(4, radio.getFramesQueued());       // 84 + 84 + 84 + 68
+
+    TEST_ASSERT_TRUE(radio.send(payload, XBEE_MAX_PAYLOAD));
+    TEST_ASSERT_EQUAL(5, radio.getFramesQueued());
+
+    // 큐 절반을 넘는 길이는 거부 (프레임을 하나도 넣지 않음)
+    uint8_t big[XBEE_MAX_SEND + 1];
+    TEST_ASSERT_FALSE(radio.send(big, sizeof(big)));
+    TEST_ASSERT_EQUAL(5, radio.getFramesQueued());
+}
+
+void test_high_priority_goes_first(void) {
+    ShortWritePort port(64);
+    XBee radio(&port);
+
+    uint8_t telemetry[10];
+    memset(telemetry, 'T', sizeof(telemetry));
+    uint8_t reply[4] = { 'A', 'C', 'K', '\n' };
+    radio.send(telemetry, sizeof(telemetry), XBEE_PRIORITY_NORMAL);
+    radio.send(reply, sizeof(reply), XBEE_PRIORITY_HIGH);
+
+    for (int i = 0; i < 10; i++) radio.service();
+
+    uint8_t received[64];
+    size_t receivedLength;
+    int frames;
+    TEST_ASSERT_EQUAL(0, collectPayload(port.sent, port.sentLength, received, receivedLength, frames));
+    TEST_ASSERT_EQUAL(2, frames);
+    TEST_ASSERT_EQUAL_MEMORY(reply, received, sizeof(reply));
+}
+
+static size_t handledLength;
+static uint8_t handled[32];
+
+static void onReceive(const uint8_t* data, size_t length) {
+    memcpy(handled, data, length);
+    handledLength = length;
+}
+
+void test_status_and_receive_frames(void) {
+    LoopbackPort port;
+    XBee radio(&port);
+    radio.setReceiveHandler(onReceive);
+    handledLength = 0;
+
+    // TX Status: 전달 성공 1건, 실패 1건
+    const uint8_t delivered[] = { 0x7E, 0x00, 0x07, 0x8B, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x76 };
+    const uint8_t failed[] = { 0x7E, 0x00, 0x07, 0x8B, 0x02, 0xFF, 0xFE, 0x00, 0x21, 0x00, 0x54 };
+    port.inject(delivered, sizeof(delivered));
+    port.inject(failed, sizeof(failed));
+
+    // RX Packet ("CX")
+    uint8_t rx[] = { 0x7E, 0x00, 0x0E, 0x90, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFE, 0x01, 'C', 'X', 0 };
+    uint8_t sum = 0;
+    for (size_t i = 3; i < sizeof(rx) - 1; i++) sum += rx[i];
+    rx[sizeof(rx) - 1] = 0xFF - sum;
+    port.inject(rx, sizeof(rx));
+
+    radio.service();
+    TEST_ASSERT_EQUAL(1, radio.getDelivered());
+    TEST_ASSERT_EQUAL(1, radio.getFailed());
+    TEST_ASSERT_EQUAL(0, radio.getRxErrors());
+    TEST_ASSERT_EQUAL(2, handledLength);
+    TEST_ASSERT_EQUAL_MEMORY("CX", handled, 2);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_short_writes_keep_stream_intact);
+    RUN_TEST(test_payload_is_split_at_np);
+    RUN_TEST(test_high_priority_goes_first);
+    RUN_TEST(test_status_and_receive_frames);
+    return UNITY_END();
+}